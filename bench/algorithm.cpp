@@ -0,0 +1,350 @@
+#include "bench.h"
+#include "types.h"
+
+#include <algorithm>
+#include <random>
+
+#include "algorithm.h"
+
+using bench::Payload;
+
+namespace {
+
+/** Long-lived scratch buffer of N elements. */
+template<typename T, size_t N>
+T* scratch() {
+	static T data[N];
+	return data;
+}
+
+template<typename T, size_t N>
+void sstl_fill(bench::State& state) {
+	T* data = scratch<T, N>();
+
+	while (state.run()) {
+		sstl::fill(data, data + N, T(int(state.size())));
+		bench::do_not_optimize(data[N - 1]);
+	}
+}
+
+template<typename T, size_t N>
+void std_fill(bench::State& state) {
+	T* data = scratch<T, N>();
+
+	while (state.run()) {
+		std::fill(data, data + N, T(int(state.size())));
+		bench::do_not_optimize(data[N - 1]);
+	}
+}
+
+template<typename T, size_t N>
+void sstl_copy(bench::State& state) {
+	const T* source = bench::source<T, N>();
+	T* data = scratch<T, N>();
+
+	while (state.run()) {
+		sstl::copy(source, source + N, data);
+		bench::do_not_optimize(data[N - 1]);
+	}
+}
+
+template<typename T, size_t N>
+void std_copy(bench::State& state) {
+	const T* source = bench::source<T, N>();
+	T* data = scratch<T, N>();
+
+	while (state.run()) {
+		std::copy(source, source + N, data);
+		bench::do_not_optimize(data[N - 1]);
+	}
+}
+
+template<typename T, size_t N>
+void sstl_compare(bench::State& state) {
+	const T* source = bench::source<T, N>();
+	T* data = scratch<T, N>();
+	std::copy(source, source + N, data);
+
+	while (state.run()) {
+		bench::do_not_optimize(
+		    sstl::lexicographical_compare(source, source + N, data, data + N));
+	}
+}
+
+template<typename T, size_t N>
+void std_compare(bench::State& state) {
+	const T* source = bench::source<T, N>();
+	T* data = scratch<T, N>();
+	std::copy(source, source + N, data);
+
+	while (state.run()) {
+		bench::do_not_optimize(
+		    std::lexicographical_compare(source, source + N, data, data + N));
+	}
+}
+
+/** Searches a range of ones for a zero, so every element is visited. */
+template<typename T, size_t N>
+void sstl_find(bench::State& state) {
+	T* data = scratch<T, N>();
+	std::fill(data, data + N, T(1));
+
+	while (state.run()) { bench::do_not_optimize(sstl::find(data, data + N, T(0))); }
+}
+
+template<typename T, size_t N>
+void std_find(bench::State& state) {
+	T* data = scratch<T, N>();
+	std::fill(data, data + N, T(1));
+
+	while (state.run()) { bench::do_not_optimize(std::find(data, data + N, T(0))); }
+}
+
+template<typename T, size_t N>
+void sstl_count(bench::State& state) {
+	const T* source = bench::source<T, N>();
+
+	while (state.run()) { bench::do_not_optimize(sstl::count(source, source + N, source[N / 2])); }
+}
+
+template<typename T, size_t N>
+void std_count(bench::State& state) {
+	const T* source = bench::source<T, N>();
+
+	while (state.run()) { bench::do_not_optimize(std::count(source, source + N, source[N / 2])); }
+}
+
+template<typename T, size_t N>
+void sstl_min_element(bench::State& state) {
+	const T* source = bench::source<T, N>();
+
+	while (state.run()) { bench::do_not_optimize(sstl::min_element(source, source + N)); }
+}
+
+template<typename T, size_t N>
+void std_min_element(bench::State& state) {
+	const T* source = bench::source<T, N>();
+
+	while (state.run()) { bench::do_not_optimize(std::min_element(source, source + N)); }
+}
+
+template<typename T, size_t N>
+void sstl_minmax_element(bench::State& state) {
+	const T* source = bench::source<T, N>();
+
+	while (state.run()) { bench::do_not_optimize(sstl::minmax_element(source, source + N)); }
+}
+
+template<typename T, size_t N>
+void std_minmax_element(bench::State& state) {
+	const T* source = bench::source<T, N>();
+
+	while (state.run()) { bench::do_not_optimize(std::minmax_element(source, source + N)); }
+}
+
+/** Long-lived values 0 .. N-1 in a fixed shuffled order. */
+template<typename T, size_t N>
+const T* shuffled() {
+	static T data[N];
+	static bool ready = false;
+
+	if (!ready) {
+		static int order[N];
+
+		for (size_t i = 0; i < N; ++i) { order[i] = int(i); }
+
+		std::shuffle(order, order + N, std::mt19937(static_cast<uint32_t>(N)));
+
+		for (size_t i = 0; i < N; ++i) { data[i] = T(order[i]); }
+
+		ready = true;
+	}
+
+	return data;
+}
+
+/** Sorts a fresh copy of the shuffled values per sample, the copy is the same for both implementations. */
+template<typename T, size_t N>
+void sstl_sort(bench::State& state) {
+	const T* source = shuffled<T, N>();
+	T* data = scratch<T, N>();
+
+	while (state.run()) {
+		std::copy(source, source + N, data);
+		sstl::sort(data, data + N);
+		bench::do_not_optimize(data[N / 2]);
+	}
+}
+
+template<typename T, size_t N>
+void std_sort(bench::State& state) {
+	const T* source = shuffled<T, N>();
+	T* data = scratch<T, N>();
+
+	while (state.run()) {
+		std::copy(source, source + N, data);
+		std::sort(data, data + N);
+		bench::do_not_optimize(data[N / 2]);
+	}
+}
+
+template<typename T, size_t N>
+void sstl_stable_sort(bench::State& state) {
+	const T* source = shuffled<T, N>();
+	T* data = scratch<T, N>();
+
+	while (state.run()) {
+		std::copy(source, source + N, data);
+		sstl::stable_sort(data, data + N);
+		bench::do_not_optimize(data[N / 2]);
+	}
+}
+
+/** Merges through a buffer of half the range, the size std::stable_sort allocates on the heap. */
+template<typename T, size_t N>
+void sstl_buffered_stable_sort(bench::State& state) {
+	static T buffer[N / 2];
+	const T* source = shuffled<T, N>();
+	T* data = scratch<T, N>();
+
+	while (state.run()) {
+		std::copy(source, source + N, data);
+		sstl::stable_sort(data, data + N, buffer, N / 2);
+		bench::do_not_optimize(data[N / 2]);
+	}
+}
+
+template<typename T, size_t N>
+void std_stable_sort(bench::State& state) {
+	const T* source = shuffled<T, N>();
+	T* data = scratch<T, N>();
+
+	while (state.run()) {
+		std::copy(source, source + N, data);
+		std::stable_sort(data, data + N);
+		bench::do_not_optimize(data[N / 2]);
+	}
+}
+
+template<typename T, size_t N>
+void sstl_nth_element(bench::State& state) {
+	const T* source = shuffled<T, N>();
+	T* data = scratch<T, N>();
+
+	while (state.run()) {
+		std::copy(source, source + N, data);
+		sstl::nth_element(data, data + N / 3, data + N);
+		bench::do_not_optimize(data[N / 3]);
+	}
+}
+
+template<typename T, size_t N>
+void std_nth_element(bench::State& state) {
+	const T* source = shuffled<T, N>();
+	T* data = scratch<T, N>();
+
+	while (state.run()) {
+		std::copy(source, source + N, data);
+		std::nth_element(data, data + N / 3, data + N);
+		bench::do_not_optimize(data[N / 3]);
+	}
+}
+
+/** Integral key of the radix sort benchmarks, which for Payload is its first word. */
+inline int radix_key(int value) { return value; }
+inline uint32_t radix_key(const Payload& value) { return value.words[0]; }
+
+/** Compares by radix_key, so comparison sorts order Payload by the same key as the radix sort. */
+template<typename T>
+struct key_less {
+	bool operator()(const T& a, const T& b) const { return radix_key(a) < radix_key(b); }
+};
+
+template<typename T>
+struct key_of {
+	uint32_t operator()(const T& value) const { return uint32_t(radix_key(value)); }
+};
+
+template<typename T, size_t N>
+void sstl_radix_sort(bench::State& state) {
+	static T buffer[N];
+	const T* source = shuffled<T, N>();
+	T* data = scratch<T, N>();
+
+	while (state.run()) {
+		std::copy(source, source + N, data);
+		sstl::radix_sort(data, data + N, buffer, key_of<T>());
+		bench::do_not_optimize(data[N / 2]);
+	}
+}
+
+template<typename T, size_t N>
+void sstl_key_sort(bench::State& state) {
+	const T* source = shuffled<T, N>();
+	T* data = scratch<T, N>();
+
+	while (state.run()) {
+		std::copy(source, source + N, data);
+		sstl::sort(data, data + N, key_less<T>());
+		bench::do_not_optimize(data[N / 2]);
+	}
+}
+
+template<typename T, size_t N>
+void std_key_sort(bench::State& state) {
+	const T* source = shuffled<T, N>();
+	T* data = scratch<T, N>();
+
+	while (state.run()) {
+		std::copy(source, source + N, data);
+		std::sort(data, data + N, key_less<T>());
+		bench::do_not_optimize(data[N / 2]);
+	}
+}
+
+#define RADIX_SORT_BENCHMARKS(type) \
+	SSTL_BENCHMARK_SIZES("algorithm.radix_sort", "sstl_radix", type, sstl_radix_sort); \
+	SSTL_BENCHMARK_SIZES("algorithm.radix_sort", "sstl_sort", type, sstl_key_sort); \
+	SSTL_BENCHMARK_SIZES("algorithm.radix_sort", "std_sort", type, std_key_sort)
+
+#define SCAN_BENCHMARKS(type) \
+	SSTL_BENCHMARK_SIZES("algorithm.find", "sstl", type, sstl_find); \
+	SSTL_BENCHMARK_SIZES("algorithm.find", "std", type, std_find); \
+	SSTL_BENCHMARK_SIZES("algorithm.count", "sstl", type, sstl_count); \
+	SSTL_BENCHMARK_SIZES("algorithm.count", "std", type, std_count); \
+	SSTL_BENCHMARK_SIZES("algorithm.min_element", "sstl", type, sstl_min_element); \
+	SSTL_BENCHMARK_SIZES("algorithm.min_element", "std", type, std_min_element); \
+	SSTL_BENCHMARK_SIZES("algorithm.minmax_element", "sstl", type, sstl_minmax_element); \
+	SSTL_BENCHMARK_SIZES("algorithm.minmax_element", "std", type, std_minmax_element)
+
+#define SORT_BENCHMARKS(type) \
+	SSTL_BENCHMARK_SIZES("algorithm.sort", "sstl", type, sstl_sort); \
+	SSTL_BENCHMARK_SIZES("algorithm.sort", "std", type, std_sort); \
+	SSTL_BENCHMARK_SIZES("algorithm.stable_sort", "sstl", type, sstl_stable_sort); \
+	SSTL_BENCHMARK_SIZES("algorithm.stable_sort", "sstl_buffer", type, sstl_buffered_stable_sort); \
+	SSTL_BENCHMARK_SIZES("algorithm.stable_sort", "std", type, std_stable_sort); \
+	SSTL_BENCHMARK_SIZES("algorithm.nth_element", "sstl", type, sstl_nth_element); \
+	SSTL_BENCHMARK_SIZES("algorithm.nth_element", "std", type, std_nth_element)
+
+#define ALGORITHM_BENCHMARKS(type) \
+	SSTL_BENCHMARK_SIZES("algorithm.fill", "sstl", type, sstl_fill); \
+	SSTL_BENCHMARK_SIZES("algorithm.fill", "std", type, std_fill); \
+	SSTL_BENCHMARK_SIZES("algorithm.copy", "sstl", type, sstl_copy); \
+	SSTL_BENCHMARK_SIZES("algorithm.copy", "std", type, std_copy); \
+	SSTL_BENCHMARK_SIZES("algorithm.lexicographical_compare", "sstl", type, sstl_compare); \
+	SSTL_BENCHMARK_SIZES("algorithm.lexicographical_compare", "std", type, std_compare)
+
+ALGORITHM_BENCHMARKS(uint8_t);
+ALGORITHM_BENCHMARKS(int);
+ALGORITHM_BENCHMARKS(Payload);
+
+SCAN_BENCHMARKS(uint8_t);
+SCAN_BENCHMARKS(int);
+
+SORT_BENCHMARKS(int);
+SORT_BENCHMARKS(Payload);
+
+RADIX_SORT_BENCHMARKS(int);
+RADIX_SORT_BENCHMARKS(Payload);
+
+} /* namespace */
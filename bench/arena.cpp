@@ -0,0 +1,72 @@
+#include "bench.h"
+
+#include <map>
+#include <vector>
+
+#include "static_allocator.h"
+
+namespace {
+
+/** One region for every benchmark below, large enough for the biggest map. */
+sstl::arena<(size_t(1) << 23)> region;
+
+template<typename T, size_t N>
+void sstl_vector_push(bench::State& state) {
+	while (state.run()) {
+		std::vector<T, sstl::static_allocator<T> > v((sstl::static_allocator<T>(region)));
+
+		for (size_t i = 0; i < N; ++i) { v.push_back(T(i)); }
+
+		bench::do_not_optimize(v.data());
+		bench::clobber_memory();
+		region.release();
+	}
+}
+
+template<typename T, size_t N>
+void std_vector_push(bench::State& state) {
+	while (state.run()) {
+		std::vector<T> v;
+
+		for (size_t i = 0; i < N; ++i) { v.push_back(T(i)); }
+
+		bench::do_not_optimize(v.data());
+		bench::clobber_memory();
+	}
+}
+
+template<typename T, size_t N>
+void sstl_map_insert(bench::State& state) {
+	typedef sstl::static_allocator<std::pair<const T, T> > allocator;
+
+	while (state.run()) {
+		std::map<T, T, std::less<T>, allocator> m((std::less<T>()), allocator(region));
+
+		for (size_t i = 0; i < N; ++i) { m.insert(std::make_pair(T(i * 7 % N), T(i))); }
+
+		bench::do_not_optimize(m);
+		bench::clobber_memory();
+		region.release();
+	}
+}
+
+template<typename T, size_t N>
+void std_map_insert(bench::State& state) {
+	while (state.run()) {
+		std::map<T, T> m;
+
+		for (size_t i = 0; i < N; ++i) { m.insert(std::make_pair(T(i * 7 % N), T(i))); }
+
+		bench::do_not_optimize(m);
+		bench::clobber_memory();
+	}
+}
+
+#define ARENA_BENCHMARKS(group, function) \
+	SSTL_BENCHMARK_SIZES(group, "sstl", int, sstl_##function); \
+	SSTL_BENCHMARK_SIZES(group, "std", int, std_##function)
+
+ARENA_BENCHMARKS("static_allocator.vector_push", vector_push);
+ARENA_BENCHMARKS("static_allocator.map_insert", map_insert);
+
+} /* namespace */
@@ -0,0 +1,121 @@
+#include "bench.h"
+#include "types.h"
+
+#include <algorithm>
+#include <new>
+
+#include "algorithm.h"
+#include "array.h"
+#include "type_traits.h"
+#include "utility.h"
+
+using bench::Payload;
+
+namespace {
+
+template<typename T, size_t N>
+void sstl_fill(bench::State& state) {
+	typename bench::SstlArray<T, N>::type& a = bench::SstlArray<T, N>::get(0);
+
+	while (state.run()) {
+		sstl::fill(a.begin(), a.end(), T(int(state.size())));
+		bench::do_not_optimize(a.back());
+	}
+}
+
+template<typename T, size_t N>
+void std_fill(bench::State& state) {
+	typename bench::StdArray<T, N>::type& a = bench::StdArray<T, N>::get(0);
+
+	while (state.run()) {
+		a.fill(T(int(state.size())));
+		bench::do_not_optimize(a.back());
+	}
+}
+
+template<template<typename, size_t> class Array, typename T, size_t N>
+void copy_assign(bench::State& state) {
+	typename Array<T, N>::type& a = Array<T, N>::get(0);
+	typename Array<T, N>::type& b = Array<T, N>::get(1);
+
+	while (state.run()) {
+		a = b;
+		bench::do_not_optimize(a.back());
+	}
+}
+
+template<template<typename, size_t> class Array, typename T, size_t N>
+void equal(bench::State& state) {
+	typename Array<T, N>::type& a = Array<T, N>::get(0);
+	typename Array<T, N>::type& b = Array<T, N>::get(1);
+	b = a;
+
+	while (state.run()) { bench::do_not_optimize(a == b); }
+}
+
+template<template<typename, size_t> class Array, typename T, size_t N>
+void compare(bench::State& state) {
+	typename Array<T, N>::type& a = Array<T, N>::get(0);
+	typename Array<T, N>::type& b = Array<T, N>::get(1);
+	b = a;
+
+	while (state.run()) { bench::do_not_optimize(a < b); }
+}
+
+/** Constructs an array in place, as a request handler building a scratch buffer would. */
+template<typename T, size_t N>
+void sstl_construct(bench::State& state) {
+	typedef sstl::array<T, N> Array;
+	static typename sstl::aligned_storage<sizeof(Array),
+	    sstl::alignment_of<Array>::value>::type memory;
+
+	while (state.run()) {
+		Array* a = new(&memory) Array;
+		bench::do_not_optimize(a->data());
+		a->~Array();
+	}
+}
+
+template<typename T, size_t N>
+void sstl_construct_default_init(bench::State& state) {
+	typedef sstl::array<T, N> Array;
+	static typename sstl::aligned_storage<sizeof(Array),
+	    sstl::alignment_of<Array>::value>::type memory;
+
+	while (state.run()) {
+		Array* a = new(&memory) Array(sstl::default_init);
+		bench::do_not_optimize(a->data());
+		a->~Array();
+	}
+}
+
+template<typename T, size_t N>
+void sstl_copy_assign(bench::State& state) { copy_assign<bench::SstlArray, T, N>(state); }
+template<typename T, size_t N>
+void std_copy_assign(bench::State& state) { copy_assign<bench::StdArray, T, N>(state); }
+template<typename T, size_t N>
+void sstl_equal(bench::State& state) { equal<bench::SstlArray, T, N>(state); }
+template<typename T, size_t N>
+void std_equal(bench::State& state) { equal<bench::StdArray, T, N>(state); }
+template<typename T, size_t N>
+void sstl_compare(bench::State& state) { compare<bench::SstlArray, T, N>(state); }
+template<typename T, size_t N>
+void std_compare(bench::State& state) { compare<bench::StdArray, T, N>(state); }
+
+#define ARRAY_BENCHMARKS(type) \
+	SSTL_BENCHMARK_SIZES("array.fill", "sstl", type, sstl_fill); \
+	SSTL_BENCHMARK_SIZES("array.fill", "std", type, std_fill); \
+	SSTL_BENCHMARK_SIZES("array.construct", "sstl", type, sstl_construct); \
+	SSTL_BENCHMARK_SIZES("array.construct", "sstl_default_init", type, sstl_construct_default_init); \
+	SSTL_BENCHMARK_SIZES("array.copy_assign", "sstl", type, sstl_copy_assign); \
+	SSTL_BENCHMARK_SIZES("array.copy_assign", "std", type, std_copy_assign); \
+	SSTL_BENCHMARK_SIZES("array.equal", "sstl", type, sstl_equal); \
+	SSTL_BENCHMARK_SIZES("array.equal", "std", type, std_equal); \
+	SSTL_BENCHMARK_SIZES("array.lexicographical_compare", "sstl", type, sstl_compare); \
+	SSTL_BENCHMARK_SIZES("array.lexicographical_compare", "std", type, std_compare)
+
+ARRAY_BENCHMARKS(uint8_t);
+ARRAY_BENCHMARKS(int);
+ARRAY_BENCHMARKS(Payload);
+
+} /* namespace */
@@ -0,0 +1,168 @@
+#include "bench.h"
+
+#include <string.h>
+
+#include <string>
+
+#include "basic_string.h"
+
+namespace {
+
+/**
+	Long-lived text of N characters drawn from 'a' to 'y', except for a '#'
+	at the front and "z;" at the back, so every search below scans the
+	whole text before it finds its match.
+*/
+template<size_t N>
+const char* text() {
+	static char data[N + 1];
+	static bool ready = false;
+
+	if (!ready) {
+		for (size_t i = 0; i < N; ++i) { data[i] = char('a' + (i * 7) % 25); }
+
+		data[0] = '#';
+		memcpy(data + N - 2, "z;", 2);
+		ready = true;
+	}
+
+	return data;
+}
+
+/** Number of copies made per sample, short strings are too quick to time one at a time. */
+const size_t copies = 64;
+
+template<typename T, size_t N>
+void sstl_copy(bench::State& state) {
+	const sstl::basic_string<T, N> source(text<N>(), N);
+	state.set_items(copies);
+
+	while (state.run()) {
+		for (size_t i = 0; i < copies; ++i) {
+			sstl::basic_string<T, N> copy(source);
+			bench::do_not_optimize(copy);
+			bench::clobber_memory();
+		}
+	}
+}
+
+/** At 8 characters std::string keeps the copy inline, longer copies allocate. */
+template<typename T, size_t N>
+void std_copy(bench::State& state) {
+	const std::basic_string<T> source(text<N>(), N);
+	state.set_items(copies);
+
+	while (state.run()) {
+		for (size_t i = 0; i < copies; ++i) {
+			std::basic_string<T> copy(source);
+			bench::do_not_optimize(copy);
+			bench::clobber_memory();
+		}
+	}
+}
+
+template<typename T, size_t N>
+void sstl_append(bench::State& state) {
+	const char* words = text<N>();
+
+	while (state.run()) {
+		sstl::basic_string<T, N> s;
+
+		for (size_t i = 0; i < N; i += 8) { s.append(words + i, 8); }
+
+		bench::do_not_optimize(s);
+		bench::clobber_memory();
+	}
+}
+
+template<typename T, size_t N>
+void std_append(bench::State& state) {
+	const char* words = text<N>();
+
+	while (state.run()) {
+		std::basic_string<T> s;
+
+		for (size_t i = 0; i < N; i += 8) { s.append(words + i, 8); }
+
+		bench::do_not_optimize(s);
+		bench::clobber_memory();
+	}
+}
+
+template<typename T, size_t N>
+void sstl_find(bench::State& state) {
+	const sstl::basic_string<T, N> s(text<N>(), N);
+
+	while (state.run()) { bench::do_not_optimize(s.find("z;")); }
+}
+
+template<typename T, size_t N>
+void std_find(bench::State& state) {
+	const std::basic_string<T> s(text<N>(), N);
+
+	while (state.run()) { bench::do_not_optimize(s.find("z;")); }
+}
+
+template<typename T, size_t N>
+void sstl_rfind(bench::State& state) {
+	const sstl::basic_string<T, N> s(text<N>(), N);
+
+	while (state.run()) { bench::do_not_optimize(s.rfind('#')); }
+}
+
+template<typename T, size_t N>
+void std_rfind(bench::State& state) {
+	const std::basic_string<T> s(text<N>(), N);
+
+	while (state.run()) { bench::do_not_optimize(s.rfind('#')); }
+}
+
+template<typename T, size_t N>
+void sstl_find_first_of(bench::State& state) {
+	const sstl::basic_string<T, N> s(text<N>(), N);
+
+	while (state.run()) { bench::do_not_optimize(s.find_first_of(",;:")); }
+}
+
+template<typename T, size_t N>
+void std_find_first_of(bench::State& state) {
+	const std::basic_string<T> s(text<N>(), N);
+
+	while (state.run()) { bench::do_not_optimize(s.find_first_of(",;:")); }
+}
+
+template<typename T, size_t N>
+void sstl_compare(bench::State& state) {
+	const sstl::basic_string<T, N> a(text<N>(), N);
+	const sstl::basic_string<T, N> b(a);
+
+	while (state.run()) { bench::do_not_optimize(a.compare(b)); }
+}
+
+template<typename T, size_t N>
+void std_compare(bench::State& state) {
+	const std::basic_string<T> a(text<N>(), N);
+	const std::basic_string<T> b(a);
+
+	while (state.run()) { bench::do_not_optimize(a.compare(b)); }
+}
+
+/** Registers a string benchmark from a length std::string keeps inline up to one it cannot. */
+#define STRING_BENCHMARK_SIZES(group, impl, function) \
+	SSTL_BENCHMARK(group, impl, char, 8, function<char, 8>); \
+	SSTL_BENCHMARK(group, impl, char, 64, function<char, 64>); \
+	SSTL_BENCHMARK(group, impl, char, 1024, function<char, 1024>); \
+	SSTL_BENCHMARK(group, impl, char, 16384, function<char, 16384>)
+
+#define STRING_BENCHMARKS(group, function) \
+	STRING_BENCHMARK_SIZES(group, "sstl", sstl_##function); \
+	STRING_BENCHMARK_SIZES(group, "std", std_##function)
+
+STRING_BENCHMARKS("string.copy", copy);
+STRING_BENCHMARKS("string.append", append);
+STRING_BENCHMARKS("string.find", find);
+STRING_BENCHMARKS("string.rfind", rfind);
+STRING_BENCHMARKS("string.find_first_of", find_first_of);
+STRING_BENCHMARKS("string.compare", compare);
+
+} /* namespace */
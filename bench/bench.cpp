@@ -0,0 +1,234 @@
+#include "bench.h"
+
+#include <algorithm>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <ctime>
+#include <vector>
+
+#if defined(__x86_64__) || defined(__i386__)
+#include <x86intrin.h>
+#define SSTL_BENCH_HAS_TSC 1
+#endif
+
+#ifndef SSTL_BENCH_FLAGS
+#define SSTL_BENCH_FLAGS ""
+#endif
+
+namespace bench {
+
+namespace {
+
+uint64_t now_ns() {
+	timespec ts;
+	clock_gettime(CLOCK_MONOTONIC, &ts);
+	return uint64_t(ts.tv_sec) * 1000000000u + uint64_t(ts.tv_nsec);
+}
+
+uint64_t now_cycles() {
+#if defined(SSTL_BENCH_HAS_TSC)
+	return __rdtsc();
+#else
+	return 0;
+#endif
+}
+
+struct Benchmark {
+	const char* group;
+	const char* impl;
+	const char* type;
+	size_t size;
+	Function function;
+};
+
+std::vector<Benchmark>& registry() {
+	static std::vector<Benchmark> benchmarks;
+	return benchmarks;
+}
+
+/** Returns the value at quantile q of an ascending sorted range. */
+double quantile(const double* sorted, size_t count, double q) {
+	size_t index = size_t(q * double(count));
+	return sorted[index < count ? index : count - 1];
+}
+
+double median(const double* sorted, size_t count) {
+	if (count % 2) { return sorted[count / 2]; }
+
+	return (sorted[count / 2 - 1] + sorted[count / 2]) / 2;
+}
+
+/** Writes s as a JSON string literal. */
+void print_string(const char* s) {
+	std::putchar('"');
+
+	for (; *s; ++s) {
+		if (*s == '"' || *s == '\\') { std::putchar('\\'); }
+
+		std::putchar(*s);
+	}
+
+	std::putchar('"');
+}
+
+} /* namespace */
+
+State::State(size_t size, size_t warmup, size_t reps)
+	: size_(size), items_(size), warmup_(warmup), reps_(reps), taken_(0),
+	  running_(false), start_ns_(0), start_cycles_(0), paused_ns_(0),
+	  paused_cycles_(0), pause_ns_(0), pause_cycles_(0),
+	  ns_(new double[reps]), cycles_(new double[reps]) {}
+
+State::~State() {
+	delete[] ns_;
+	delete[] cycles_;
+}
+
+bool State::run() {
+	if (running_) { stop_sample(); }
+
+	if (taken_ == warmup_ + reps_) {
+		std::sort(ns_, ns_ + reps_);
+		std::sort(cycles_, cycles_ + reps_);
+		return false;
+	}
+
+	running_ = true;
+	paused_ns_ = 0;
+	paused_cycles_ = 0;
+	clobber_memory();
+	start_cycles_ = now_cycles();
+	start_ns_ = now_ns();
+	return true;
+}
+
+void State::stop_sample() {
+	const uint64_t stop_ns = now_ns();
+	const uint64_t stop_cycles = now_cycles();
+	clobber_memory();
+	running_ = false;
+
+	if (taken_ >= warmup_) {
+		ns_[taken_ - warmup_] = double(stop_ns - start_ns_ - paused_ns_);
+		cycles_[taken_ - warmup_] =
+		    double(stop_cycles - start_cycles_ - paused_cycles_);
+	}
+
+	++taken_;
+}
+
+void State::pause_timing() {
+	clobber_memory();
+	pause_cycles_ = now_cycles();
+	pause_ns_ = now_ns();
+}
+
+void State::resume_timing() {
+	paused_ns_ += now_ns() - pause_ns_;
+	paused_cycles_ += now_cycles() - pause_cycles_;
+	clobber_memory();
+}
+
+Registration::Registration(const char* group, const char* impl,
+                           const char* type, size_t size, Function function) {
+	Benchmark benchmark = {group, impl, type, size, function};
+	registry().push_back(benchmark);
+}
+
+int run_all(int argc, char** argv) {
+	const char* filter = "";
+	size_t warmup = 5;
+	size_t reps = 51;
+	size_t max_size = size_t(-1);
+
+	for (int i = 1; i < argc; ++i) {
+		const char* arg = argv[i];
+		const char* value = i + 1 < argc ? argv[i + 1] : 0;
+
+		if (!value) {
+			arg = "";
+		}
+
+		if (!std::strcmp(arg, "--filter")) {
+			filter = value;
+		} else if (!std::strcmp(arg, "--warmup")) {
+			warmup = std::strtoul(value, 0, 10);
+		} else if (!std::strcmp(arg, "--reps")) {
+			reps = std::strtoul(value, 0, 10);
+		} else if (!std::strcmp(arg, "--max-size")) {
+			max_size = std::strtoul(value, 0, 10);
+		} else {
+			std::fprintf(stderr, "usage: %s [--filter group] [--warmup n] "
+			             "[--reps n] [--max-size n]\n", argv[0]);
+			return 1;
+		}
+
+		++i;
+	}
+
+	if (reps == 0) { reps = 1; }
+
+	char timestamp[32];
+	const time_t now = time(0);
+	strftime(timestamp, sizeof(timestamp), "%Y-%m-%dT%H:%M:%SZ", gmtime(&now));
+
+	std::printf("{\n  \"context\": {\n");
+	std::printf("    \"timestamp\": \"%s\",\n", timestamp);
+	std::printf("    \"compiler\": ");
+	print_string(__VERSION__);
+	std::printf(",\n    \"flags\": ");
+	print_string(SSTL_BENCH_FLAGS);
+	std::printf(",\n    \"cplusplus\": %ld,\n", long(__cplusplus));
+	std::printf("    \"warmup\": %lu,\n", (unsigned long)warmup);
+	std::printf("    \"reps\": %lu,\n", (unsigned long)reps);
+#if defined(SSTL_BENCH_HAS_TSC)
+	std::printf("    \"cycle_counter\": \"tsc\"\n");
+#else
+	std::printf("    \"cycle_counter\": null\n");
+#endif
+	std::printf("  },\n  \"benchmarks\": [");
+
+	const std::vector<Benchmark>& benchmarks = registry();
+	bool first = true;
+
+	for (size_t i = 0; i < benchmarks.size(); ++i) {
+		const Benchmark& b = benchmarks[i];
+
+		if (!std::strstr(b.group, filter) || b.size > max_size) { continue; }
+
+		std::fprintf(stderr, "%s/%s/%s/%lu\n", b.group, b.impl, b.type,
+		             (unsigned long)b.size);
+
+		State state(b.size, warmup, reps);
+		b.function(state);
+
+		const double items = state.items() ? double(state.items()) : 1.0;
+		const double median_cycles = median(state.cycles(), state.samples());
+
+		std::printf("%s\n    {\"group\": ", first ? "" : ",");
+		print_string(b.group);
+		std::printf(", \"impl\": ");
+		print_string(b.impl);
+		std::printf(", \"type\": ");
+		print_string(b.type);
+		std::printf(", \"size\": %lu, \"items\": %lu",
+		            (unsigned long)b.size, (unsigned long)state.items());
+		std::printf(", \"median_ns\": %.1f, \"p99_ns\": %.1f, \"min_ns\": %.1f",
+		            median(state.nanoseconds(), state.samples()),
+		            quantile(state.nanoseconds(), state.samples(), 0.99),
+		            state.nanoseconds()[0]);
+#if defined(SSTL_BENCH_HAS_TSC)
+		std::printf(", \"cycles_per_element\": %.3f}", median_cycles / items);
+#else
+		(void)median_cycles;
+		std::printf(", \"cycles_per_element\": null}");
+#endif
+		first = false;
+	}
+
+	std::printf("\n  ]\n}\n");
+	return 0;
+}
+
+} /* namespace bench */
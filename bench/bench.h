@@ -0,0 +1,114 @@
+/**
+    @brief  Minimal microbenchmark harness for comparing sstl against std.
+
+    Benchmarks register themselves at static initialization time and are run
+    from bench/main.cpp, which prints one JSON document with the results.
+*/
+
+#ifndef STATIC_STL_BENCH_BENCH_H_
+#define STATIC_STL_BENCH_BENCH_H_
+
+#include <stddef.h>
+#include <stdint.h>
+
+namespace bench {
+
+/** Per-run state handed to every benchmark function. */
+class State {
+  public:
+	State(size_t size, size_t warmup, size_t reps);
+
+	/**
+		Ends the current sample (if any) and starts the next one. Returns
+		false once all warmup and measured samples have been taken.
+	*/
+	bool run();
+
+	/** Excludes the time until resume_timing() from the current sample. */
+	void pause_timing();
+	void resume_timing();
+
+	/** Number of elements the benchmark should operate on. */
+	size_t size() const { return size_; }
+
+	/** Overrides the element count used for per-element figures, e.g. for quadratic loops. */
+	void set_items(size_t items) { items_ = items; }
+	size_t items() const { return items_; }
+
+	/** Sorted sample durations, valid once run() has returned false. */
+	const double* nanoseconds() const { return ns_; }
+	const double* cycles() const { return cycles_; }
+	size_t samples() const { return reps_; }
+
+	~State();
+
+  private:
+	State(const State&);
+	State& operator=(const State&);
+
+	void stop_sample();
+
+	size_t size_;
+	size_t items_;
+	size_t warmup_;
+	size_t reps_;
+	size_t taken_;
+	bool running_;
+
+	uint64_t start_ns_;
+	uint64_t start_cycles_;
+	uint64_t paused_ns_;
+	uint64_t paused_cycles_;
+	uint64_t pause_ns_;
+	uint64_t pause_cycles_;
+
+	double* ns_;
+	double* cycles_;
+};
+
+typedef void (*Function)(State&);
+
+/** Registers a benchmark with the global registry, used by SSTL_BENCHMARK. */
+struct Registration {
+	Registration(const char* group, const char* impl, const char* type,
+	             size_t size, Function function);
+};
+
+/** Runs every registered benchmark whose group contains filter and prints JSON to stdout. */
+int run_all(int argc, char** argv);
+
+/** Prevents the compiler from optimizing away the computation of value. */
+template<typename T>
+inline void do_not_optimize(const T& value) {
+	asm volatile("" : : "r,m"(value) : "memory");
+}
+
+/** Forces the compiler to treat all memory as read and written. */
+inline void clobber_memory() {
+	asm volatile("" : : : "memory");
+}
+
+} /* namespace bench */
+
+#define SSTL_BENCH_CONCAT_(a, b) a##b
+#define SSTL_BENCH_CONCAT(a, b) SSTL_BENCH_CONCAT_(a, b)
+
+/** Registers function for a (group, impl, type, size) tuple. */
+#define SSTL_BENCHMARK(group, impl, type, size, ...) \
+	static ::bench::Registration SSTL_BENCH_CONCAT(bench_registration_, __COUNTER__)( \
+	    group, impl, #type, size, __VA_ARGS__)
+
+/** Registers a function template parameterized on <T, N> for the standard sizes. */
+#define SSTL_BENCHMARK_SIZES(group, impl, type, function) \
+	SSTL_BENCHMARK(group, impl, type, 16, function<type, 16>); \
+	SSTL_BENCHMARK(group, impl, type, 256, function<type, 256>); \
+	SSTL_BENCHMARK(group, impl, type, 4096, function<type, 4096>); \
+	SSTL_BENCHMARK(group, impl, type, 65536, function<type, 65536>)
+
+/** Registers the standard sizes up to 4096, for benchmarks which are quadratic in N. */
+#define SSTL_BENCHMARK_SMALL_SIZES(group, impl, type, function) \
+	SSTL_BENCHMARK(group, impl, type, 16, function<type, 16>); \
+	SSTL_BENCHMARK(group, impl, type, 256, function<type, 256>); \
+	SSTL_BENCHMARK(group, impl, type, 4096, function<type, 4096>)
+
+#endif /* STATIC_STL_BENCH_BENCH_H_ */
@@ -0,0 +1,168 @@
+#include "bench.h"
+
+#include <algorithm>
+#include <bitset>
+#include <random>
+
+#include "array.h"
+#include "bitset.h"
+
+namespace {
+
+/** Long-lived occupancy flags with about one bit in 32 set, at fixed pseudo-random positions. */
+template<size_t N>
+const bool* flags() {
+	static bool data[N];
+	static bool ready = false;
+
+	if (!ready) {
+		std::mt19937 random(static_cast<uint32_t>(N));
+
+		for (size_t i = 0; i < N; ++i) { data[i] = random() % 32 == 0; }
+
+		ready = true;
+	}
+
+	return data;
+}
+
+template<size_t N>
+const sstl::bitset<N>& sstl_bits() {
+	static sstl::bitset<N> bits;
+	const bool* source = flags<N>();
+
+	for (size_t i = 0; i < N; ++i) { bits.set(i, source[i]); }
+
+	return bits;
+}
+
+template<size_t N>
+const std::bitset<N>& std_bits() {
+	static std::bitset<N> bits;
+	const bool* source = flags<N>();
+
+	for (size_t i = 0; i < N; ++i) { bits.set(i, source[i]); }
+
+	return bits;
+}
+
+/** The representation being replaced: one byte per flag. */
+template<size_t N>
+const sstl::array<bool, N>& bool_array() {
+	static sstl::array<bool, N> bits;
+	std::copy(flags<N>(), flags<N>() + N, bits.begin());
+	return bits;
+}
+
+template<typename T, size_t N>
+void sstl_count(bench::State& state) {
+	const sstl::bitset<N>& bits = sstl_bits<N>();
+
+	while (state.run()) { bench::do_not_optimize(bits.count()); }
+}
+
+template<typename T, size_t N>
+void std_count(bench::State& state) {
+	const std::bitset<N>& bits = std_bits<N>();
+
+	while (state.run()) { bench::do_not_optimize(bits.count()); }
+}
+
+template<typename T, size_t N>
+void array_count(bench::State& state) {
+	const sstl::array<bool, N>& bits = bool_array<N>();
+
+	while (state.run()) { bench::do_not_optimize(std::count(bits.begin(), bits.end(), true)); }
+}
+
+template<typename T, size_t N>
+void sstl_scan(bench::State& state) {
+	const sstl::bitset<N>& bits = sstl_bits<N>();
+
+	while (state.run()) {
+		size_t sum = 0;
+
+		for (size_t i = bits.find_first(); i != bits.size(); i = bits.find_next(i)) { sum += i; }
+
+		bench::do_not_optimize(sum);
+	}
+}
+
+/** libstdc++ has the same word skipping scan as an extension. */
+template<typename T, size_t N>
+void std_scan(bench::State& state) {
+	const std::bitset<N>& bits = std_bits<N>();
+
+	while (state.run()) {
+		size_t sum = 0;
+
+		for (size_t i = bits._Find_first(); i != bits.size(); i = bits._Find_next(i)) { sum += i; }
+
+		bench::do_not_optimize(sum);
+	}
+}
+
+template<typename T, size_t N>
+void array_scan(bench::State& state) {
+	const sstl::array<bool, N>& bits = bool_array<N>();
+
+	while (state.run()) {
+		size_t sum = 0;
+
+		for (size_t i = 0; i < N; ++i) {
+			if (bits[i]) { sum += i; }
+		}
+
+		bench::do_not_optimize(sum);
+	}
+}
+
+template<typename T, size_t N>
+void sstl_set_range(bench::State& state) {
+	static sstl::bitset<N> bits;
+
+	while (state.run()) {
+		bits.set_range(1, N - 1);
+		bench::do_not_optimize(bits);
+		bits.reset_range(1, N - 1);
+		bench::do_not_optimize(bits);
+	}
+}
+
+template<typename T, size_t N>
+void std_set_range(bench::State& state) {
+	static std::bitset<N> bits;
+
+	while (state.run()) {
+		for (size_t i = 1; i < N - 1; ++i) { bits.set(i); }
+
+		bench::do_not_optimize(bits);
+
+		for (size_t i = 1; i < N - 1; ++i) { bits.reset(i); }
+
+		bench::do_not_optimize(bits);
+	}
+}
+
+template<typename T, size_t N>
+void array_set_range(bench::State& state) {
+	static sstl::array<bool, N> bits;
+
+	while (state.run()) {
+		std::fill(bits.begin() + 1, bits.end() - 1, true);
+		bench::do_not_optimize(bits);
+		std::fill(bits.begin() + 1, bits.end() - 1, false);
+		bench::do_not_optimize(bits);
+	}
+}
+
+#define BITSET_BENCHMARKS(group, function) \
+	SSTL_BENCHMARK_SIZES(group, "sstl", bool, sstl_##function); \
+	SSTL_BENCHMARK_SIZES(group, "std", bool, std_##function); \
+	SSTL_BENCHMARK_SIZES(group, "bool_array", bool, array_##function)
+
+BITSET_BENCHMARKS("bitset.count", count);
+BITSET_BENCHMARKS("bitset.scan", scan);
+BITSET_BENCHMARKS("bitset.set_range", set_range);
+
+} /* namespace */
@@ -0,0 +1,104 @@
+#include "bench.h"
+
+#include <algorithm>
+#include <random>
+
+#include "algorithm.h"
+#include "eytzinger_array.h"
+
+namespace {
+
+/** Number of keys looked up per run, independent of the table size. */
+const size_t lookups = 4096;
+
+/** Sorted table of N distinct even keys, as a routing table would hold. */
+template<typename T, size_t N>
+const T* table() {
+	static T data[N];
+	static bool ready = false;
+
+	if (!ready) {
+		for (size_t i = 0; i < N; ++i) { data[i] = T(2 * i); }
+
+		ready = true;
+	}
+
+	return data;
+}
+
+/** Uniformly random keys up to the largest in the table, half of which are missing from it. */
+template<typename T, size_t N>
+const T* keys() {
+	static T data[lookups];
+	static bool ready = false;
+
+	if (!ready) {
+		std::mt19937 random(static_cast<uint32_t>(N));
+
+		for (size_t i = 0; i < lookups; ++i) { data[i] = T(random() % (2 * N - 1)); }
+
+		ready = true;
+	}
+
+	return data;
+}
+
+template<typename T, size_t N>
+void sstl_lower_bound(bench::State& state) {
+	static sstl::eytzinger_array<T, N> a;
+	const T* k = keys<T, N>();
+
+	a.assign(table<T, N>(), table<T, N>() + N);
+	state.set_items(lookups);
+
+	while (state.run()) {
+		T sum = 0;
+
+		for (size_t i = 0; i < lookups; ++i) { sum += *a.lower_bound(k[i]); }
+
+		bench::do_not_optimize(sum);
+	}
+}
+
+template<typename T, size_t N>
+void sorted_lower_bound(bench::State& state) {
+	const T* data = table<T, N>();
+	const T* k = keys<T, N>();
+
+	state.set_items(lookups);
+
+	while (state.run()) {
+		T sum = 0;
+
+		for (size_t i = 0; i < lookups; ++i) { sum += *sstl::lower_bound(data, data + N, k[i]); }
+
+		bench::do_not_optimize(sum);
+	}
+}
+
+template<typename T, size_t N>
+void std_lower_bound(bench::State& state) {
+	const T* data = table<T, N>();
+	const T* k = keys<T, N>();
+
+	state.set_items(lookups);
+
+	while (state.run()) {
+		T sum = 0;
+
+		for (size_t i = 0; i < lookups; ++i) { sum += *std::lower_bound(data, data + N, k[i]); }
+
+		bench::do_not_optimize(sum);
+	}
+}
+
+/** The standard sizes, plus a table which no longer fits in the last level cache. */
+#define SEARCH_BENCHMARKS(impl, type, function) \
+	SSTL_BENCHMARK_SIZES("eytzinger_array.lower_bound", impl, type, function); \
+	SSTL_BENCHMARK("eytzinger_array.lower_bound", impl, type, 1 << 22, function<type, 1 << 22>)
+
+SEARCH_BENCHMARKS("sstl", uint32_t, sstl_lower_bound);
+SEARCH_BENCHMARKS("sorted_branchless", uint32_t, sorted_lower_bound);
+SEARCH_BENCHMARKS("std", uint32_t, std_lower_bound);
+
+} /* namespace */
@@ -0,0 +1,147 @@
+#include "bench.h"
+#include "types.h"
+
+#include <algorithm>
+#include <map>
+#include <random>
+
+#include "flat_map.h"
+
+using bench::Payload;
+
+namespace {
+
+/** Long-lived keys 0 .. N-1 in a fixed shuffled order, so neither building nor lookups walk them in sequence. */
+template<typename K, size_t N>
+const sstl::pair<K, int>* shuffled() {
+	static sstl::pair<K, int> data[N];
+	static bool ready = false;
+
+	if (!ready) {
+		static int order[N];
+
+		for (size_t i = 0; i < N; ++i) { order[i] = int(i); }
+
+		std::shuffle(order, order + N, std::mt19937(uint32_t(N)));
+
+		for (size_t i = 0; i < N; ++i) { data[i] = sstl::make_pair(K(order[i]), order[i]); }
+
+		ready = true;
+	}
+
+	return data;
+}
+
+template<typename K, size_t N>
+sstl::flat_map<K, int, N>& sstl_map() {
+	static sstl::flat_map<K, int, N> m;
+	return m;
+}
+
+template<typename K, size_t N>
+std::map<K, int>& std_map() {
+	static std::map<K, int> m;
+	return m;
+}
+
+/** The hand-rolled alternative: unsorted pairs scanned from the front. */
+template<typename K, size_t N>
+sstl::vector<sstl::pair<K, int>, N>& linear_map() {
+	static sstl::vector<sstl::pair<K, int>, N> v;
+	return v;
+}
+
+template<typename K, size_t N>
+void sstl_build(bench::State& state) {
+	const sstl::pair<K, int>* source = shuffled<K, N>();
+	sstl::flat_map<K, int, N>& m = sstl_map<K, N>();
+
+	while (state.run()) {
+		m.clear();
+		m.insert(source, source + N);
+		bench::do_not_optimize(m.values()[N - 1]);
+	}
+}
+
+template<typename K, size_t N>
+void sstl_single_build(bench::State& state) {
+	const sstl::pair<K, int>* source = shuffled<K, N>();
+	sstl::flat_map<K, int, N>& m = sstl_map<K, N>();
+
+	while (state.run()) {
+		m.clear();
+
+		for (size_t i = 0; i < N; ++i) { m.insert(source[i]); }
+
+		bench::do_not_optimize(m.values()[N - 1]);
+	}
+}
+
+template<typename K, size_t N>
+void std_build(bench::State& state) {
+	const sstl::pair<K, int>* source = shuffled<K, N>();
+	std::map<K, int>& m = std_map<K, N>();
+
+	while (state.run()) {
+		m.clear();
+
+		for (size_t i = 0; i < N; ++i) { m.insert(std::make_pair(source[i].first, source[i].second)); }
+
+		bench::do_not_optimize(m.size());
+	}
+}
+
+template<typename K, size_t N>
+void sstl_lookup(bench::State& state) {
+	const sstl::pair<K, int>* source = shuffled<K, N>();
+	sstl::flat_map<K, int, N>& m = sstl_map<K, N>();
+	m.clear();
+	m.insert(source, source + N);
+
+	while (state.run()) {
+		for (size_t i = 0; i < N; ++i) { bench::do_not_optimize(m.find(source[i].first)->second); }
+	}
+}
+
+template<typename K, size_t N>
+void std_lookup(bench::State& state) {
+	const sstl::pair<K, int>* source = shuffled<K, N>();
+	std::map<K, int>& m = std_map<K, N>();
+	m.clear();
+
+	for (size_t i = 0; i < N; ++i) { m.insert(std::make_pair(source[i].first, source[i].second)); }
+
+	while (state.run()) {
+		for (size_t i = 0; i < N; ++i) { bench::do_not_optimize(m.find(source[i].first)->second); }
+	}
+}
+
+template<typename K, size_t N>
+void linear_lookup(bench::State& state) {
+	const sstl::pair<K, int>* source = shuffled<K, N>();
+	sstl::vector<sstl::pair<K, int>, N>& v = linear_map<K, N>();
+	v.assign(source, source + N);
+
+	while (state.run()) {
+		for (size_t i = 0; i < N; ++i) {
+			const sstl::pair<K, int>* it = v.begin();
+
+			while (!(it->first == source[i].first)) { ++it; }
+
+			bench::do_not_optimize(it->second);
+		}
+	}
+}
+
+#define FLAT_MAP_BENCHMARKS(type) \
+	SSTL_BENCHMARK_SMALL_SIZES("flat_map.build", "sstl", type, sstl_build); \
+	SSTL_BENCHMARK_SMALL_SIZES("flat_map.build", "sstl_single", type, sstl_single_build); \
+	SSTL_BENCHMARK_SMALL_SIZES("flat_map.build", "std", type, std_build); \
+	SSTL_BENCHMARK_SMALL_SIZES("flat_map.lookup", "sstl", type, sstl_lookup); \
+	SSTL_BENCHMARK_SMALL_SIZES("flat_map.lookup", "std", type, std_lookup); \
+	SSTL_BENCHMARK_SMALL_SIZES("flat_map.lookup", "linear", type, linear_lookup)
+
+FLAT_MAP_BENCHMARKS(int);
+FLAT_MAP_BENCHMARKS(Payload);
+
+} /* namespace */
@@ -0,0 +1,3 @@
+#include "bench.h"
+
+int main(int argc, char** argv) { return bench::run_all(argc, argv); }
@@ -0,0 +1,129 @@
+#include "bench.h"
+#include "types.h"
+
+#include <atomic>
+#include <thread>
+#include <vector>
+
+#include "mpmc_queue.h"
+
+namespace {
+
+const size_t capacity = 1024;
+const size_t batch = 32;
+const size_t items = 1 << 16;
+
+/** sstl::mpmc_queue under the push/pop names shared with the baseline. */
+template<typename T>
+struct SstlQueue : public sstl::mpmc_queue<T, capacity> {
+	bool push(const T& value) { return this->try_push(value); }
+	size_t push(const T* values, size_t count) { return this->try_push(values, count); }
+	bool pop(T& value) { return this->try_pop(value); }
+	size_t pop(T* values, size_t count) { return this->try_pop(values, count); }
+};
+
+template<typename T>
+struct StdQueue : public bench::MutexQueue<T, capacity> {};
+
+/**
+	Streams a fixed number of items per sample through one shared queue, from
+	state.size() producer threads to as many consumer threads, each pinned to
+	its own CPU where there are enough of them.
+*/
+template<template<typename> class Queue, typename T, size_t Step>
+void contention(bench::State& state) {
+	static Queue<T> q;
+	const size_t threads = state.size();
+	const size_t share = items / threads;
+	std::atomic<size_t> generation(0);
+	std::atomic<size_t> consumed(0);
+	std::atomic<bool> stop(false);
+	std::vector<std::thread> workers;
+
+	state.set_items(share * threads);
+
+	for (size_t p = 0; p < threads; ++p) {
+		workers.push_back(std::thread([&] {
+			T values[batch];
+			size_t seen = 0;
+
+			for (;;) {
+				while (generation.load(std::memory_order_acquire) == seen && !stop.load()) {
+					std::this_thread::yield();
+				}
+
+				if (stop.load()) { return; }
+
+				++seen;
+
+				for (size_t sent = 0; sent < share;) {
+					const size_t pushed = Step == 1 ? size_t(q.push(T(int(sent)))) :
+					                      q.push(values, std::min(Step, share - sent));
+
+					if (!pushed) { std::this_thread::yield(); }
+
+					sent += pushed;
+				}
+			}
+		}));
+	}
+
+	for (size_t c = 0; c < threads; ++c) {
+		workers.push_back(std::thread([&] {
+			T values[batch];
+
+			while (!stop.load(std::memory_order_relaxed)) {
+				const size_t popped = Step == 1 ? size_t(q.pop(values[0])) : q.pop(values, Step);
+
+				if (popped) {
+					bench::do_not_optimize(values[0]);
+					consumed.fetch_add(popped, std::memory_order_release);
+				} else {
+					std::this_thread::yield();
+				}
+			}
+		}));
+	}
+
+	for (size_t i = 0; i < workers.size(); ++i) {
+		bench::pin(workers[i].native_handle(), unsigned(i));
+	}
+
+	size_t target = 0;
+
+	while (state.run()) {
+		target += share * threads;
+		generation.fetch_add(1, std::memory_order_release);
+
+		while (consumed.load(std::memory_order_acquire) != target) { std::this_thread::yield(); }
+	}
+
+	stop.store(true);
+
+	for (size_t i = 0; i < workers.size(); ++i) { workers[i].join(); }
+}
+
+/** Registers 1, 2, 4, ... producers and consumers, up to one thread per CPU. */
+bool register_contention() {
+	const size_t cpus = std::thread::hardware_concurrency();
+	const size_t most = cpus / 2 > 1 ? cpus / 2 : 1;
+
+	for (size_t threads = 1; threads <= most; threads = threads * 2 > most && threads != most ? most : threads * 2) {
+		bench::Registration("mpmc_queue.contention", "sstl", "int", threads,
+		                    contention<SstlQueue, int, 1>);
+		bench::Registration("mpmc_queue.contention", "sstl_bulk", "int", threads,
+		                    contention<SstlQueue, int, batch>);
+		bench::Registration("mpmc_queue.contention", "std", "int", threads,
+		                    contention<StdQueue, int, 1>);
+		bench::Registration("mpmc_queue.contention", "std_bulk", "int", threads,
+		                    contention<StdQueue, int, batch>);
+
+		if (threads == most) { break; }
+	}
+
+	return true;
+}
+
+const bool registered = register_contention();
+
+} /* namespace */
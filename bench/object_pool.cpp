@@ -0,0 +1,112 @@
+#include "bench.h"
+#include "types.h"
+
+#include <algorithm>
+#include <random>
+
+#include "object_pool.h"
+
+using bench::Payload;
+
+namespace {
+
+/** Long-lived indices 0 .. N-1 in a fixed shuffled order, so objects are freed out of allocation order. */
+template<size_t N>
+const size_t* shuffled() {
+	static size_t data[N];
+	static bool ready = false;
+
+	if (!ready) {
+		for (size_t i = 0; i < N; ++i) { data[i] = i; }
+
+		std::shuffle(data, data + N, std::mt19937(static_cast<uint32_t>(N)));
+		ready = true;
+	}
+
+	return data;
+}
+
+/** Replaces every object of a full pool, one at a time in shuffled order. */
+template<typename T, size_t N>
+void sstl_churn(bench::State& state) {
+	static sstl::object_pool<T, N> pool;
+	static T* objects[N];
+	const size_t* order = shuffled<N>();
+
+	for (size_t i = 0; i < N; ++i) { objects[i] = pool.construct(T(int(i))); }
+
+	state.set_items(N);
+
+	while (state.run()) {
+		for (size_t i = 0; i < N; ++i) {
+			pool.destroy(objects[order[i]]);
+			objects[order[i]] = pool.construct(T(int(i)));
+		}
+
+		bench::clobber_memory();
+	}
+
+	pool.clear();
+}
+
+template<typename T, size_t N>
+void heap_churn(bench::State& state) {
+	static T* objects[N];
+	const size_t* order = shuffled<N>();
+
+	for (size_t i = 0; i < N; ++i) { objects[i] = new T(int(i)); }
+
+	state.set_items(N);
+
+	while (state.run()) {
+		for (size_t i = 0; i < N; ++i) {
+			delete objects[order[i]];
+			objects[order[i]] = new T(int(i));
+		}
+
+		bench::clobber_memory();
+	}
+
+	for (size_t i = 0; i < N; ++i) { delete objects[i]; }
+}
+
+/** Fills the pool and drops all objects at once. */
+template<typename T, size_t N>
+void sstl_fill_clear(bench::State& state) {
+	static sstl::object_pool<T, N> pool;
+	state.set_items(N);
+
+	while (state.run()) {
+		for (size_t i = 0; i < N; ++i) { bench::do_not_optimize(pool.construct(T(int(i)))); }
+
+		pool.clear();
+		bench::clobber_memory();
+	}
+}
+
+template<typename T, size_t N>
+void heap_fill_clear(bench::State& state) {
+	static T* objects[N];
+	state.set_items(N);
+
+	while (state.run()) {
+		for (size_t i = 0; i < N; ++i) { objects[i] = new T(int(i)); }
+
+		bench::do_not_optimize(objects);
+
+		for (size_t i = 0; i < N; ++i) { delete objects[i]; }
+
+		bench::clobber_memory();
+	}
+}
+
+#define POOL_BENCHMARKS(group, function) \
+	SSTL_BENCHMARK_SIZES(group, "sstl", int, sstl_##function); \
+	SSTL_BENCHMARK_SIZES(group, "sstl", Payload, sstl_##function); \
+	SSTL_BENCHMARK_SIZES(group, "new", int, heap_##function); \
+	SSTL_BENCHMARK_SIZES(group, "new", Payload, heap_##function)
+
+POOL_BENCHMARKS("object_pool.churn", churn);
+POOL_BENCHMARKS("object_pool.fill_clear", fill_clear);
+
+} /* namespace */
@@ -0,0 +1,90 @@
+#include "bench.h"
+
+#include <queue>
+#include <random>
+#include <vector>
+
+#include "priority_queue.h"
+
+namespace {
+
+/** N random keys, as a scheduler would see deadlines arrive. */
+template<typename T, size_t N>
+const T* keys() {
+	static T data[N];
+	static bool ready = false;
+
+	if (!ready) {
+		std::mt19937 random(static_cast<uint32_t>(N));
+
+		for (size_t i = 0; i < N; ++i) { data[i] = T(random()); }
+
+		ready = true;
+	}
+
+	return data;
+}
+
+/** Pushes N keys, then pops them all. */
+template<typename T, size_t N, size_t Arity>
+void sstl_push_pop(bench::State& state) {
+	static sstl::priority_queue<T, N, sstl::less<T>, Arity> q;
+	const T* k = keys<T, N>();
+
+	state.set_items(2 * N);
+
+	while (state.run()) {
+		T sum = 0;
+
+		for (size_t i = 0; i < N; ++i) { q.push(k[i]); }
+
+		for (size_t i = 0; i < N; ++i) {
+			sum += q.top();
+			q.pop();
+		}
+
+		bench::do_not_optimize(sum);
+	}
+}
+
+template<typename T, size_t N>
+void sstl_binary_push_pop(bench::State& state) { sstl_push_pop<T, N, 2>(state); }
+
+template<typename T, size_t N>
+void sstl_4ary_push_pop(bench::State& state) { sstl_push_pop<T, N, 4>(state); }
+
+template<typename T, size_t N>
+void std_push_pop(bench::State& state) {
+	std::vector<T> storage;
+	storage.reserve(N);
+	std::priority_queue<T> q(std::less<T>(), storage);
+	const T* k = keys<T, N>();
+
+	state.set_items(2 * N);
+
+	while (state.run()) {
+		T sum = 0;
+
+		for (size_t i = 0; i < N; ++i) { q.push(k[i]); }
+
+		for (size_t i = 0; i < N; ++i) {
+			sum += q.top();
+			q.pop();
+		}
+
+		bench::do_not_optimize(sum);
+	}
+}
+
+/** Sizes from 1K to 64K elements. */
+#define QUEUE_BENCHMARKS(impl, type, function) \
+	SSTL_BENCHMARK("priority_queue.push_pop", impl, type, 1024, function<type, 1024>); \
+	SSTL_BENCHMARK("priority_queue.push_pop", impl, type, 4096, function<type, 4096>); \
+	SSTL_BENCHMARK("priority_queue.push_pop", impl, type, 16384, function<type, 16384>); \
+	SSTL_BENCHMARK("priority_queue.push_pop", impl, type, 65536, function<type, 65536>)
+
+QUEUE_BENCHMARKS("sstl", uint32_t, sstl_4ary_push_pop);
+QUEUE_BENCHMARKS("sstl_binary", uint32_t, sstl_binary_push_pop);
+QUEUE_BENCHMARKS("std", uint32_t, std_push_pop);
+
+} /* namespace */
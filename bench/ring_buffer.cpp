@@ -0,0 +1,74 @@
+#include "bench.h"
+#include "types.h"
+
+using bench::Payload;
+
+namespace {
+
+/** Benchmarks written once against the common subset of sstl::ring_buffer and std::deque. */
+template<template<typename, size_t> class Queue>
+struct QueueBench {
+	/** Fills the queue then drains it from the front. */
+	template<typename T, size_t N>
+	static void fill_drain(bench::State& state) {
+		while (state.run()) {
+			typename Queue<T, N>::type& q = Queue<T, N>::get();
+
+			for (size_t i = 0; i < N; ++i) { q.push_back(T(int(i))); }
+
+			while (!q.empty()) {
+				bench::do_not_optimize(q.front());
+				q.pop_front();
+			}
+		}
+	}
+
+	/** Keeps the queue half full, pushing and popping N elements across the wrap point. */
+	template<typename T, size_t N>
+	static void steady(bench::State& state) {
+		typename Queue<T, N>::type& q = Queue<T, N>::get();
+
+		for (size_t i = 0; i < N / 2; ++i) { q.push_back(T(int(i))); }
+
+		while (state.run()) {
+			for (size_t i = 0; i < N; ++i) {
+				q.push_back(T(int(i)));
+				bench::do_not_optimize(q.front());
+				q.pop_front();
+			}
+		}
+	}
+
+	/** Reads every element through iterators after the contents have wrapped. */
+	template<typename T, size_t N>
+	static void iterate(bench::State& state) {
+		typename Queue<T, N>::type& q = Queue<T, N>::get();
+
+		for (size_t i = 0; i < N / 2; ++i) { q.push_back(T(int(i))); q.pop_front(); }
+
+		for (size_t i = 0; i < N; ++i) { q.push_back(T(int(i))); }
+
+		while (state.run()) {
+			for (typename Queue<T, N>::type::const_iterator it = q.begin(); it != q.end(); ++it) {
+				bench::do_not_optimize(*it);
+			}
+		}
+	}
+};
+
+typedef QueueBench<bench::SstlRingBuffer> Sstl;
+typedef QueueBench<bench::StdDeque>       Std;
+
+#define RING_BUFFER_BENCHMARKS(type) \
+	SSTL_BENCHMARK_SIZES("ring_buffer.fill_drain", "sstl", type, Sstl::fill_drain); \
+	SSTL_BENCHMARK_SIZES("ring_buffer.fill_drain", "std", type, Std::fill_drain); \
+	SSTL_BENCHMARK_SIZES("ring_buffer.steady", "sstl", type, Sstl::steady); \
+	SSTL_BENCHMARK_SIZES("ring_buffer.steady", "std", type, Std::steady); \
+	SSTL_BENCHMARK_SIZES("ring_buffer.iterate", "sstl", type, Sstl::iterate); \
+	SSTL_BENCHMARK_SIZES("ring_buffer.iterate", "std", type, Std::iterate)
+
+RING_BUFFER_BENCHMARKS(uint8_t);
+RING_BUFFER_BENCHMARKS(int);
+RING_BUFFER_BENCHMARKS(Payload);
+
+} /* namespace */
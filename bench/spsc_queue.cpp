@@ -0,0 +1,145 @@
+#include "bench.h"
+#include "types.h"
+
+#include <atomic>
+#include <thread>
+
+#include "spsc_queue.h"
+
+using bench::Payload;
+
+namespace {
+
+const size_t capacity = 1024;
+const size_t batch = 32;
+
+template<typename T>
+struct SstlQueue { typedef sstl::spsc_queue<T, capacity> type; };
+template<typename T>
+struct StdQueue { typedef bench::MutexQueue<T, capacity> type; };
+
+/** Pushes every element one at a time, or in batches, waiting for space. */
+template<class Queue, typename T>
+void produce(Queue& q, size_t count, size_t step) {
+	static T values[batch];
+
+	for (size_t sent = 0; sent < count;) {
+		size_t pushed = 0;
+
+		if (step == 1) {
+			pushed = q.push(T(int(sent))) ? 1 : 0;
+		} else {
+			pushed = q.push(values, std::min(step, count - sent));
+		}
+
+		if (!pushed) { std::this_thread::yield(); }
+
+		sent += pushed;
+	}
+}
+
+/** Streams size elements per sample from the benchmark thread to a consumer on another CPU. */
+template<template<typename> class Queue, typename T, size_t N, size_t Step>
+void throughput(bench::State& state) {
+	bench::PinnedThread producer;
+	static typename Queue<T>::type q;
+	std::atomic<size_t> consumed(0);
+	std::atomic<bool> stop(false);
+
+	std::thread consumer([&] {
+		T values[batch];
+
+		while (!stop.load(std::memory_order_relaxed)) {
+			size_t popped = 0;
+
+			if (Step == 1) {
+				popped = q.pop(values[0]) ? 1 : 0;
+			} else {
+				popped = q.pop(values, Step);
+			}
+
+			if (popped) {
+				bench::do_not_optimize(values[0]);
+				consumed.fetch_add(popped, std::memory_order_release);
+			} else {
+				std::this_thread::yield();
+			}
+		}
+	});
+	bench::pin(consumer.native_handle(), 1);
+
+	size_t target = 0;
+
+	while (state.run()) {
+		produce<typename Queue<T>::type, T>(q, N, Step);
+		target += N;
+
+		while (consumed.load(std::memory_order_acquire) != target) { std::this_thread::yield(); }
+	}
+
+	stop.store(true);
+	consumer.join();
+}
+
+/** Sends size values one at a time to an echo thread on another CPU, waiting for each reply. */
+template<template<typename> class Queue, typename T, size_t N>
+void latency(bench::State& state) {
+	bench::PinnedThread producer;
+	static typename Queue<T>::type request;
+	static typename Queue<T>::type reply;
+	std::atomic<bool> stop(false);
+
+	std::thread echo([&] {
+		T value;
+
+		while (!stop.load(std::memory_order_relaxed)) {
+			if (request.pop(value)) {
+				while (!reply.push(value)) { std::this_thread::yield(); }
+			} else {
+				std::this_thread::yield();
+			}
+		}
+	});
+	bench::pin(echo.native_handle(), 1);
+
+	while (state.run()) {
+		T value;
+
+		for (size_t i = 0; i < N; ++i) {
+			while (!request.push(T(int(i)))) { std::this_thread::yield(); }
+
+			while (!reply.pop(value)) { std::this_thread::yield(); }
+		}
+
+		bench::do_not_optimize(value);
+	}
+
+	stop.store(true);
+	echo.join();
+}
+
+template<typename T, size_t N>
+void sstl_throughput(bench::State& state) { throughput<SstlQueue, T, N, 1>(state); }
+template<typename T, size_t N>
+void sstl_bulk_throughput(bench::State& state) { throughput<SstlQueue, T, N, batch>(state); }
+template<typename T, size_t N>
+void std_throughput(bench::State& state) { throughput<StdQueue, T, N, 1>(state); }
+template<typename T, size_t N>
+void std_bulk_throughput(bench::State& state) { throughput<StdQueue, T, N, batch>(state); }
+template<typename T, size_t N>
+void sstl_latency(bench::State& state) { latency<SstlQueue, T, N>(state); }
+template<typename T, size_t N>
+void std_latency(bench::State& state) { latency<StdQueue, T, N>(state); }
+
+#define SPSC_QUEUE_BENCHMARKS(type) \
+	SSTL_BENCHMARK_SIZES("spsc_queue.throughput", "sstl", type, sstl_throughput); \
+	SSTL_BENCHMARK_SIZES("spsc_queue.throughput", "sstl_bulk", type, sstl_bulk_throughput); \
+	SSTL_BENCHMARK_SIZES("spsc_queue.throughput", "std", type, std_throughput); \
+	SSTL_BENCHMARK_SIZES("spsc_queue.throughput", "std_bulk", type, std_bulk_throughput); \
+	SSTL_BENCHMARK_SMALL_SIZES("spsc_queue.latency", "sstl", type, sstl_latency); \
+	SSTL_BENCHMARK_SMALL_SIZES("spsc_queue.latency", "std", type, std_latency)
+
+SPSC_QUEUE_BENCHMARKS(int);
+SPSC_QUEUE_BENCHMARKS(Payload);
+
+} /* namespace */
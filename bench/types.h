@@ -0,0 +1,195 @@
+/**
+    @brief  Element types and container adapters shared by the benchmarks.
+*/
+
+#ifndef STATIC_STL_BENCH_TYPES_H_
+#define STATIC_STL_BENCH_TYPES_H_
+
+#include <pthread.h>
+#include <sched.h>
+#include <stdint.h>
+
+#include <algorithm>
+#include <array>
+#include <deque>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+#include "array.h"
+#include "ring_buffer.h"
+#include "vector.h"
+
+namespace bench {
+
+/** 32 byte trivially copyable payload, standing in for a small record. */
+struct Payload {
+	Payload(int v = 0) { for (int i = 0; i < 8; ++i) { words[i] = uint32_t(v + i); } }
+
+	bool operator==(const Payload& rhs) const {
+		for (int i = 0; i < 8; ++i) { if (words[i] != rhs.words[i]) { return false; } }
+
+		return true;
+	}
+	bool operator<(const Payload& rhs) const {
+		for (int i = 0; i < 8; ++i) {
+			if (words[i] != rhs.words[i]) { return words[i] < rhs.words[i]; }
+		}
+
+		return false;
+	}
+
+	uint32_t words[8];
+};
+
+/** Long-lived sstl::vector, emptied before it is handed out. */
+template<typename T, size_t N>
+struct SstlVector {
+	typedef sstl::vector<T, N> type;
+
+	static type& get() {
+		static type v;
+		v.clear();
+		return v;
+	}
+};
+
+/** Long-lived std::vector with capacity for N, emptied before it is handed out. */
+template<typename T, size_t N>
+struct StdVector {
+	typedef std::vector<T> type;
+
+	static type& get() {
+		static type v;
+		v.clear();
+		v.reserve(N);
+		return v;
+	}
+};
+
+/** Long-lived sstl::ring_buffer, emptied before it is handed out. */
+template<typename T, size_t N>
+struct SstlRingBuffer {
+	typedef sstl::ring_buffer<T, N> type;
+
+	static type& get() {
+		static type q;
+		q.clear();
+		return q;
+	}
+};
+
+/** Long-lived std::deque, emptied before it is handed out. */
+template<typename T, size_t N>
+struct StdDeque {
+	typedef std::deque<T> type;
+
+	static type& get() {
+		static type q;
+		q.clear();
+		return q;
+	}
+};
+
+/** Pair of long-lived sstl::arrays. */
+template<typename T, size_t N>
+struct SstlArray {
+	typedef sstl::array<T, N> type;
+
+	static type& get(int which) {
+		static type a[2];
+		return a[which];
+	}
+};
+
+/** Pair of long-lived std::arrays. */
+template<typename T, size_t N>
+struct StdArray {
+	typedef std::array<T, N> type;
+
+	static type& get(int which) {
+		static type a[2];
+		return a[which];
+	}
+};
+
+/** Baseline bounded queue for the concurrent benchmarks, a std::deque guarded by a mutex. */
+template<typename T, size_t Capacity>
+class MutexQueue {
+  public:
+	bool push(const T& value) {
+		std::lock_guard<std::mutex> lock(mutex_);
+
+		if (queue_.size() == Capacity) { return false; }
+
+		queue_.push_back(value);
+		return true;
+	}
+	size_t push(const T* values, size_t count) {
+		std::lock_guard<std::mutex> lock(mutex_);
+		count = std::min(count, Capacity - queue_.size());
+		queue_.insert(queue_.end(), values, values + count);
+		return count;
+	}
+	bool pop(T& value) {
+		std::lock_guard<std::mutex> lock(mutex_);
+
+		if (queue_.empty()) { return false; }
+
+		value = queue_.front();
+		queue_.pop_front();
+		return true;
+	}
+	size_t pop(T* values, size_t count) {
+		std::lock_guard<std::mutex> lock(mutex_);
+		count = std::min(count, queue_.size());
+		std::copy(queue_.begin(), queue_.begin() + count, values);
+		queue_.erase(queue_.begin(), queue_.begin() + count);
+		return count;
+	}
+
+  private:
+	std::mutex mutex_;
+	std::deque<T> queue_;
+};
+
+/** Pins thread to a CPU, wrapping around on machines with fewer CPUs. */
+inline void pin(pthread_t thread, unsigned cpu) {
+	const unsigned cpus = std::thread::hardware_concurrency();
+	cpu_set_t set;
+	CPU_ZERO(&set);
+	CPU_SET(cpus ? cpu % cpus : 0, &set);
+	pthread_setaffinity_np(thread, sizeof(set), &set);
+}
+
+/** Pins the benchmark thread to CPU 0 for its lifetime, restoring the previous affinity. */
+class PinnedThread {
+  public:
+	PinnedThread() {
+		pthread_getaffinity_np(pthread_self(), sizeof(saved_), &saved_);
+		pin(pthread_self(), 0);
+	}
+	~PinnedThread() { pthread_setaffinity_np(pthread_self(), sizeof(saved_), &saved_); }
+
+  private:
+	cpu_set_t saved_;
+};
+
+/** Long-lived source data with distinct values 0 .. N-1. */
+template<typename T, size_t N>
+const T* source() {
+	static T data[N];
+	static bool ready = false;
+
+	if (!ready) {
+		for (size_t i = 0; i < N; ++i) { data[i] = T(int(i)); }
+
+		ready = true;
+	}
+
+	return data;
+}
+
+} /* namespace bench */
+
+#endif /* STATIC_STL_BENCH_TYPES_H_ */
@@ -0,0 +1,144 @@
+#include "bench.h"
+#include "types.h"
+
+#include <algorithm>
+#include <random>
+#include <unordered_map>
+
+#include "unordered_map.h"
+
+using bench::Payload;
+
+namespace {
+
+/** Hash shared by both maps, the identity on the first word like the standard int hash. */
+struct Hash {
+	size_t operator()(int key) const { return size_t(key); }
+	size_t operator()(const Payload& key) const { return size_t(key.words[0]); }
+};
+
+/** Long-lived keys 0 .. N-1 in a fixed shuffled order, so neither inserts nor lookups walk them in sequence. */
+template<typename K, size_t N>
+const sstl::pair<K, int>* shuffled() {
+	static sstl::pair<K, int> data[N];
+	static bool ready = false;
+
+	if (!ready) {
+		static int order[N];
+
+		for (size_t i = 0; i < N; ++i) { order[i] = int(i); }
+
+		std::shuffle(order, order + N, std::mt19937(uint32_t(N)));
+
+		for (size_t i = 0; i < N; ++i) { data[i] = sstl::make_pair(K(order[i]), order[i]); }
+
+		ready = true;
+	}
+
+	return data;
+}
+
+template<typename K, size_t N>
+sstl::unordered_map<K, int, N, Hash>& sstl_map() {
+	static sstl::unordered_map<K, int, N, Hash> m;
+	return m;
+}
+
+/** The std map keeps its buckets for N keys across clear(), so only node allocation is measured. */
+template<typename K, size_t N>
+std::unordered_map<K, int, Hash>& std_map() {
+	static std::unordered_map<K, int, Hash> m(N);
+	return m;
+}
+
+template<typename K, size_t N>
+void sstl_insert(bench::State& state) {
+	const sstl::pair<K, int>* source = shuffled<K, N>();
+	sstl::unordered_map<K, int, N, Hash>& m = sstl_map<K, N>();
+
+	while (state.run()) {
+		m.clear();
+
+		for (size_t i = 0; i < N; ++i) { m.insert(source[i]); }
+
+		bench::do_not_optimize(m.size());
+	}
+}
+
+template<typename K, size_t N>
+void std_insert(bench::State& state) {
+	const sstl::pair<K, int>* source = shuffled<K, N>();
+	std::unordered_map<K, int, Hash>& m = std_map<K, N>();
+
+	while (state.run()) {
+		m.clear();
+
+		for (size_t i = 0; i < N; ++i) { m.insert(std::make_pair(source[i].first, source[i].second)); }
+
+		bench::do_not_optimize(m.size());
+	}
+}
+
+template<typename K, size_t N>
+void sstl_lookup(bench::State& state) {
+	const sstl::pair<K, int>* source = shuffled<K, N>();
+	sstl::unordered_map<K, int, N, Hash>& m = sstl_map<K, N>();
+	m.clear();
+	m.insert(source, source + N);
+
+	while (state.run()) {
+		for (size_t i = 0; i < N; ++i) { bench::do_not_optimize(m.find(source[i].first)->second); }
+	}
+}
+
+template<typename K, size_t N>
+void std_lookup(bench::State& state) {
+	const sstl::pair<K, int>* source = shuffled<K, N>();
+	std::unordered_map<K, int, Hash>& m = std_map<K, N>();
+	m.clear();
+
+	for (size_t i = 0; i < N; ++i) { m.insert(std::make_pair(source[i].first, source[i].second)); }
+
+	while (state.run()) {
+		for (size_t i = 0; i < N; ++i) { bench::do_not_optimize(m.find(source[i].first)->second); }
+	}
+}
+
+/** Lookups of keys N .. 2N-1, none of which are present. */
+template<typename K, size_t N>
+void sstl_miss(bench::State& state) {
+	const sstl::pair<K, int>* source = shuffled<K, N>();
+	sstl::unordered_map<K, int, N, Hash>& m = sstl_map<K, N>();
+	m.clear();
+	m.insert(source, source + N);
+
+	while (state.run()) {
+		for (size_t i = 0; i < N; ++i) { bench::do_not_optimize(m.contains(K(int(N) + source[i].second))); }
+	}
+}
+
+template<typename K, size_t N>
+void std_miss(bench::State& state) {
+	const sstl::pair<K, int>* source = shuffled<K, N>();
+	std::unordered_map<K, int, Hash>& m = std_map<K, N>();
+	m.clear();
+
+	for (size_t i = 0; i < N; ++i) { m.insert(std::make_pair(source[i].first, source[i].second)); }
+
+	while (state.run()) {
+		for (size_t i = 0; i < N; ++i) { bench::do_not_optimize(m.count(K(int(N) + source[i].second))); }
+	}
+}
+
+#define UNORDERED_MAP_BENCHMARKS(type) \
+	SSTL_BENCHMARK_SIZES("unordered_map.insert", "sstl", type, sstl_insert); \
+	SSTL_BENCHMARK_SIZES("unordered_map.insert", "std", type, std_insert); \
+	SSTL_BENCHMARK_SIZES("unordered_map.lookup", "sstl", type, sstl_lookup); \
+	SSTL_BENCHMARK_SIZES("unordered_map.lookup", "std", type, std_lookup); \
+	SSTL_BENCHMARK_SIZES("unordered_map.miss", "sstl", type, sstl_miss); \
+	SSTL_BENCHMARK_SIZES("unordered_map.miss", "std", type, std_miss)
+
+UNORDERED_MAP_BENCHMARKS(int);
+UNORDERED_MAP_BENCHMARKS(Payload);
+
+} /* namespace */
@@ -0,0 +1,145 @@
+#include "bench.h"
+#include "types.h"
+
+using bench::Payload;
+
+namespace {
+
+/** Benchmarks written once against the common subset of sstl::vector and std::vector. */
+template<template<typename, size_t> class Vector>
+struct VectorBench {
+	template<typename T, size_t N>
+	static void push_back(bench::State& state) {
+		while (state.run()) {
+			typename Vector<T, N>::type& v = Vector<T, N>::get();
+
+			for (size_t i = 0; i < N; ++i) { v.push_back(T(int(i))); }
+
+			bench::do_not_optimize(v.back());
+		}
+	}
+
+	template<typename T, size_t N>
+	static void insert_front(bench::State& state) {
+		while (state.run()) {
+			typename Vector<T, N>::type& v = Vector<T, N>::get();
+
+			for (size_t i = 0; i < N; ++i) { v.insert(v.begin(), T(int(i))); }
+
+			bench::do_not_optimize(v.back());
+		}
+	}
+
+	template<typename T, size_t N>
+	static void insert_middle(bench::State& state) {
+		while (state.run()) {
+			typename Vector<T, N>::type& v = Vector<T, N>::get();
+
+			for (size_t i = 0; i < N; ++i) {
+				v.insert(v.begin() + v.size() / 2, T(int(i)));
+			}
+
+			bench::do_not_optimize(v.back());
+		}
+	}
+
+	template<typename T, size_t N>
+	static void insert_back(bench::State& state) {
+		while (state.run()) {
+			typename Vector<T, N>::type& v = Vector<T, N>::get();
+
+			for (size_t i = 0; i < N; ++i) { v.insert(v.end(), T(int(i))); }
+
+			bench::do_not_optimize(v.back());
+		}
+	}
+
+	template<typename T, size_t N>
+	static void erase_front(bench::State& state) {
+		while (state.run()) {
+			state.pause_timing();
+			typename Vector<T, N>::type& v = Vector<T, N>::get();
+			v.assign(bench::source<T, N>(), bench::source<T, N>() + N);
+			state.resume_timing();
+
+			while (!v.empty()) { v.erase(v.begin()); }
+
+			bench::do_not_optimize(v.size());
+		}
+	}
+
+	template<typename T, size_t N>
+	static void erase_middle(bench::State& state) {
+		while (state.run()) {
+			state.pause_timing();
+			typename Vector<T, N>::type& v = Vector<T, N>::get();
+			v.assign(bench::source<T, N>(), bench::source<T, N>() + N);
+			state.resume_timing();
+
+			while (!v.empty()) { v.erase(v.begin() + v.size() / 2); }
+
+			bench::do_not_optimize(v.size());
+		}
+	}
+
+	template<typename T, size_t N>
+	static void erase_back(bench::State& state) {
+		while (state.run()) {
+			state.pause_timing();
+			typename Vector<T, N>::type& v = Vector<T, N>::get();
+			v.assign(bench::source<T, N>(), bench::source<T, N>() + N);
+			state.resume_timing();
+
+			while (!v.empty()) { v.erase(v.end() - 1); }
+
+			bench::do_not_optimize(v.size());
+		}
+	}
+
+	template<typename T, size_t N>
+	static void assign(bench::State& state) {
+		while (state.run()) {
+			typename Vector<T, N>::type& v = Vector<T, N>::get();
+			v.assign(bench::source<T, N>(), bench::source<T, N>() + N);
+			bench::do_not_optimize(v.back());
+		}
+	}
+
+	template<typename T, size_t N>
+	static void compare(bench::State& state) {
+		typename Vector<T, N>::type& a = Vector<T, N>::get();
+		a.assign(bench::source<T, N>(), bench::source<T, N>() + N);
+		typename Vector<T, N>::type b(a);
+
+		while (state.run()) { bench::do_not_optimize(a < b); }
+	}
+};
+
+typedef VectorBench<bench::SstlVector> Sstl;
+typedef VectorBench<bench::StdVector>  Std;
+
+#define VECTOR_BENCHMARKS(type) \
+	SSTL_BENCHMARK_SIZES("vector.push_back", "sstl", type, Sstl::push_back); \
+	SSTL_BENCHMARK_SIZES("vector.push_back", "std", type, Std::push_back); \
+	SSTL_BENCHMARK_SMALL_SIZES("vector.insert_front", "sstl", type, Sstl::insert_front); \
+	SSTL_BENCHMARK_SMALL_SIZES("vector.insert_front", "std", type, Std::insert_front); \
+	SSTL_BENCHMARK_SMALL_SIZES("vector.insert_middle", "sstl", type, Sstl::insert_middle); \
+	SSTL_BENCHMARK_SMALL_SIZES("vector.insert_middle", "std", type, Std::insert_middle); \
+	SSTL_BENCHMARK_SIZES("vector.insert_back", "sstl", type, Sstl::insert_back); \
+	SSTL_BENCHMARK_SIZES("vector.insert_back", "std", type, Std::insert_back); \
+	SSTL_BENCHMARK_SMALL_SIZES("vector.erase_front", "sstl", type, Sstl::erase_front); \
+	SSTL_BENCHMARK_SMALL_SIZES("vector.erase_front", "std", type, Std::erase_front); \
+	SSTL_BENCHMARK_SMALL_SIZES("vector.erase_middle", "sstl", type, Sstl::erase_middle); \
+	SSTL_BENCHMARK_SMALL_SIZES("vector.erase_middle", "std", type, Std::erase_middle); \
+	SSTL_BENCHMARK_SIZES("vector.erase_back", "sstl", type, Sstl::erase_back); \
+	SSTL_BENCHMARK_SIZES("vector.erase_back", "std", type, Std::erase_back); \
+	SSTL_BENCHMARK_SIZES("vector.assign", "sstl", type, Sstl::assign); \
+	SSTL_BENCHMARK_SIZES("vector.assign", "std", type, Std::assign); \
+	SSTL_BENCHMARK_SIZES("vector.lexicographical_compare", "sstl", type, Sstl::compare); \
+	SSTL_BENCHMARK_SIZES("vector.lexicographical_compare", "std", type, Std::compare)
+
+VECTOR_BENCHMARKS(uint8_t);
+VECTOR_BENCHMARKS(int);
+VECTOR_BENCHMARKS(Payload);
+
+} /* namespace */
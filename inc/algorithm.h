@@ -1,16 +1,118 @@
 #ifndef STATIC_STL_ALGORITHM_H_
 #define STATIC_STL_ALGORITHM_H_
 
+#include <string.h>
+
+#include "functional.h"
 #include "iterator.h"
+#include "type_traits.h"
+#include "utility.h"
+
+#if SSTL_HAS_SSE2
+#include <emmintrin.h>
+#endif
 
 namespace sstl {
 
+namespace detail {
+/** Checks whether a range of InputIt can be block copied into OutputIt with memmove. */
+template<class InputIt, class OutputIt>
+struct is_memmovable : public false_type {};
+
+template<typename T, typename U>
+struct is_memmovable<T*, U*> :
+	public integral_constant < bool,
+	is_same<typename remove_const<T>::type, U>::value &&
+	is_trivially_copyable<U>::value && !is_volatile<U>::value > {};
+
+/** Checks whether a range of ForwardIt can be block filled with memset. */
+template<class ForwardIt>
+struct is_memsettable : public false_type {};
+
+template<typename T>
+struct is_memsettable<T*> :
+	public integral_constant < bool,
+	is_bitwise_fillable<T>::value && !is_const<T>::value > {};
+
+/**
+	Checks whether ranges of InputIt1 and InputIt2 are equal exactly when
+	their bytes are, so memcmp can compare them: both point to the same
+	integral type, which has no padding bits and a single representation
+	of each value.
+*/
+template<class InputIt1, class InputIt2>
+struct is_memcomparable : public false_type {};
+
+template<typename T, typename U>
+struct is_memcomparable<T*, U*> :
+	public integral_constant < bool,
+	is_same<typename remove_cv<T>::type, typename remove_cv<U>::type>::value &&
+	sstl::is_integral<T>::value && !is_volatile<T>::value && !is_volatile<U>::value > {};
+
+/**
+	Returns the index of the first byte in which the count bytes of a and b
+	differ, or count. Eight bytes are compared at a time, and where the byte
+	order is known the differing byte is located from the bits of the word.
+*/
+inline size_t mismatch_bytes(const unsigned char* a, const unsigned char* b, size_t count) {
+	size_t i = 0;
+
+	for (; count - i >= sizeof(uint64_t); i += sizeof(uint64_t)) {
+		uint64_t wa;
+		uint64_t wb;
+		memcpy(&wa, a + i, sizeof(wa));
+		memcpy(&wb, b + i, sizeof(wb));
+
+		if (const uint64_t diff = wa ^ wb) {
+#if defined(__BYTE_ORDER__) && __BYTE_ORDER__ == __ORDER_LITTLE_ENDIAN__
+			return i + lowest_bit(diff) / 8;
+#elif defined(__BYTE_ORDER__) && __BYTE_ORDER__ == __ORDER_BIG_ENDIAN__
+			return i + (63 - highest_bit(diff)) / 8;
+#else
+			static_cast<void>(diff);
+			break;
+#endif
+		}
+	}
+
+	while (i < count && a[i] == b[i]) { ++i; }
+
+	return i;
+}
+
+/** Exchanges count bytes between two non-overlapping memory areas. */
+inline void swap_bytes(void* a, void* b, size_t count) {
+	unsigned char* pa = static_cast<unsigned char*>(a);
+	unsigned char* pb = static_cast<unsigned char*>(b);
+	unsigned char tmp[64];
+
+	while (count) {
+		const size_t chunk = count < sizeof(tmp) ? count : sizeof(tmp);
+		memcpy(tmp, pa, chunk);
+		memcpy(pa, pb, chunk);
+		memcpy(pb, tmp, chunk);
+		pa += chunk;
+		pb += chunk;
+		count -= chunk;
+	}
+}
+
+/** Returns the single byte representation of val once converted to T. */
+template<typename T, typename V>
+inline int fill_byte(const V& val) {
+	const T tmp = val;
+	unsigned char byte;
+	memcpy(&byte, &tmp, 1);
+	return byte;
+}
+} /* namespace detail */
+
 /** Exchanges the given values. */
 template<typename T>
 inline void swap(T& a, T& b) {
-	T tmp(a);
-	a = b;
-	b = tmp;
+	T tmp(sstl::move(a));
+	a = sstl::move(b);
+	b = sstl::move(tmp);
 }
 
 /** Swaps the values of the elements the given iterators are pointing to. */
@@ -19,137 +121,1987 @@ inline void iter_swap(ForwardIt1 a, ForwardIt2 b) {
 	swap(*a, *b);
 }
 
-/** Exchanges elements between range [first1, last1] and another range starting at first2. */
+namespace detail {
 template<class ForwardIt1, class ForwardIt2>
-inline ForwardIt2 swap_ranges(ForwardIt1 first1, ForwardIt1 last1,
-                              ForwardIt2 first2) {
-	for (; first1 != last1; ++first1, ++first2) { iter_swap(first1, first2); }
+inline ForwardIt2 swap_ranges_dispatch(ForwardIt1 first1, ForwardIt1 last1,
+                                       ForwardIt2 first2, false_type) {
+	for (; first1 != last1; ++first1, ++first2) { sstl::iter_swap(first1, first2); }
 
 	return first2;
 }
+template<typename T>
+inline T* swap_ranges_dispatch(T* first1, T* last1, T* first2, true_type) {
+	const size_t count = static_cast<size_t>(last1 - first1);
+	swap_bytes(first1, first2, count * sizeof(T));
+	return first2 + count;
+}
 
-/** Assigns the given value to the elements in the range [first, last]. */
 template<class ForwardIt, typename T>
-inline void fill(ForwardIt first, ForwardIt last, const T& val) {
+SSTL_CONSTEXPR14 inline void fill_dispatch(ForwardIt first, ForwardIt last, const T& val,
+                                           false_type) {
 	for (; first != last; ++first) { *first = val; }
 }
+template<typename U, typename T>
+SSTL_CONSTEXPR14 inline void fill_dispatch(U* first, U* last, const T& val, true_type) {
+	if (SSTL_IS_CONSTANT_EVALUATED()) {
+		fill_dispatch(first, last, val, false_type());
+	} else if (first != last) {
+		memset(first, fill_byte<U>(val), static_cast<size_t>(last - first));
+	}
+}
 
-/** Assigns the given value to the first len elements in the range beginning at first if len > 0. */
 template<class OutputIt, class Size, typename T>
-inline OutputIt fill_n(OutputIt first, Size len, const T& val) {
-	for (; len; --len, ++first) { *first = val; }
+SSTL_CONSTEXPR14 inline OutputIt fill_n_dispatch(OutputIt first, Size len, const T& val,
+                                                 false_type) {
+	for (; len > 0; --len, ++first) { *first = val; }
+
+	return first;
+}
+template<typename U, class Size, typename T>
+SSTL_CONSTEXPR14 inline U* fill_n_dispatch(U* first, Size len, const T& val, true_type) {
+	if (SSTL_IS_CONSTANT_EVALUATED()) {
+		return fill_n_dispatch(first, len, val, false_type());
+	}
+
+	if (len > 0) {
+		memset(first, fill_byte<U>(val), static_cast<size_t>(len));
+		first += len;
+	}
 
 	return first;
 }
 
-/** Copies the elements in the range, defined by [first, last], to another range beginning at dest. */
 template<class InputIt, class OutputIt>
-inline void copy(InputIt first, InputIt last, OutputIt dest) {
+SSTL_CONSTEXPR14 inline OutputIt copy_dispatch(InputIt first, InputIt last, OutputIt dest,
+                                               false_type) {
 	for (; first != last; ++first, ++dest) { *dest = *first; }
+
+	return dest;
+}
+template<typename T, typename U>
+SSTL_CONSTEXPR14 inline U* copy_dispatch(T* first, T* last, U* dest, true_type) {
+	if (SSTL_IS_CONSTANT_EVALUATED()) {
+		return copy_dispatch(first, last, dest, false_type());
+	}
+
+	const size_t count = static_cast<size_t>(last - first);
+
+	if (count) { memmove(dest, first, count * sizeof(U)); }
+
+	return dest + count;
+}
+
+template<class BidirIt1, class BidirIt2>
+SSTL_CONSTEXPR14 inline BidirIt2 copy_backward_dispatch(BidirIt1 first, BidirIt1 last,
+                                                        BidirIt2 d_last, false_type) {
+	while (first != last) { *--d_last = *--last; }
+
+	return d_last;
+}
+template<typename T, typename U>
+SSTL_CONSTEXPR14 inline U* copy_backward_dispatch(T* first, T* last, U* d_last, true_type) {
+	if (SSTL_IS_CONSTANT_EVALUATED()) {
+		return copy_backward_dispatch(first, last, d_last, false_type());
+	}
+
+	const size_t count = static_cast<size_t>(last - first);
+	d_last -= count;
+
+	if (count) { memmove(d_last, first, count * sizeof(U)); }
+
+	return d_last;
+}
+
+template<class InputIt, class OutputIt>
+SSTL_CONSTEXPR14 inline OutputIt move_dispatch(InputIt first, InputIt last, OutputIt dest,
+                                               false_type) {
+	for (; first != last; ++first, ++dest) { *dest = sstl::move(*first); }
+
+	return dest;
+}
+template<class InputIt, class OutputIt>
+SSTL_CONSTEXPR14 inline OutputIt move_dispatch(InputIt first, InputIt last, OutputIt dest,
+                                               true_type) {
+	return copy_dispatch(first, last, dest, true_type());
+}
+
+template<class BidirIt1, class BidirIt2>
+SSTL_CONSTEXPR14 inline BidirIt2 move_backward_dispatch(BidirIt1 first, BidirIt1 last,
+                                                        BidirIt2 d_last, false_type) {
+	while (first != last) { *--d_last = sstl::move(*--last); }
+
+	return d_last;
+}
+template<class BidirIt1, class BidirIt2>
+SSTL_CONSTEXPR14 inline BidirIt2 move_backward_dispatch(BidirIt1 first, BidirIt1 last,
+                                                        BidirIt2 d_last, true_type) {
+	return copy_backward_dispatch(first, last, d_last, true_type());
 }
 
-/** Copies exactly len values from the range beginning at first to the range beginning at dest, if len > 0. */
 template<class InputIt, class Size, class OutputIt>
-inline OutputIt copy_n(InputIt first, Size len, OutputIt dest) {
-	for (; len; --len, ++first, ++dest) { *dest = *first; }
+SSTL_CONSTEXPR14 inline OutputIt copy_n_dispatch(InputIt first, Size len, OutputIt dest,
+                                                 false_type) {
+	for (; len > 0; --len, ++first, ++dest) { *dest = *first; }
+
+	return dest;
+}
+template<typename T, class Size, typename U>
+SSTL_CONSTEXPR14 inline U* copy_n_dispatch(T* first, Size len, U* dest, true_type) {
+	if (SSTL_IS_CONSTANT_EVALUATED()) {
+		return copy_n_dispatch(first, len, dest, false_type());
+	}
+
+	if (len > 0) {
+		memmove(dest, first, static_cast<size_t>(len) * sizeof(U));
+		dest += len;
+	}
 
 	return dest;
 }
+} /* namespace detail */
+
+/** Exchanges elements between range [first1, last1] and another range starting at first2. */
+template<class ForwardIt1, class ForwardIt2>
+inline ForwardIt2 swap_ranges(ForwardIt1 first1, ForwardIt1 last1,
+                              ForwardIt2 first2) {
+	typedef typename integral_constant < bool,
+	        detail::is_memmovable<ForwardIt1, ForwardIt2>::value &&
+	        is_same<ForwardIt1, ForwardIt2>::value >::type block;
+	return detail::swap_ranges_dispatch(first1, last1, first2, block());
+}
+
+/** Assigns the given value to the elements in the range [first, last]. */
+template<class ForwardIt, typename T>
+SSTL_CONSTEXPR14 inline void fill(ForwardIt first, ForwardIt last, const T& val) {
+	typedef typename detail::is_memsettable<ForwardIt>::type block;
+	detail::fill_dispatch(first, last, val, block());
+}
+
+/** Assigns the given value to the first len elements in the range beginning at first if len > 0. */
+template<class OutputIt, class Size, typename T>
+SSTL_CONSTEXPR14 inline OutputIt fill_n(OutputIt first, Size len, const T& val) {
+	typedef typename detail::is_memsettable<OutputIt>::type block;
+	return detail::fill_n_dispatch(first, len, val, block());
+}
+
+/** Copies the elements in the range, defined by [first, last], to another range beginning at dest. */
+template<class InputIt, class OutputIt>
+SSTL_CONSTEXPR14 inline OutputIt copy(InputIt first, InputIt last, OutputIt dest) {
+	typedef typename detail::is_memmovable<InputIt, OutputIt>::type block;
+	return detail::copy_dispatch(first, last, dest, block());
+}
+
+/** Copies the elements from the range [first, last] to another range ending at d_last, last element first. */
+template<class BidirIt1, class BidirIt2>
+SSTL_CONSTEXPR14 inline BidirIt2 copy_backward(BidirIt1 first, BidirIt1 last, BidirIt2 d_last) {
+	typedef typename detail::is_memmovable<BidirIt1, BidirIt2>::type block;
+	return detail::copy_backward_dispatch(first, last, d_last, block());
+}
+
+/** Copies exactly len values from the range beginning at first to the range beginning at dest, if len > 0. */
+template<class InputIt, class Size, class OutputIt>
+SSTL_CONSTEXPR14 inline OutputIt copy_n(InputIt first, Size len, OutputIt dest) {
+	typedef typename detail::is_memmovable<InputIt, OutputIt>::type block;
+	return detail::copy_n_dispatch(first, len, dest, block());
+}
+
+/** Moves the elements in the range [first, last] to another range beginning at dest. */
+template<class InputIt, class OutputIt>
+SSTL_CONSTEXPR14 inline OutputIt move(InputIt first, InputIt last, OutputIt dest) {
+	typedef typename detail::is_memmovable<InputIt, OutputIt>::type block;
+	return detail::move_dispatch(first, last, dest, block());
+}
+
+/** Moves the elements from the range [first, last] to another range ending at d_last, last element first. */
+template<class BidirIt1, class BidirIt2>
+SSTL_CONSTEXPR14 inline BidirIt2 move_backward(BidirIt1 first, BidirIt1 last, BidirIt2 d_last) {
+	typedef typename detail::is_memmovable<BidirIt1, BidirIt2>::type block;
+	return detail::move_backward_dispatch(first, last, d_last, block());
+}
 
 /** Returns the smaller of the given values. */
 template<typename T>
-inline const T& min(const T& a, const T& b) {
+SSTL_CONSTEXPR inline const T& min(const T& a, const T& b) {
 	return b < a ? b : a;
 }
 
 /** Returns the smaller of the given values, via comparison functor. */
 template<typename T, class Compare>
-inline const T& min(const T& a, const T& b, Compare comp) {
+SSTL_CONSTEXPR inline const T& min(const T& a, const T& b, Compare comp) {
 	return comp(b, a) ? b : a;
 }
 
 /** Returns the greater of the given values. */
 template<typename T>
-inline const T& max(const T& a, const T& b) {
+SSTL_CONSTEXPR inline const T& max(const T& a, const T& b) {
 	return a < b ? b : a;
 }
 
 /** Returns the greater of the given values, via comparison functor. */
 template<typename T, class Compare>
-inline const T& max(const T& a, const T& b, Compare comp) {
+SSTL_CONSTEXPR inline const T& max(const T& a, const T& b, Compare comp) {
 	return comp(a, b) ? b : a;
 }
 
-/** Returns true if the range [first1, last1] is equal to the range beginning at first2. */
-template<class InputIt1, class InputIt2>
-bool equal(InputIt1 first1, InputIt1 last1, InputIt2 first2) {
-	for (; first1 != last1; ++first1, ++first2) {
-		if (!(*first1 == *first2)) {
-			return false;
-		}
+/** Returns the first element in the range [first, last] for which p returns true. */
+template<class InputIt, class UnaryPredicate>
+inline InputIt find_if(InputIt first, InputIt last, UnaryPredicate p) {
+	for (; first != last; ++first) {
+		if (p(*first)) { return first; }
 	}
 
-	return true;
+	return last;
 }
 
-/** Returns true if the range [first1, last1] is equal to the range beginning at first2, via binary predicate. */
-template<class InputIt1, class InputIt2, class BinaryPredicate>
-bool equal(InputIt1 first1, InputIt1 last1, InputIt2 first2,
-           BinaryPredicate p) {
-	for (; first1 != last1; ++first1, ++first2) {
-		if (!p(*first1, *first2)) {
-			return false;
+/** Returns the number of elements in the range [first, last] for which p returns true. */
+template<class InputIt, class UnaryPredicate>
+inline typename iterator_traits<InputIt>::difference_type count_if(InputIt first, InputIt last,
+                                                                   UnaryPredicate p) {
+	typename iterator_traits<InputIt>::difference_type n = 0;
+
+	for (; first != last; ++first) {
+		if (p(*first)) { ++n; }
+	}
+
+	return n;
+}
+
+/** Returns the first smallest element in the range [first, last], via comparison functor. */
+template<class ForwardIt, class Compare>
+inline ForwardIt min_element(ForwardIt first, ForwardIt last, Compare comp) {
+	ForwardIt smallest = first;
+
+	if (first == last) { return last; }
+
+	while (++first != last) {
+		if (comp(*first, *smallest)) { smallest = first; }
+	}
+
+	return smallest;
+}
+
+/** Returns the first largest element in the range [first, last], via comparison functor. */
+template<class ForwardIt, class Compare>
+inline ForwardIt max_element(ForwardIt first, ForwardIt last, Compare comp) {
+	ForwardIt largest = first;
+
+	if (first == last) { return last; }
+
+	while (++first != last) {
+		if (comp(*largest, *first)) { largest = first; }
+	}
+
+	return largest;
+}
+
+/** Returns the first smallest and the last largest element in the range [first, last], via comparison functor. */
+template<class ForwardIt, class Compare>
+inline pair<ForwardIt, ForwardIt> minmax_element(ForwardIt first, ForwardIt last, Compare comp) {
+	pair<ForwardIt, ForwardIt> result(first, first);
+
+	if (first == last) { return result; }
+
+	while (++first != last) {
+		if (comp(*first, *result.first)) { result.first = first; }
+
+		if (!comp(*first, *result.second)) { result.second = first; }
+	}
+
+	return result;
+}
+
+namespace detail {
+#if SSTL_HAS_SSE2
+/** Loads 16 bytes of elements, which may be unaligned. */
+template<typename T>
+inline __m128i load_lanes(const T* p) { return _mm_loadu_si128(reinterpret_cast<const __m128i*>(p)); }
+
+/** Returns lanes of a where mask is set and lanes of b elsewhere. */
+inline __m128i select_lanes(__m128i mask, __m128i a, __m128i b) {
+	return _mm_or_si128(_mm_and_si128(mask, a), _mm_andnot_si128(mask, b));
+}
+
+/**
+	SSE2 operations on 16 bytes of elements of type T. Comparisons set each
+	lane to all ones or all zeros, so a byte mask shows the matching lanes.
+	Only arithmetic types have lanes, and only integers up to 32 bits can be
+	ordered, SSE2 has no wider integer comparison.
+
+	Ordering works on lanes mapped by order(), which flips sign bits where
+	that turns the comparison into one SSE2 has, and is its own inverse.
+*/
+template<typename T, size_t Size = sstl::is_arithmetic<T>::value ? sizeof(T) : 0,
+         bool Float = sstl::is_floating_point<T>::value>
+struct simd_lanes {
+	static const bool equality = false;
+	static const bool ordering = false;
+};
+
+/** Bytes are ordered as unsigned, which has native minimum and maximum. */
+template<typename T>
+struct simd_lanes<T, 1, false> {
+	static const bool equality = true;
+	static const bool ordering = true;
+
+	static __m128i splat(T value) { return _mm_set1_epi8(char(value)); }
+	static __m128i equal(__m128i a, __m128i b) { return _mm_cmpeq_epi8(a, b); }
+
+	static __m128i order(__m128i a) { return sstl::is_signed<T>::value ? _mm_xor_si128(a, _mm_set1_epi8(-0x7f - 1)) : a; }
+	static __m128i min(__m128i a, __m128i b) { return _mm_min_epu8(a, b); }
+	static __m128i max(__m128i a, __m128i b) { return _mm_max_epu8(a, b); }
+};
+
+/** 16-bit lanes are ordered as signed, which has native minimum and maximum. */
+template<typename T>
+struct simd_lanes<T, 2, false> {
+	static const bool equality = true;
+	static const bool ordering = true;
+
+	static __m128i splat(T value) { return _mm_set1_epi16(short(value)); }
+	static __m128i equal(__m128i a, __m128i b) { return _mm_cmpeq_epi16(a, b); }
+
+	static __m128i order(__m128i a) { return sstl::is_signed<T>::value ? a : _mm_xor_si128(a, _mm_set1_epi16(-0x7fff - 1)); }
+	static __m128i min(__m128i a, __m128i b) { return _mm_min_epi16(a, b); }
+	static __m128i max(__m128i a, __m128i b) { return _mm_max_epi16(a, b); }
+};
+
+/** 32-bit lanes are ordered as signed, selecting through a comparison mask. */
+template<typename T>
+struct simd_lanes<T, 4, false> {
+	static const bool equality = true;
+	static const bool ordering = true;
+
+	static __m128i splat(T value) { return _mm_set1_epi32(int(value)); }
+	static __m128i equal(__m128i a, __m128i b) { return _mm_cmpeq_epi32(a, b); }
+
+	static __m128i order(__m128i a) {
+		return sstl::is_signed<T>::value ? a : _mm_xor_si128(a, _mm_set1_epi32(-0x7fffffff - 1));
+	}
+	static __m128i min(__m128i a, __m128i b) { return select_lanes(_mm_cmplt_epi32(a, b), a, b); }
+	static __m128i max(__m128i a, __m128i b) { return select_lanes(_mm_cmpgt_epi32(a, b), a, b); }
+};
+
+template<typename T>
+struct simd_lanes<T, 8, false> {
+	static const bool equality = true;
+	static const bool ordering = false;
+
+	static __m128i splat(T value) { return _mm_set1_epi64x((long long)(value)); }
+	/** Both 32-bit halves of a lane must match, so each half is combined with its neighbour. */
+	static __m128i equal(__m128i a, __m128i b) {
+		const __m128i halves = _mm_cmpeq_epi32(a, b);
+		return _mm_and_si128(halves, _mm_shuffle_epi32(halves, _MM_SHUFFLE(2, 3, 0, 1)));
+	}
+};
+
+/** Floating-point lanes compare as floating point, so -0 equals +0 and NaN equals nothing. */
+template<typename T>
+struct simd_lanes<T, 4, true> {
+	static const bool equality = true;
+	static const bool ordering = false;
+
+	static __m128i splat(T value) { return _mm_castps_si128(_mm_set1_ps(value)); }
+	static __m128i equal(__m128i a, __m128i b) {
+		return _mm_castps_si128(_mm_cmpeq_ps(_mm_castsi128_ps(a), _mm_castsi128_ps(b)));
+	}
+};
+
+template<typename T>
+struct simd_lanes<T, 8, true> {
+	static const bool equality = true;
+	static const bool ordering = false;
+
+	static __m128i splat(T value) { return _mm_castpd_si128(_mm_set1_pd(value)); }
+	static __m128i equal(__m128i a, __m128i b) {
+		return _mm_castpd_si128(_mm_cmpeq_pd(_mm_castsi128_pd(a), _mm_castsi128_pd(b)));
+	}
+};
+
+/**
+	Returns the first element equal to value. Four groups of 16 bytes are
+	matched per step and tested together, then the first group with a match
+	is located.
+*/
+template<typename T>
+const T* simd_find(const T* first, const T* last, T value) {
+	typedef simd_lanes<T> lanes;
+	const size_t width = 16 / sizeof(T);
+	const __m128i needle = lanes::splat(value);
+
+	for (; size_t(last - first) >= 4 * width; first += 4 * width) {
+		const __m128i a = lanes::equal(load_lanes(first), needle);
+		const __m128i b = lanes::equal(load_lanes(first + width), needle);
+		const __m128i c = lanes::equal(load_lanes(first + 2 * width), needle);
+		const __m128i d = lanes::equal(load_lanes(first + 3 * width), needle);
+
+		if (_mm_movemask_epi8(_mm_or_si128(_mm_or_si128(a, b), _mm_or_si128(c, d)))) { break; }
+	}
+
+	for (; size_t(last - first) >= width; first += width) {
+		const uint32_t bits = uint32_t(_mm_movemask_epi8(lanes::equal(load_lanes(first), needle)));
+
+		if (bits) { return first + lowest_bit(bits) / sizeof(T); }
+	}
+
+	for (; first != last; ++first) {
+		if (*first == value) { return first; }
+	}
+
+	return last;
+}
+
+/** Returns the last element equal to value, or last if there is none, matching 16 bytes at a time from the back. */
+template<typename T>
+const T* simd_find_last(const T* first, const T* last, T value) {
+	typedef simd_lanes<T> lanes;
+	const size_t width = 16 / sizeof(T);
+	const __m128i needle = lanes::splat(value);
+	const T* end = last;
+
+	for (; size_t(end - first) >= width; end -= width) {
+		const uint32_t bits = uint32_t(_mm_movemask_epi8(lanes::equal(load_lanes(end - width), needle)));
+
+		if (bits) { return end - width + highest_bit(bits) / sizeof(T); }
+	}
+
+	while (end != first) {
+		if (*--end == value) { return end; }
+	}
+
+	return last;
+}
+
+/**
+	Counts the elements equal to value. Every byte of a matching lane counts
+	one in a byte counter, the counters are summed before they can overflow
+	and the total is divided by the element size at the end.
+*/
+template<typename T>
+size_t simd_count(const T* first, const T* last, T value) {
+	typedef simd_lanes<T> lanes;
+	const size_t width = 16 / sizeof(T);
+	const size_t groups_per_sum = 255;
+	const __m128i needle = lanes::splat(value);
+	const __m128i zero = _mm_setzero_si128();
+	__m128i total = zero;
+
+	while (size_t(last - first) >= width) {
+		const T* const stop = first + sstl::min(size_t(last - first) / width, groups_per_sum) * width;
+		__m128i counters = zero;
+
+		for (; first != stop; first += width) {
+			counters = _mm_sub_epi8(counters, lanes::equal(load_lanes(first), needle));
 		}
+
+		total = _mm_add_epi64(total, _mm_sad_epu8(counters, zero));
 	}
 
-	return true;
+	uint64_t sums[2];
+	_mm_storeu_si128(reinterpret_cast<__m128i*>(sums), total);
+	size_t n = size_t((sums[0] + sums[1]) / sizeof(T));
+
+	for (; first != last; ++first) { n += *first == value ? 1 : 0; }
+
+	return n;
 }
 
-/** Checks if the first range [first1, last1] is lexicographically less than the second range [first2, last2]. */
-template<class InputIt1, class InputIt2>
-bool lexicographical_compare(InputIt1 first1, InputIt1 last1,
-                             InputIt2 first2, InputIt2 last2) {
-	for (; (first1 != last1) && (first2 != last2); ++first1, ++first2) {
-		if (*first1 < *first2) { return true; }
+/**
+	Finds the smallest and largest values of the non-empty range [first, last).
+	Four groups of lanes keep independent running extremes, which hides the
+	latency of the 32-bit selects. The last group overlaps the one before
+	rather than falling back to scalar code, which is harmless here.
+*/
+template<typename T>
+void simd_extremes(const T* first, const T* last, T& smallest, T& largest) {
+	typedef simd_lanes<T> lanes;
+	const size_t width = 16 / sizeof(T);
 
-		if (*first2 < *first1) { return false; }
+	if (size_t(last - first) < width) {
+		smallest = largest = *first;
+
+		for (++first; first != last; ++first) {
+			smallest = *first < smallest ? *first : smallest;
+			largest = largest < *first ? *first : largest;
+		}
+
+		return;
 	}
 
-	return (first1 == last1) && (first2 != last2);
+	__m128i lo[4];
+	__m128i hi[4];
+	lo[0] = lo[1] = lo[2] = lo[3] = hi[0] = hi[1] = hi[2] = hi[3] = lanes::order(load_lanes(first));
+
+	for (; size_t(last - first) >= 4 * width; first += 4 * width) {
+		for (size_t i = 0; i < 4; ++i) {
+			const __m128i v = lanes::order(load_lanes(first + i * width));
+			lo[i] = lanes::min(lo[i], v);
+			hi[i] = lanes::max(hi[i], v);
+		}
+	}
+
+	for (; first != last; first += width) {
+		if (size_t(last - first) < width) { first = last - width; }
+
+		const __m128i v = lanes::order(load_lanes(first));
+		lo[0] = lanes::min(lo[0], v);
+		hi[0] = lanes::max(hi[0], v);
+	}
+
+	T lows[16 / sizeof(T)];
+	T highs[16 / sizeof(T)];
+	_mm_storeu_si128(reinterpret_cast<__m128i*>(lows),
+	                 lanes::order(lanes::min(lanes::min(lo[0], lo[1]), lanes::min(lo[2], lo[3]))));
+	_mm_storeu_si128(reinterpret_cast<__m128i*>(highs),
+	                 lanes::order(lanes::max(lanes::max(hi[0], hi[1]), lanes::max(hi[2], hi[3]))));
+	smallest = lows[0];
+	largest = highs[0];
+
+	for (size_t i = 1; i < width; ++i) {
+		smallest = lows[i] < smallest ? lows[i] : smallest;
+		largest = largest < highs[i] ? highs[i] : largest;
+	}
 }
+#else
+template<typename T>
+struct simd_lanes {
+	static const bool equality = false;
+	static const bool ordering = false;
+};
+#endif
 
-/** Checks if the first range [first1, last1] is lexicographically less than the second range [first2, last2], via comparison functor. */
-template<class InputIt1, class InputIt2, class Compare>
-bool lexicographical_compare(InputIt1 first1, InputIt1 last1,
-                             InputIt2 first2, InputIt2 last2,
-                             Compare comp) {
-	for (; (first1 != last1) && (first2 != last2); ++first1, ++first2) {
-		if (comp(*first1, *first2)) { return true; }
+/**
+	Whether find and count over [It, It) with a value of type T run the SIMD
+	kernels: It must point to arithmetic elements, and the value must be an
+	integer for integer elements or of the element type for floating ones.
+*/
+template<class It, typename T>
+struct use_simd_find : public false_type {};
 
-		if (comp(*first2, *first1)) { return false; }
+template<typename U, typename T>
+struct use_simd_find<U*, T> : public integral_constant < bool, simd_lanes<typename remove_cv<U>::type>::equality &&
+	((sstl::is_integral<U>::value && sstl::is_integral<T>::value) || is_same<typename remove_cv<U>::type, T>::value) > {};
+
+/** Whether min_element, max_element and minmax_element over [It, It) run the SIMD kernels. */
+template<class It>
+struct use_simd_extremes : public false_type {};
+
+template<typename U>
+struct use_simd_extremes<U*> : public integral_constant < bool,
+	simd_lanes<typename remove_cv<U>::type>::ordering > {};
+
+template<class InputIt, typename T>
+inline InputIt find_dispatch(InputIt first, InputIt last, const T& val, false_type) {
+	for (; first != last; ++first) {
+		if (*first == val) { return first; }
 	}
 
-	return (first1 == last1) && (first2 != last2);
+	return last;
 }
+template<class InputIt, typename T>
+inline typename iterator_traits<InputIt>::difference_type count_dispatch(InputIt first, InputIt last,
+                                                                        const T& val, false_type) {
+	typename iterator_traits<InputIt>::difference_type n = 0;
 
-/** Reverses the order of the elements in the range [first, last]. */
-template<class BidirIt>
-inline void reverse(BidirIt first, BidirIt last) {
-	for (; first != last && first != --last; ++first) { iter_swap(first, last); }
+	for (; first != last; ++first) {
+		if (*first == val) { ++n; }
+	}
+
+	return n;
+}
+template<class ForwardIt>
+inline ForwardIt min_element_dispatch(ForwardIt first, ForwardIt last, false_type) {
+	return sstl::min_element(first, last, sstl::less<typename iterator_traits<ForwardIt>::value_type>());
+}
+template<class ForwardIt>
+inline ForwardIt max_element_dispatch(ForwardIt first, ForwardIt last, false_type) {
+	return sstl::max_element(first, last, sstl::less<typename iterator_traits<ForwardIt>::value_type>());
+}
+template<class ForwardIt>
+inline pair<ForwardIt, ForwardIt> minmax_element_dispatch(ForwardIt first, ForwardIt last, false_type) {
+	return sstl::minmax_element(first, last, sstl::less<typename iterator_traits<ForwardIt>::value_type>());
 }
 
-/** Performs a left rotation on a range of elements. */
-template <class ForwardIt>
-ForwardIt rotate(ForwardIt first, ForwardIt n_first, ForwardIt last) {
-	if (first == n_first) { return last; }
+#if SSTL_HAS_SSE2
+/*
+ * An integer value which does not survive the conversion to the element type
+ * cannot equal any element, otherwise the elements are searched for the
+ * converted value. NaN fails the check too, and equals nothing either.
+ */
+template<typename U, typename T>
+inline U* find_dispatch(U* first, U* last, const T& val, true_type) {
+	typedef typename remove_cv<U>::type value_type;
 
-	if (n_first == last) { return first; }
+	if (!(value_type(val) == val)) { return last; }
+
+	return first + (simd_find<value_type>(first, last, value_type(val)) - first);
+}
+template<typename U, typename T>
+inline ptrdiff_t count_dispatch(U* first, U* last, const T& val, true_type) {
+	typedef typename remove_cv<U>::type value_type;
 
-	reverse(first, n_first);
-	reverse(n_first, last);
-	reverse(first, last);
+	if (!(value_type(val) == val)) { return 0; }
 
-	return first + distance(n_first, last);
+	return ptrdiff_t(simd_count<value_type>(first, last, value_type(val)));
+}
+/* The extreme values are found first, then their positions in a second, equally vectorized pass. */
+template<typename U>
+inline U* min_element_dispatch(U* first, U* last, true_type) {
+	typedef typename remove_cv<U>::type value_type;
+
+	if (first == last) { return last; }
+
+	value_type smallest, largest;
+	simd_extremes<value_type>(first, last, smallest, largest);
+	return first + (simd_find<value_type>(first, last, smallest) - first);
+}
+template<typename U>
+inline U* max_element_dispatch(U* first, U* last, true_type) {
+	typedef typename remove_cv<U>::type value_type;
+
+	if (first == last) { return last; }
+
+	value_type smallest, largest;
+	simd_extremes<value_type>(first, last, smallest, largest);
+	return first + (simd_find<value_type>(first, last, largest) - first);
+}
+template<typename U>
+inline pair<U*, U*> minmax_element_dispatch(U* first, U* last, true_type) {
+	typedef typename remove_cv<U>::type value_type;
+
+	if (first == last) { return pair<U*, U*>(last, last); }
+
+	value_type smallest, largest;
+	simd_extremes<value_type>(first, last, smallest, largest);
+	return pair<U*, U*>(first + (simd_find<value_type>(first, last, smallest) - first),
+	                    first + (simd_find_last<value_type>(first, last, largest) - first));
+}
+#endif
+} /* namespace detail */
+
+/**
+	Returns the first element in the range [first, last] which equals val.
+	Pointer ranges of arithmetic elements are matched 16 bytes at a time
+	when SSE2 is available.
+*/
+template<class InputIt, typename T>
+inline InputIt find(InputIt first, InputIt last, const T& val) {
+	return detail::find_dispatch(first, last, val, detail::use_simd_find<InputIt, T>());
+}
+
+/** Returns the number of elements in the range [first, last] which equal val, see find. */
+template<class InputIt, typename T>
+inline typename iterator_traits<InputIt>::difference_type count(InputIt first, InputIt last,
+                                                                const T& val) {
+	return detail::count_dispatch(first, last, val, detail::use_simd_find<InputIt, T>());
+}
+
+/**
+	Returns the first smallest element in the range [first, last]. Pointer
+	ranges of integers up to 32 bits are scanned 16 bytes at a time when
+	SSE2 is available.
+*/
+template<class ForwardIt>
+inline ForwardIt min_element(ForwardIt first, ForwardIt last) {
+	return detail::min_element_dispatch(first, last, detail::use_simd_extremes<ForwardIt>());
+}
+
+/** Returns the first largest element in the range [first, last], see min_element. */
+template<class ForwardIt>
+inline ForwardIt max_element(ForwardIt first, ForwardIt last) {
+	return detail::max_element_dispatch(first, last, detail::use_simd_extremes<ForwardIt>());
+}
+
+/** Returns the first smallest and the last largest element in the range [first, last], see min_element. */
+template<class ForwardIt>
+inline pair<ForwardIt, ForwardIt> minmax_element(ForwardIt first, ForwardIt last) {
+	return detail::minmax_element_dispatch(first, last, detail::use_simd_extremes<ForwardIt>());
+}
+
+namespace detail {
+template<class InputIt1, class InputIt2>
+SSTL_CONSTEXPR14 inline bool equal_dispatch(InputIt1 first1, InputIt1 last1, InputIt2 first2,
+                                            false_type) {
+	for (; first1 != last1; ++first1, ++first2) {
+		if (!(*first1 == *first2)) {
+			return false;
+		}
+	}
+
+	return true;
+}
+template<typename T, typename U>
+SSTL_CONSTEXPR14 inline bool equal_dispatch(T* first1, T* last1, U* first2, true_type) {
+	if (SSTL_IS_CONSTANT_EVALUATED()) {
+		return equal_dispatch(first1, last1, first2, false_type());
+	}
+
+	const size_t count = static_cast<size_t>(last1 - first1);
+	return count == 0 || memcmp(first1, first2, count * sizeof(T)) == 0;
+}
+
+template<class InputIt1, class InputIt2>
+SSTL_CONSTEXPR14 inline bool lexicographical_compare_dispatch(InputIt1 first1, InputIt1 last1,
+                                                              InputIt2 first2, InputIt2 last2,
+                                                              false_type) {
+	for (; (first1 != last1) && (first2 != last2); ++first1, ++first2) {
+		if (*first1 < *first2) { return true; }
+
+		if (*first2 < *first1) { return false; }
+	}
+
+	return (first1 == last1) && (first2 != last2);
+}
+/*
+ * Unsigned bytes order like memcmp orders them. Wider or signed integers are
+ * scanned for the first element which differs in any byte, which then
+ * decides with its own operator<.
+ */
+template<typename T, typename U>
+SSTL_CONSTEXPR14 inline bool lexicographical_compare_dispatch(T* first1, T* last1,
+                                                              U* first2, U* last2,
+                                                              true_type) {
+	if (SSTL_IS_CONSTANT_EVALUATED()) {
+		return lexicographical_compare_dispatch(first1, last1, first2, last2, false_type());
+	}
+
+	const size_t count1 = static_cast<size_t>(last1 - first1);
+	const size_t count2 = static_cast<size_t>(last2 - first2);
+	const size_t count = count1 < count2 ? count1 : count2;
+
+	if (sizeof(T) == 1 && is_unsigned<T>::value) {
+		const int order = count ? memcmp(first1, first2, count) : 0;
+		return order ? order < 0 : count1 < count2;
+	}
+
+	const size_t i = mismatch_bytes(reinterpret_cast<const unsigned char*>(first1),
+	                                reinterpret_cast<const unsigned char*>(first2),
+	                                count * sizeof(T)) / sizeof(T);
+	return i < count ? first1[i] < first2[i] : count1 < count2;
+}
+} /* namespace detail */
+
+/**
+	Returns true if the range [first1, last1] is equal to the range beginning
+	at first2. Pointer ranges of integers are compared with memcmp.
+*/
+template<class InputIt1, class InputIt2>
+SSTL_CONSTEXPR14 inline bool equal(InputIt1 first1, InputIt1 last1, InputIt2 first2) {
+	return detail::equal_dispatch(first1, last1, first2,
+	                              detail::is_memcomparable<InputIt1, InputIt2>());
+}
+
+/** Returns true if the range [first1, last1] is equal to the range beginning at first2, via binary predicate. */
+template<class InputIt1, class InputIt2, class BinaryPredicate>
+SSTL_CONSTEXPR14 bool equal(InputIt1 first1, InputIt1 last1, InputIt2 first2,
+                            BinaryPredicate p) {
+	for (; first1 != last1; ++first1, ++first2) {
+		if (!p(*first1, *first2)) {
+			return false;
+		}
+	}
+
+	return true;
+}
+
+/**
+	Checks if the first range [first1, last1] is lexicographically less than
+	the second range [first2, last2]. Pointer ranges of integers are compared
+	with memcmp or a word at a time, see detail::mismatch_bytes.
+*/
+template<class InputIt1, class InputIt2>
+SSTL_CONSTEXPR14 inline bool lexicographical_compare(InputIt1 first1, InputIt1 last1,
+                                                     InputIt2 first2, InputIt2 last2) {
+	return detail::lexicographical_compare_dispatch(first1, last1, first2, last2,
+	                                                detail::is_memcomparable<InputIt1, InputIt2>());
+}
+
+/** Checks if the first range [first1, last1] is lexicographically less than the second range [first2, last2], via comparison functor. */
+template<class InputIt1, class InputIt2, class Compare>
+SSTL_CONSTEXPR14 bool lexicographical_compare(InputIt1 first1, InputIt1 last1,
+                                              InputIt2 first2, InputIt2 last2,
+                                              Compare comp) {
+	for (; (first1 != last1) && (first2 != last2); ++first1, ++first2) {
+		if (comp(*first1, *first2)) { return true; }
+
+		if (comp(*first2, *first1)) { return false; }
+	}
+
+	return (first1 == last1) && (first2 != last2);
+}
+
+/** Reverses the order of the elements in the range [first, last]. */
+template<class BidirIt>
+inline void reverse(BidirIt first, BidirIt last) {
+	for (; first != last && first != --last; ++first) { sstl::iter_swap(first, last); }
+}
+
+namespace detail {
+/** Returns the greatest common divisor of a and b. */
+template<typename T>
+inline T gcd(T a, T b) {
+	while (b != 0) {
+		const T t = a % b;
+		a = b;
+		b = t;
+	}
+
+	return a;
+}
+
+/** Block swap rotation, each swap puts at least one element in its final place. */
+template<class ForwardIt>
+ForwardIt rotate(ForwardIt first, ForwardIt n_first, ForwardIt last,
+                 forward_iterator_tag) {
+	ForwardIt first2 = n_first;
+
+	do {
+		sstl::iter_swap(first, first2);
+		++first;
+		++first2;
+
+		if (first == n_first) { n_first = first2; }
+	} while (first2 != last);
+
+	ForwardIt result = first;
+	first2 = n_first;
+
+	while (first2 != last) {
+		sstl::iter_swap(first, first2);
+		++first;
+		++first2;
+
+		if (first == n_first) {
+			n_first = first2;
+		} else if (first2 == last) {
+			first2 = n_first;
+		}
+	}
+
+	return result;
+}
+
+/** Cycle leader rotation, every element is moved exactly once through a single temporary per cycle. */
+template<class RandomIt>
+RandomIt rotate(RandomIt first, RandomIt n_first, RandomIt last,
+                random_access_iterator_tag) {
+	typedef typename iterator_traits<RandomIt>::difference_type difference_type;
+	typedef typename iterator_traits<RandomIt>::value_type      value_type;
+
+	const difference_type n = last - first;
+	const difference_type k = n_first - first;
+
+	if (k == n - k) {
+		sstl::swap_ranges(first, n_first, n_first);
+		return n_first;
+	}
+
+	const difference_type cycles = gcd(n, k);
+
+	for (difference_type i = 0; i < cycles; ++i) {
+		value_type tmp(sstl::move(first[i]));
+		difference_type hole = i;
+
+		for (;;) {
+			difference_type source = hole + k;
+
+			if (source >= n) { source -= n; }
+
+			if (source == i) { break; }
+
+			first[hole] = sstl::move(first[source]);
+			hole = source;
+		}
+
+		first[hole] = sstl::move(tmp);
+	}
+
+	return first + (n - k);
+}
+} /* namespace detail */
+
+/** Performs a left rotation on a range of elements. */
+template <class ForwardIt>
+ForwardIt rotate(ForwardIt first, ForwardIt n_first, ForwardIt last) {
+	typedef typename iterator_traits<ForwardIt>::iterator_category category;
+
+	if (first == n_first) { return last; }
+
+	if (n_first == last) { return first; }
+
+	return detail::rotate(first, n_first, last, category());
+}
+
+namespace detail {
+/**
+	Returns the first of count sorted elements from first which does not
+	compare less than val. Every step halves the range with a conditional
+	move instead of a branch, so the loop runs a fixed log2(count) times
+	and never mispredicts.
+*/
+template<class RandomIt, typename T, class Compare>
+inline RandomIt branchless_lower_bound(RandomIt first, size_t count, const T& val,
+                                       Compare comp) {
+	while (count > 1) {
+		const size_t half = count / 2;
+		first += comp(first[half], val) ? half : 0;
+		count -= half;
+	}
+
+	return first + (count && comp(*first, val) ? 1 : 0);
+}
+
+/** Returns the first of count sorted elements from first which compares greater than val, see branchless_lower_bound. */
+template<class RandomIt, typename T, class Compare>
+inline RandomIt branchless_upper_bound(RandomIt first, size_t count, const T& val,
+                                       Compare comp) {
+	while (count > 1) {
+		const size_t half = count / 2;
+		first += comp(val, first[half]) ? 0 : half;
+		count -= half;
+	}
+
+	return first + (count && !comp(val, *first) ? 1 : 0);
+}
+
+/** Reverses the entries [first, last) through swap, see stable_sort_indexed. */
+template<class Swap>
+inline void reverse_indexed(size_t first, size_t last, Swap& swap) {
+	for (; first + 1 < last; ++first) { swap(first, --last); }
+}
+
+/** Merges the sorted entries [first, middle) and [middle, last) by rotations, see stable_sort_indexed. */
+template<typename K, class Compare, class Swap>
+inline void merge_indexed(const K* keys, size_t first, size_t middle, size_t last, Compare comp,
+                          Swap& swap) {
+	if (first == middle || middle == last) { return; }
+
+	if (last - first == 2) {
+		if (comp(keys[middle], keys[first])) { swap(first, middle); }
+
+		return;
+	}
+
+	size_t cut_left;
+	size_t cut_right;
+
+	/* Splits the longer run in half, and the other run where that middle key would go. */
+	if (middle - first > last - middle) {
+		cut_left = first + (middle - first) / 2;
+		cut_right = size_t(branchless_lower_bound(keys + middle, last - middle, keys[cut_left], comp) - keys);
+	} else {
+		cut_right = middle + (last - middle) / 2;
+		cut_left = size_t(branchless_upper_bound(keys + first, middle - first, keys[cut_right], comp) - keys);
+	}
+
+	reverse_indexed(cut_left, middle, swap);
+	reverse_indexed(middle, cut_right, swap);
+	reverse_indexed(cut_left, cut_right, swap);
+
+	const size_t split = cut_left + (cut_right - middle);
+	merge_indexed(keys, first, cut_left, split, comp, swap);
+	merge_indexed(keys, split, cut_right, last, comp, swap);
+}
+
+/**
+	Sorts keys[0, count) stably in place without extra storage, by merging
+	insertion sorted runs through rotations. Every exchange goes through
+	swap(i, j), which must swap keys[i] and keys[j] along with the same
+	entries of any parallel arrays.
+*/
+template<typename K, class Compare, class Swap>
+inline void stable_sort_indexed(const K* keys, size_t count, Compare comp, Swap swap) {
+	const size_t run = 16;
+
+	for (size_t start = 0; start < count; start += run) {
+		const size_t end = sstl::min(start + run, count);
+
+		for (size_t i = start + 1; i < end; ++i) {
+			for (size_t j = i; j > start && comp(keys[j], keys[j - 1]); --j) { swap(j - 1, j); }
+		}
+	}
+
+	for (size_t width = run; width < count; width *= 2) {
+		for (size_t first = 0; first + width < count; first += 2 * width) {
+			merge_indexed(keys, first, first + width, sstl::min(first + 2 * width, count), comp, swap);
+		}
+	}
+}
+} /* namespace detail */
+
+namespace detail {
+/** Ranges up to this size are finished with insertion sort, which beats partitioning on so few elements. */
+const ptrdiff_t insertion_sort_threshold = 24;
+
+/** Ranges above this size take the pivot from a median of three medians of three. */
+const ptrdiff_t ninther_threshold = 128;
+
+/** Elements classified per block by the branchless partition, small enough for byte offsets. */
+const size_t partition_block_size = 64;
+
+/** Moves the element at last left until the element before it does not compare greater, see insertion_sort. */
+template<class RandomIt, class Compare>
+inline void unguarded_linear_insert(RandomIt last, Compare comp) {
+	typename iterator_traits<RandomIt>::value_type val(sstl::move(*last));
+	RandomIt next = last;
+
+	for (--next; comp(val, *next); --next) {
+		*last = sstl::move(*next);
+		last = next;
+	}
+
+	*last = sstl::move(val);
+}
+
+/** Stable sort of a short range, an element smaller than the first is moved to the front in one go. */
+template<class RandomIt, class Compare>
+void insertion_sort(RandomIt first, RandomIt last, Compare comp) {
+	if (first == last) { return; }
+
+	for (RandomIt i = first + 1; i != last; ++i) {
+		if (comp(*i, *first)) {
+			typename iterator_traits<RandomIt>::value_type val(sstl::move(*i));
+			sstl::move_backward(first, i, i + 1);
+			*first = sstl::move(val);
+		} else {
+			unguarded_linear_insert(i, comp);
+		}
+	}
+}
+
+/** Insertion sort without the bounds check, the element before first must not compare greater than any in the range. */
+template<class RandomIt, class Compare>
+void unguarded_insertion_sort(RandomIt first, RandomIt last, Compare comp) {
+	for (RandomIt i = first; i != last; ++i) { unguarded_linear_insert(i, comp); }
+}
+
+/** Moves val up from hole towards top until its parent is not less than it. */
+template<class RandomIt, typename Distance, typename T, class Compare>
+void push_heap(RandomIt first, Distance hole, Distance top, T val, Compare comp) {
+	for (Distance parent = (hole - 1) / 2; hole > top && comp(first[parent], val); parent = (hole - 1) / 2) {
+		first[hole] = sstl::move(first[parent]);
+		hole = parent;
+	}
+
+	first[hole] = sstl::move(val);
+}
+
+/** Restores the max heap below hole after its element was taken out, then puts val into the heap. */
+template<class RandomIt, typename Distance, typename T, class Compare>
+void adjust_heap(RandomIt first, Distance hole, Distance len, T val, Compare comp) {
+	const Distance top = hole;
+	Distance child = hole;
+
+	/* Moves the hole down to a leaf along the larger children, then val bubbles up from there. */
+	while (child < (len - 1) / 2) {
+		child = 2 * (child + 1);
+
+		if (comp(first[child], first[child - 1])) { --child; }
+
+		first[hole] = sstl::move(first[child]);
+		hole = child;
+	}
+
+	if ((len & 1) == 0 && child == (len - 2) / 2) {
+		child = 2 * (child + 1);
+		first[hole] = sstl::move(first[child - 1]);
+		hole = child - 1;
+	}
+
+	detail::push_heap(first, hole, top, sstl::move(val), comp);
+}
+
+/** Arranges [first, last) into a max heap. */
+template<class RandomIt, class Compare>
+void make_heap(RandomIt first, RandomIt last, Compare comp) {
+	typedef typename iterator_traits<RandomIt>::difference_type difference_type;
+	typedef typename iterator_traits<RandomIt>::value_type      value_type;
+
+	const difference_type len = last - first;
+
+	for (difference_type parent = len / 2; parent-- > 0;) {
+		value_type val(sstl::move(first[parent]));
+		adjust_heap(first, parent, len, sstl::move(val), comp);
+	}
+}
+
+/** Turns the max heap [first, last) into a sorted range. */
+template<class RandomIt, class Compare>
+void sort_heap(RandomIt first, RandomIt last, Compare comp) {
+	typedef typename iterator_traits<RandomIt>::difference_type difference_type;
+	typedef typename iterator_traits<RandomIt>::value_type      value_type;
+
+	while (last - first > 1) {
+		--last;
+		value_type val(sstl::move(*last));
+		*last = sstl::move(*first);
+		adjust_heap(first, difference_type(0), difference_type(last - first), sstl::move(val), comp);
+	}
+}
+
+/** Gathers the middle - first smallest elements of [first, last) into a max heap at [first, middle). */
+template<class RandomIt, class Compare>
+void heap_select(RandomIt first, RandomIt middle, RandomIt last, Compare comp) {
+	typedef typename iterator_traits<RandomIt>::difference_type difference_type;
+	typedef typename iterator_traits<RandomIt>::value_type      value_type;
+
+	detail::make_heap(first, middle, comp);
+
+	for (RandomIt i = middle; i < last; ++i) {
+		if (comp(*i, *first)) {
+			value_type val(sstl::move(*i));
+			*i = sstl::move(*first);
+			adjust_heap(first, difference_type(0), difference_type(middle - first), sstl::move(val), comp);
+		}
+	}
+}
+
+/** Orders the elements at a, b and c. */
+template<class RandomIt, class Compare>
+inline void sort3(RandomIt a, RandomIt b, RandomIt c, Compare comp) {
+	if (comp(*b, *a)) { sstl::iter_swap(a, b); }
+
+	if (comp(*c, *b)) { sstl::iter_swap(b, c); }
+
+	if (comp(*b, *a)) { sstl::iter_swap(a, b); }
+}
+
+/**
+	Moves the pivot, a median of three or of three medians of three, to
+	first. Either way some element after first compares at least equal to
+	it, which stops the unguarded scans of the partitions below.
+*/
+template<class RandomIt, class Compare>
+inline void move_median_to_first(RandomIt first, RandomIt last, Compare comp) {
+	const ptrdiff_t size = last - first;
+	const ptrdiff_t half = size / 2;
+
+	if (size > ninther_threshold) {
+		sort3(first, first + half, last - 1, comp);
+		sort3(first + 1, first + (half - 1), last - 2, comp);
+		sort3(first + 2, first + (half + 1), last - 3, comp);
+		sort3(first + (half - 1), first + half, first + (half + 1), comp);
+		sstl::iter_swap(first, first + half);
+	} else {
+		sort3(first + half, first, last - 1, comp);
+	}
+}
+
+/**
+	Partitions [first, last) around the pivot at first, which ends up at the
+	returned position. Smaller elements go to its left, all others to its
+	right.
+*/
+template<class RandomIt, class Compare>
+RandomIt partition_right(RandomIt first, RandomIt last, Compare comp, false_type) {
+	typename iterator_traits<RandomIt>::value_type pivot(sstl::move(*first));
+	const RandomIt begin = first;
+
+	while (comp(*++first, pivot)) {}
+
+	if (first - 1 == begin) {
+		while (first < last && !comp(*--last, pivot)) {}
+	} else {
+		while (!comp(*--last, pivot)) {}
+	}
+
+	while (first < last) {
+		sstl::iter_swap(first, last);
+
+		while (comp(*++first, pivot)) {}
+
+		while (!comp(*--last, pivot)) {}
+	}
+
+	const RandomIt pivot_pos = first - 1;
+	*begin = sstl::move(*pivot_pos);
+	*pivot_pos = sstl::move(pivot);
+	return pivot_pos;
+}
+
+/**
+	Exchanges the misplaced elements recorded by the branchless partition.
+	With unequal counts a cyclic permutation through one temporary saves a
+	third of the moves, see partition_right.
+*/
+template<class RandomIt>
+inline void swap_offsets(RandomIt first, RandomIt last, const unsigned char* offsets_l,
+                         const unsigned char* offsets_r, size_t count, bool use_swaps) {
+	if (use_swaps) {
+		for (size_t i = 0; i < count; ++i) { sstl::iter_swap(first + offsets_l[i], last - offsets_r[i]); }
+	} else if (count) {
+		RandomIt l = first + offsets_l[0];
+		RandomIt r = last - offsets_r[0];
+		typename iterator_traits<RandomIt>::value_type tmp(sstl::move(*l));
+		*l = sstl::move(*r);
+
+		for (size_t i = 1; i < count; ++i) {
+			l = first + offsets_l[i];
+			*r = sstl::move(*l);
+			r = last - offsets_r[i];
+			*l = sstl::move(*r);
+		}
+
+		*r = sstl::move(tmp);
+	}
+}
+
+/**
+	Block partition after Edelkamp and Weiss, "BlockQuicksort: How Branch
+	Mispredictions don't affect Quicksort". Each side first classifies a
+	block of elements, storing the offsets of the misplaced ones with an
+	unconditional write and a conditional increment, and only then swaps
+	them. The comparisons never steer a branch, which pays off for cheap
+	comparisons of arithmetic types where a mispredicted branch costs more
+	than the comparison itself.
+*/
+template<class RandomIt, class Compare>
+RandomIt partition_right(RandomIt first, RandomIt last, Compare comp, true_type) {
+	typename iterator_traits<RandomIt>::value_type pivot(sstl::move(*first));
+	const RandomIt begin = first;
+
+	while (comp(*++first, pivot)) {}
+
+	if (first - 1 == begin) {
+		while (first < last && !comp(*--last, pivot)) {}
+	} else {
+		while (!comp(*--last, pivot)) {}
+	}
+
+	if (first < last) {
+		sstl::iter_swap(first, last);
+		++first;
+
+		unsigned char offsets_l[partition_block_size];
+		unsigned char offsets_r[partition_block_size];
+		RandomIt base_l = first;
+		RandomIt base_r = last;
+		size_t count_l = 0;
+		size_t count_r = 0;
+		size_t start_l = 0;
+		size_t start_r = 0;
+
+		while (first < last) {
+			/* Splits the unclassified elements between the sides whose offset blocks ran empty. */
+			const size_t unknown = size_t(last - first);
+			const size_t split_l = count_l == 0 ? (count_r == 0 ? unknown / 2 : unknown) : 0;
+			const size_t split_r = count_r == 0 ? unknown - split_l : 0;
+			const size_t block_l = split_l < partition_block_size ? split_l : partition_block_size;
+			const size_t block_r = split_r < partition_block_size ? split_r : partition_block_size;
+
+			for (size_t i = 0; i < block_l; ++i) {
+				offsets_l[count_l] = static_cast<unsigned char>(i);
+				count_l += !comp(*first, pivot);
+				++first;
+			}
+
+			for (size_t i = 0; i < block_r;) {
+				offsets_r[count_r] = static_cast<unsigned char>(++i);
+				count_r += comp(*--last, pivot);
+			}
+
+			const size_t count = count_l < count_r ? count_l : count_r;
+			swap_offsets(base_l, base_r, offsets_l + start_l, offsets_r + start_r, count, count_l == count_r);
+			count_l -= count;
+			count_r -= count;
+			start_l += count;
+			start_r += count;
+
+			if (count_l == 0) {
+				start_l = 0;
+				base_l = first;
+			}
+
+			if (count_r == 0) {
+				start_r = 0;
+				base_r = last;
+			}
+		}
+
+		/* One side still has misplaced elements, they move to the far end of the unpartitioned gap. */
+		if (count_l) {
+			while (count_l--) { sstl::iter_swap(base_l + offsets_l[start_l + count_l], --last); }
+
+			first = last;
+		}
+
+		if (count_r) {
+			while (count_r--) {
+				sstl::iter_swap(base_r - offsets_r[start_r + count_r], first);
+				++first;
+			}
+
+			last = first;
+		}
+	}
+
+	const RandomIt pivot_pos = first - 1;
+	*begin = sstl::move(*pivot_pos);
+	*pivot_pos = sstl::move(pivot);
+	return pivot_pos;
+}
+
+/**
+	Partitions [first, last) around the pivot at first, moving the elements
+	which compare equal to its left. Used when the pivot equals the element
+	before the range, so the whole left part is equal and needs no sorting.
+*/
+template<class RandomIt, class Compare>
+RandomIt partition_left(RandomIt first, RandomIt last, Compare comp) {
+	typename iterator_traits<RandomIt>::value_type pivot(sstl::move(*first));
+	const RandomIt begin = first;
+	const RandomIt end = last;
+
+	while (comp(pivot, *--last)) {}
+
+	if (last + 1 == end) {
+		while (first < last && !comp(pivot, *++first)) {}
+	} else {
+		while (!comp(pivot, *++first)) {}
+	}
+
+	while (first < last) {
+		sstl::iter_swap(first, last);
+
+		while (comp(pivot, *--last)) {}
+
+		while (!comp(pivot, *++first)) {}
+	}
+
+	*begin = sstl::move(*last);
+	*last = sstl::move(pivot);
+	return last;
+}
+
+/** Selects the branchless partition for arithmetic element types, whose comparisons are too cheap to branch on. */
+template<class RandomIt>
+struct use_branchless_partition :
+	public is_arithmetic<typename iterator_traits<RandomIt>::value_type>::type {};
+
+/** Recursion depth after which introsort gives up on quicksort, twice the base 2 logarithm of size. */
+inline size_t introsort_depth(size_t size) { return 2 * (size ? detail::highest_bit(uint64_t(size)) : 0); }
+
+/**
+	Quicksort with an insertion sort below insertion_sort_threshold and a
+	heapsort once depth runs out. Only the smaller part is sorted
+	recursively, so the stack stays logarithmic. Ranges which are not
+	leftmost have a sentinel before first, which allows unguarded scans.
+*/
+template<class RandomIt, class Compare>
+void introsort_loop(RandomIt first, RandomIt last, size_t depth, bool leftmost, Compare comp) {
+	typedef typename use_branchless_partition<RandomIt>::type branchless;
+
+	for (;;) {
+		if (last - first <= insertion_sort_threshold) {
+			if (leftmost) {
+				insertion_sort(first, last, comp);
+			} else {
+				unguarded_insertion_sort(first, last, comp);
+			}
+
+			return;
+		}
+
+		if (depth == 0) {
+			detail::make_heap(first, last, comp);
+			detail::sort_heap(first, last, comp);
+			return;
+		}
+
+		--depth;
+		move_median_to_first(first, last, comp);
+
+		if (!leftmost && !comp(*(first - 1), *first)) {
+			first = partition_left(first, last, comp) + 1;
+			continue;
+		}
+
+		const RandomIt pivot = partition_right(first, last, comp, branchless());
+
+		if (pivot - first < last - pivot) {
+			introsort_loop(first, pivot, depth, leftmost, comp);
+			first = pivot + 1;
+			leftmost = false;
+		} else {
+			introsort_loop(pivot + 1, last, depth, false, comp);
+			last = pivot;
+		}
+	}
+}
+
+/**
+	Merges the sorted ranges [first, middle) and [middle, last) of len1 and
+	len2 elements. Whichever range fits is moved to the buffer and merged
+	back in linear time. Otherwise the larger range is split at its middle,
+	the other at the matching bound, a rotation swaps the inner parts and
+	both halves are merged the same way, which needs no buffer at all.
+*/
+template<class RandomIt, typename T, class Compare>
+void merge_adaptive(RandomIt first, RandomIt middle, RandomIt last, size_t len1, size_t len2,
+                    T* buffer, size_t buffer_size, Compare comp) {
+	if (len1 == 0 || len2 == 0 || !comp(*middle, *(middle - 1))) { return; }
+
+	if (len1 <= buffer_size) {
+		T* const buffer_end = sstl::move(first, middle, buffer);
+		T* b = buffer;
+
+		for (; b != buffer_end && middle != last; ++first) {
+			if (comp(*middle, *b)) {
+				*first = sstl::move(*middle);
+				++middle;
+			} else {
+				*first = sstl::move(*b);
+				++b;
+			}
+		}
+
+		sstl::move(b, buffer_end, first);
+	} else if (len2 <= buffer_size) {
+		T* buffer_end = sstl::move(middle, last, buffer);
+
+		while (buffer != buffer_end && middle != first) {
+			if (comp(*(buffer_end - 1), *(middle - 1))) {
+				*--last = sstl::move(*--middle);
+			} else {
+				*--last = sstl::move(*--buffer_end);
+			}
+		}
+
+		sstl::move_backward(buffer, buffer_end, last);
+	} else if (len1 + len2 == 2) {
+		sstl::iter_swap(first, middle);
+	} else {
+		RandomIt cut1 = first;
+		RandomIt cut2 = middle;
+		size_t len11 = 0;
+		size_t len22 = 0;
+
+		if (len1 > len2) {
+			len11 = len1 / 2;
+			cut1 += len11;
+			cut2 = branchless_lower_bound(middle, len2, *cut1, comp);
+			len22 = size_t(cut2 - middle);
+		} else {
+			len22 = len2 / 2;
+			cut2 += len22;
+			cut1 = branchless_upper_bound(first, len1, *cut2, comp);
+			len11 = size_t(cut1 - first);
+		}
+
+		const RandomIt new_middle = sstl::rotate(cut1, middle, cut2);
+		merge_adaptive(first, cut1, new_middle, len11, len22, buffer, buffer_size, comp);
+		merge_adaptive(new_middle, cut2, last, len1 - len11, len2 - len22, buffer, buffer_size, comp);
+	}
+}
+
+/** Runs sorted by insertion sort before stable_sort starts merging. */
+const size_t stable_sort_run = 16;
+
+/** Bottom-up merge sort over runs of stable_sort_run elements, see merge_adaptive. */
+template<class RandomIt, typename T, class Compare>
+void stable_sort(RandomIt first, RandomIt last, T* buffer, size_t buffer_size, Compare comp) {
+	const size_t size = size_t(last - first);
+
+	for (size_t i = 0; i < size; i += stable_sort_run) {
+		insertion_sort(first + i, first + sstl::min(i + stable_sort_run, size), comp);
+	}
+
+	for (size_t width = stable_sort_run; width < size; width *= 2) {
+		for (size_t i = 0; i + width < size; i += 2 * width) {
+			const size_t len2 = sstl::min(width, size - i - width);
+			merge_adaptive(first + i, first + (i + width), first + (i + width + len2), width, len2,
+			               buffer, buffer_size, comp);
+		}
+	}
+}
+} /* namespace detail */
+
+/**
+	Sorts [first, last) in O(n log n) without allocating: an introsort with
+	median-of-three pivots, insertion sort for short ranges and a heapsort
+	fallback. Arithmetic element types are partitioned branchlessly.
+*/
+template<class RandomIt, class Compare>
+inline void sort(RandomIt first, RandomIt last, Compare comp) {
+	detail::introsort_loop(first, last, detail::introsort_depth(size_t(last - first)), true, comp);
+}
+
+/** Sorts [first, last) with operator<, see sort(first, last, comp). */
+template<class RandomIt>
+inline void sort(RandomIt first, RandomIt last) {
+	sstl::sort(first, last, sstl::less<typename iterator_traits<RandomIt>::value_type>());
+}
+
+/**
+	Sorts [first, last) keeping equal elements in order, with in-place
+	merges in O(n log^2 n) and no extra storage.
+*/
+template<class RandomIt, class Compare>
+inline void stable_sort(RandomIt first, RandomIt last, Compare comp) {
+	typedef typename iterator_traits<RandomIt>::value_type value_type;
+	detail::stable_sort(first, last, static_cast<value_type*>(0), 0, comp);
+}
+
+/** Stable sort with operator<, see stable_sort(first, last, comp). */
+template<class RandomIt>
+inline void stable_sort(RandomIt first, RandomIt last) {
+	sstl::stable_sort(first, last, sstl::less<typename iterator_traits<RandomIt>::value_type>());
+}
+
+/**
+	Stable sort which merges through buffer_size caller-provided elements
+	at buffer. Half the range's size makes every merge linear and the sort
+	O(n log n); smaller buffers fall back to in-place merges as needed.
+*/
+template<class RandomIt, typename T, class Compare>
+inline void stable_sort(RandomIt first, RandomIt last, T* buffer, size_t buffer_size, Compare comp) {
+	detail::stable_sort(first, last, buffer, buffer_size, comp);
+}
+
+/** Buffered stable sort with operator<, see stable_sort(first, last, buffer, buffer_size, comp). */
+template<class RandomIt, typename T>
+inline void stable_sort(RandomIt first, RandomIt last, T* buffer, size_t buffer_size) {
+	sstl::stable_sort(first, last, buffer, buffer_size, sstl::less<typename iterator_traits<RandomIt>::value_type>());
+}
+
+/**
+	Sorts the middle - first smallest elements of [first, last) into
+	[first, middle) with a heap selection, the rest is left in unspecified
+	order.
+*/
+template<class RandomIt, class Compare>
+inline void partial_sort(RandomIt first, RandomIt middle, RandomIt last, Compare comp) {
+	detail::heap_select(first, middle, last, comp);
+	detail::sort_heap(first, middle, comp);
+}
+
+/** Partial sort with operator<, see partial_sort(first, middle, last, comp). */
+template<class RandomIt>
+inline void partial_sort(RandomIt first, RandomIt middle, RandomIt last) {
+	sstl::partial_sort(first, middle, last, sstl::less<typename iterator_traits<RandomIt>::value_type>());
+}
+
+/**
+	Moves the element which belongs at nth in sorted order there, with no
+	greater element before it and no smaller one after it. Quickselect with
+	the partitions of sort in O(n) on average, falling back to a heap
+	selection when the partitions keep coming out unbalanced.
+*/
+template<class RandomIt, class Compare>
+void nth_element(RandomIt first, RandomIt nth, RandomIt last, Compare comp) {
+	typedef typename detail::use_branchless_partition<RandomIt>::type branchless;
+
+	if (nth == last) { return; }
+
+	const RandomIt begin = first;
+	size_t depth = detail::introsort_depth(size_t(last - first));
+
+	while (last - first > detail::insertion_sort_threshold) {
+		if (depth-- == 0) {
+			detail::heap_select(first, nth + 1, last, comp);
+			sstl::iter_swap(first, nth);
+			return;
+		}
+
+		detail::move_median_to_first(first, last, comp);
+
+		/* The pivot equals the element before the range, everything partitioned left of it is equal too. */
+		if (first != begin && !comp(*(first - 1), *first)) {
+			const RandomIt cut = detail::partition_left(first, last, comp);
+
+			if (nth <= cut) { return; }
+
+			first = cut + 1;
+			continue;
+		}
+
+		const RandomIt cut = detail::partition_right(first, last, comp, branchless());
+
+		if (cut == nth) { return; }
+
+		if (cut < nth) {
+			first = cut + 1;
+		} else {
+			last = cut;
+		}
+	}
+
+	detail::insertion_sort(first, last, comp);
+}
+
+/** Selects the nth element with operator<, see nth_element(first, nth, last, comp). */
+template<class RandomIt>
+inline void nth_element(RandomIt first, RandomIt nth, RandomIt last) {
+	sstl::nth_element(first, nth, last, sstl::less<typename iterator_traits<RandomIt>::value_type>());
+}
+
+/**
+	Moves the element at last - 1 into the max heap [first, last - 1), so
+	that [first, last) is a max heap. O(log n).
+*/
+template<class RandomIt, class Compare>
+inline void push_heap(RandomIt first, RandomIt last, Compare comp) {
+	typedef typename iterator_traits<RandomIt>::difference_type difference_type;
+	typedef typename iterator_traits<RandomIt>::value_type      value_type;
+
+	if (last - first < 2) { return; }
+
+	value_type val(sstl::move(*(last - 1)));
+	detail::push_heap(first, difference_type(last - first - 1), difference_type(0), sstl::move(val), comp);
+}
+
+/** Pushes onto a max heap with operator<, see push_heap(first, last, comp). */
+template<class RandomIt>
+inline void push_heap(RandomIt first, RandomIt last) {
+	sstl::push_heap(first, last, sstl::less<typename iterator_traits<RandomIt>::value_type>());
+}
+
+/**
+	Swaps the largest element of the max heap [first, last) to last - 1 and
+	makes [first, last - 1) a max heap again. O(log n), about log n
+	comparisons: the hole left by the top sinks to a leaf before the former
+	last element bubbles back up.
+*/
+template<class RandomIt, class Compare>
+inline void pop_heap(RandomIt first, RandomIt last, Compare comp) {
+	typedef typename iterator_traits<RandomIt>::difference_type difference_type;
+	typedef typename iterator_traits<RandomIt>::value_type      value_type;
+
+	if (last - first < 2) { return; }
+
+	--last;
+	value_type val(sstl::move(*last));
+	*last = sstl::move(*first);
+	detail::adjust_heap(first, difference_type(0), difference_type(last - first), sstl::move(val), comp);
+}
+
+/** Pops from a max heap with operator<, see pop_heap(first, last, comp). */
+template<class RandomIt>
+inline void pop_heap(RandomIt first, RandomIt last) {
+	sstl::pop_heap(first, last, sstl::less<typename iterator_traits<RandomIt>::value_type>());
+}
+
+/** Arranges [first, last) into a max heap in O(n). */
+template<class RandomIt, class Compare>
+inline void make_heap(RandomIt first, RandomIt last, Compare comp) {
+	detail::make_heap(first, last, comp);
+}
+
+/** Makes a max heap with operator<, see make_heap(first, last, comp). */
+template<class RandomIt>
+inline void make_heap(RandomIt first, RandomIt last) {
+	sstl::make_heap(first, last, sstl::less<typename iterator_traits<RandomIt>::value_type>());
+}
+
+/** Turns the max heap [first, last) into a range sorted in ascending order. */
+template<class RandomIt, class Compare>
+inline void sort_heap(RandomIt first, RandomIt last, Compare comp) {
+	detail::sort_heap(first, last, comp);
+}
+
+/** Sorts a max heap with operator<, see sort_heap(first, last, comp). */
+template<class RandomIt>
+inline void sort_heap(RandomIt first, RandomIt last) {
+	sstl::sort_heap(first, last, sstl::less<typename iterator_traits<RandomIt>::value_type>());
+}
+
+/** Returns the end of the longest prefix of [first, last) which is a max heap. */
+template<class RandomIt, class Compare>
+inline RandomIt is_heap_until(RandomIt first, RandomIt last, Compare comp) {
+	typedef typename iterator_traits<RandomIt>::difference_type difference_type;
+
+	const difference_type len = last - first;
+
+	for (difference_type child = 1; child < len; ++child) {
+		if (comp(first[(child - 1) / 2], first[child])) { return first + child; }
+	}
+
+	return last;
+}
+
+/** Finds the end of a max heap with operator<, see is_heap_until(first, last, comp). */
+template<class RandomIt>
+inline RandomIt is_heap_until(RandomIt first, RandomIt last) {
+	return sstl::is_heap_until(first, last, sstl::less<typename iterator_traits<RandomIt>::value_type>());
+}
+
+/** Checks whether [first, last) is a max heap. */
+template<class RandomIt, class Compare>
+inline bool is_heap(RandomIt first, RandomIt last, Compare comp) {
+	return sstl::is_heap_until(first, last, comp) == last;
+}
+
+/** Checks for a max heap with operator<, see is_heap(first, last, comp). */
+template<class RandomIt>
+inline bool is_heap(RandomIt first, RandomIt last) {
+	return sstl::is_heap_until(first, last) == last;
+}
+
+namespace detail {
+/**
+	Returns key as an unsigned value of the same order, so its bytes can be
+	sorted as unsigned digits: the sign bit of signed keys is flipped.
+*/
+template<typename K>
+inline uint64_t radix_bits(K key) {
+	typedef typename enable_if<is_integral<K>::value, uint64_t>::type bits;
+	const uint64_t value = bits(key) & (~uint64_t(0) >> (64 - sizeof(K) * 8));
+	return is_signed<K>::value ? value ^ (uint64_t(1) << (sizeof(K) * 8 - 1)) : value;
+}
+
+/** Returns the number of byte digits of a key. */
+template<typename K>
+inline size_t radix_digits(K) { return sizeof(K); }
+
+/** Key extractor of radix_sort for integral elements, which are their own keys. */
+struct radix_identity {
+	template<typename T>
+	const T& operator()(const T& value) const { return value; }
+};
+
+/** Orders elements by the keys a radix_sort key extractor returns. */
+template<class Key>
+struct radix_key_less {
+	explicit radix_key_less(Key k) : key(k) {}
+
+	template<typename T>
+	bool operator()(const T& a, const T& b) const { return radix_bits(key(a)) < radix_bits(key(b)); }
+
+	Key key;
+};
+
+/** Moves count elements from src to dst, each to the next free slot of its digit's bucket. */
+template<class InputIt, class OutputIt, class Key>
+inline void radix_scatter(InputIt src, size_t count, OutputIt dst, uint32_t* offsets, size_t shift, Key key) {
+	for (size_t i = 0; i < count; ++i) {
+		dst[offsets[(radix_bits(key(src[i])) >> shift) & 0xff]++] = sstl::move(src[i]);
+	}
+}
+
+/** Ranges up to this size are insertion sorted, which beats clearing and summing histograms. */
+const size_t radix_sort_threshold = 64;
+
+/**
+	LSD radix sort of count elements by their keys, one byte per pass. A
+	first read of the keys finds the bytes which are the same in every key,
+	whose passes are skipped. They would also turn the histogram counts into
+	one long chain of increments of the same bucket. A second read builds
+	the histograms of the remaining bytes. The passes alternate between the
+	range and buffer, an odd number of them ends with a move back.
+*/
+template<class RandomIt, typename T, class Key>
+void radix_sort(RandomIt first, size_t count, T* buffer, Key key) {
+	if (count <= radix_sort_threshold) {
+		insertion_sort(first, first + count, radix_key_less<Key>(key));
+		return;
+	}
+
+	const size_t digits = radix_digits(key(*first));
+	const uint64_t first_bits = radix_bits(key(*first));
+	uint64_t varying = 0;
+
+	for (size_t i = 1; i < count; ++i) { varying |= radix_bits(key(first[i])) ^ first_bits; }
+
+	size_t shifts[sizeof(uint64_t)];
+	size_t passes = 0;
+
+	for (size_t d = 0; d < digits; ++d) {
+		if ((varying >> (d * 8)) & 0xff) { shifts[passes++] = d * 8; }
+	}
+
+	uint32_t histogram[sizeof(uint64_t)][256];
+	memset(histogram, 0, passes * sizeof(histogram[0]));
+
+	for (size_t i = 0; i < count; ++i) {
+		const uint64_t bits = radix_bits(key(first[i]));
+
+		for (size_t p = 0; p < passes; ++p) { ++histogram[p][(bits >> shifts[p]) & 0xff]; }
+	}
+
+	for (size_t p = 0; p < passes; ++p) {
+		uint32_t* offsets = histogram[p];
+
+		for (uint32_t b = 0, sum = 0; b < 256; ++b) {
+			const uint32_t bucket = offsets[b];
+			offsets[b] = sum;
+			sum += bucket;
+		}
+
+		if (p % 2) {
+			radix_scatter(buffer, count, first, offsets, shifts[p], key);
+		} else {
+			radix_scatter(first, count, buffer, offsets, shifts[p], key);
+		}
+	}
+
+	if (passes % 2) { sstl::move(buffer, buffer + count, first); }
+}
+} /* namespace detail */
+
+/**
+	Sorts [first, last) of integral elements with a stable LSD radix sort in
+	O(n) time, using buffer for at least last - first elements as scratch
+	space. Ranges are limited to 2^32 - 1 elements.
+*/
+template<class RandomIt, typename T>
+inline typename enable_if<is_integral<typename iterator_traits<RandomIt>::value_type>::value>::type
+radix_sort(RandomIt first, RandomIt last, T* buffer) {
+	detail::radix_sort(first, size_t(last - first), buffer, detail::radix_identity());
+}
+
+/**
+	Radix sort of [first, last) by the integral key that key returns for
+	each element, see radix_sort(first, last, buffer).
+*/
+template<class RandomIt, typename T, class Key>
+inline void radix_sort(RandomIt first, RandomIt last, T* buffer, Key key) {
+	detail::radix_sort(first, size_t(last - first), buffer, key);
+}
+
+/**
+	Radix sort with scratch space for N elements on the stack. Longer ranges
+	are merge sorted through the same space instead, see stable_sort.
+*/
+template<size_t N, class RandomIt>
+inline typename enable_if<is_integral<typename iterator_traits<RandomIt>::value_type>::value>::type
+radix_sort(RandomIt first, RandomIt last) {
+	typedef typename iterator_traits<RandomIt>::value_type value_type;
+	value_type buffer[N];
+
+	if (size_t(last - first) <= N) {
+		detail::radix_sort(first, size_t(last - first), buffer, detail::radix_identity());
+	} else {
+		sstl::stable_sort(first, last, buffer, N, sstl::less<value_type>());
+	}
+}
+
+/** Radix sort by key with scratch space for N elements on the stack, see radix_sort(first, last). */
+template<size_t N, class RandomIt, class Key>
+inline void radix_sort(RandomIt first, RandomIt last, Key key) {
+	typename iterator_traits<RandomIt>::value_type buffer[N];
+
+	if (size_t(last - first) <= N) {
+		detail::radix_sort(first, size_t(last - first), buffer, key);
+	} else {
+		sstl::stable_sort(first, last, buffer, N, detail::radix_key_less<Key>(key));
+	}
+}
+
+namespace detail {
+/** Compares with operator< on whatever types it is given, so searches need not convert val or the elements. */
+struct operator_less {
+	template<typename T, typename U>
+	bool operator()(const T& lhs, const U& rhs) const { return lhs < rhs; }
+};
+
+/** Halves [first, last) by stepping through it, for iterators which cannot jump. */
+template<class ForwardIt, typename T, class Compare>
+ForwardIt lower_bound(ForwardIt first, ForwardIt last, const T& val, Compare comp,
+                      forward_iterator_tag) {
+	typename iterator_traits<ForwardIt>::difference_type count = sstl::distance(first, last);
+
+	while (count > 0) {
+		const typename iterator_traits<ForwardIt>::difference_type half = count / 2;
+		ForwardIt middle = first;
+		sstl::advance(middle, half);
+
+		if (comp(*middle, val)) {
+			first = ++middle;
+			count -= half + 1;
+		} else {
+			count = half;
+		}
+	}
+
+	return first;
+}
+template<class RandomIt, typename T, class Compare>
+inline RandomIt lower_bound(RandomIt first, RandomIt last, const T& val, Compare comp,
+                            random_access_iterator_tag) {
+	return branchless_lower_bound(first, size_t(last - first), val, comp);
+}
+
+template<class ForwardIt, typename T, class Compare>
+ForwardIt upper_bound(ForwardIt first, ForwardIt last, const T& val, Compare comp,
+                      forward_iterator_tag) {
+	typename iterator_traits<ForwardIt>::difference_type count = sstl::distance(first, last);
+
+	while (count > 0) {
+		const typename iterator_traits<ForwardIt>::difference_type half = count / 2;
+		ForwardIt middle = first;
+		sstl::advance(middle, half);
+
+		if (!comp(val, *middle)) {
+			first = ++middle;
+			count -= half + 1;
+		} else {
+			count = half;
+		}
+	}
+
+	return first;
+}
+template<class RandomIt, typename T, class Compare>
+inline RandomIt upper_bound(RandomIt first, RandomIt last, const T& val, Compare comp,
+                            random_access_iterator_tag) {
+	return branchless_upper_bound(first, size_t(last - first), val, comp);
+}
+} /* namespace detail */
+
+/**
+	Returns the first element of the sorted range [first, last) which does
+	not compare less than val. Random access ranges are searched without
+	branches, see detail::branchless_lower_bound.
+*/
+template<class ForwardIt, typename T, class Compare>
+inline ForwardIt lower_bound(ForwardIt first, ForwardIt last, const T& val, Compare comp) {
+	typedef typename iterator_traits<ForwardIt>::iterator_category category;
+	return detail::lower_bound(first, last, val, comp, category());
+}
+
+/** Lower bound with operator<, see lower_bound(first, last, val, comp). */
+template<class ForwardIt, typename T>
+inline ForwardIt lower_bound(ForwardIt first, ForwardIt last, const T& val) {
+	return sstl::lower_bound(first, last, val, detail::operator_less());
+}
+
+/** Returns the first element of the sorted range [first, last) which compares greater than val. */
+template<class ForwardIt, typename T, class Compare>
+inline ForwardIt upper_bound(ForwardIt first, ForwardIt last, const T& val, Compare comp) {
+	typedef typename iterator_traits<ForwardIt>::iterator_category category;
+	return detail::upper_bound(first, last, val, comp, category());
+}
+
+/** Upper bound with operator<, see upper_bound(first, last, val, comp). */
+template<class ForwardIt, typename T>
+inline ForwardIt upper_bound(ForwardIt first, ForwardIt last, const T& val) {
+	return sstl::upper_bound(first, last, val, detail::operator_less());
+}
+
+/** Returns the subrange of the sorted range [first, last) whose elements are equivalent to val. */
+template<class ForwardIt, typename T, class Compare>
+inline pair<ForwardIt, ForwardIt> equal_range(ForwardIt first, ForwardIt last, const T& val,
+                                              Compare comp) {
+	first = sstl::lower_bound(first, last, val, comp);
+	return pair<ForwardIt, ForwardIt>(first, sstl::upper_bound(first, last, val, comp));
+}
+
+/** Equal range with operator<, see equal_range(first, last, val, comp). */
+template<class ForwardIt, typename T>
+inline pair<ForwardIt, ForwardIt> equal_range(ForwardIt first, ForwardIt last, const T& val) {
+	return sstl::equal_range(first, last, val, detail::operator_less());
+}
+
+/** Checks whether the sorted range [first, last) has an element equivalent to val. */
+template<class ForwardIt, typename T, class Compare>
+inline bool binary_search(ForwardIt first, ForwardIt last, const T& val, Compare comp) {
+	first = sstl::lower_bound(first, last, val, comp);
+	return first != last && !comp(val, *first);
+}
+
+/** Binary search with operator<, see binary_search(first, last, val, comp). */
+template<class ForwardIt, typename T>
+inline bool binary_search(ForwardIt first, ForwardIt last, const T& val) {
+	return sstl::binary_search(first, last, val, detail::operator_less());
 }
 
 } /* namespace sstl */
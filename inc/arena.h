@@ -0,0 +1,200 @@
+#ifndef STATIC_STL_ARENA_H_
+#define STATIC_STL_ARENA_H_
+
+#include <new>
+
+#if __cplusplus >= 201703 && defined(__has_include)
+#	if __has_include(<memory_resource>)
+#		include <memory_resource>
+#		define SSTL_HAS_MEMORY_RESOURCE 1
+#	endif
+#endif
+
+#include "array.h"
+#include "type_traits.h"
+
+namespace sstl {
+
+namespace detail {
+/** Alignment of the most aligned fundamental type, arena storage and default allocations use it. */
+const size_t max_alignment = alignment_of<aligned_pod<0>::type>::value;
+
+/**
+	Passes on a successful allocation. A failed one throws std::bad_alloc,
+	as std allocators must, unless exceptions are disabled.
+*/
+inline void* checked_allocation(void* p) {
+#if defined(__cpp_exceptions) || defined(__EXCEPTIONS)
+	if (!p) { throw std::bad_alloc(); }
+#endif
+	return p;
+}
+} /* namespace detail */
+
+/**
+	Monotonic buffer of N bytes. Allocation bumps an offset past the
+	aligned request, so it costs a few instructions and never searches.
+	Memory is given back all at once by release(), or back to a mark().
+*/
+template<size_t N = 0>
+class arena;
+
+/** Common base class for all arenas. */
+template<>
+class arena<> {
+  public:
+	typedef size_t                   size_type;
+	/** Position in an arena returned by mark(), which rewind() releases back to. */
+	typedef detail::stored_size_type marker;
+
+	/**
+		Allocates bytes aligned to alignment, which must be a power of two.
+		Returns null if the rest of the arena is too small.
+	*/
+	void* allocate(size_type bytes, size_type alignment = detail::max_alignment);
+	/**
+		Gives the most recent allocation back to the arena. Memory of any
+		other allocation is only reclaimed by rewind() or release().
+	*/
+	void deallocate(void* p, size_type bytes);
+
+	/** Returns the current position, allocations made after it are freed by rewind(). */
+	marker mark() const;
+	/** Frees every allocation made since m was taken. */
+	void rewind(marker m);
+	/** Frees every allocation in O(1). */
+	void release() { rewind(0); }
+
+	/** Checks whether p points into the arena's storage. */
+	bool owns(const void* p) const;
+
+	/** Checks whether nothing is allocated. */
+	bool empty() const { return size() == 0; }
+	/** Returns the number of bytes in use, including alignment padding. */
+	size_type size() const;
+	/** Returns the number of bytes not yet handed out. */
+	size_type available() const { return max_size() - size(); }
+	/** Returns the size of the arena's storage in bytes. */
+	size_type max_size() const;
+
+  protected:
+	SSTL_CONSTEXPR arena() {}
+	~arena() {}
+
+  private:
+#if __cplusplus >= 201103
+	arena(const arena&) = delete;
+	arena& operator=(const arena&) = delete;
+#else
+	arena(const arena&);
+	arena& operator=(const arena&);
+#endif
+
+	unsigned char* data();
+	const unsigned char* data() const;
+};
+
+/** Child class with size-specific storage. */
+template<size_t N>
+class arena : public arena<> {
+	friend class arena<>;
+	typedef arena<> base;
+
+  public:
+	/** Default constructor, a constant initializer for arenas with static storage. */
+	SSTL_CONSTEXPR arena() : base(), capacity_(N), offset_(0), storage_() {}
+
+	/** Returns the size of the arena's storage in bytes. */
+	SSTL_CONSTEXPR14 size_t max_size() const { return N; }
+
+  private:
+	typedef typename detail::check_capacity<N>::type capacity_fits;
+
+	detail::stored_size_type capacity_;
+	/** Offset of the first byte not yet handed out. */
+	detail::stored_size_type offset_;
+
+	/**
+		Byte storage, wrapped so a constexpr constructor can initialize the
+		empty member instead, which leaves every byte untouched.
+	*/
+	union storage {
+		struct empty {};
+
+		SSTL_CONSTEXPR storage() : empty_() {}
+
+		empty empty_;
+		typename aligned_storage<N, detail::max_alignment>::type data_;
+	} storage_;
+};
+
+/* The members are defined here since they need the complete child class. */
+
+inline unsigned char* arena<>::data() { return static_cast<arena<8>*>(this)->storage_.data_.data_; }
+inline const unsigned char* arena<>::data() const {
+	return static_cast<const arena<8>*>(this)->storage_.data_.data_;
+}
+
+inline arena<>::size_type arena<>::size() const { return static_cast<const arena<8>*>(this)->offset_; }
+inline arena<>::size_type arena<>::max_size() const { return static_cast<const arena<8>*>(this)->capacity_; }
+
+inline void* arena<>::allocate(size_type bytes, size_type alignment) {
+	/* Aligns the address rather than the offset, so alignments beyond the storage's own also work. */
+	const uintptr_t top = reinterpret_cast<uintptr_t>(data()) + size();
+	const size_type begin = size() + size_type(((top + alignment - 1) & ~uintptr_t(alignment - 1)) - top);
+
+	if (begin > max_size() || max_size() - begin < bytes) { return 0; }
+
+	static_cast<arena<8>*>(this)->offset_ = detail::stored_size_type(begin + bytes);
+	return data() + begin;
+}
+
+inline void arena<>::deallocate(void* p, size_type bytes) {
+	unsigned char* const bytes_begin = static_cast<unsigned char*>(p);
+
+	if (owns(p) && bytes_begin + bytes == data() + size()) {
+		static_cast<arena<8>*>(this)->offset_ = detail::stored_size_type(bytes_begin - data());
+	}
+}
+
+inline arena<>::marker arena<>::mark() const { return marker(size()); }
+
+inline void arena<>::rewind(marker m) {
+	if (m < size()) { static_cast<arena<8>*>(this)->offset_ = m; }
+}
+
+inline bool arena<>::owns(const void* p) const {
+	const unsigned char* byte = static_cast<const unsigned char*>(p);
+	return byte >= data() && byte < data() + max_size();
+}
+
+#ifdef SSTL_HAS_MEMORY_RESOURCE
+/**
+	Polymorphic memory resource which serves std::pmr containers from an
+	arena. Exhausting the arena throws std::bad_alloc.
+*/
+class arena_resource : public std::pmr::memory_resource {
+  public:
+	explicit arena_resource(arena<>& a) : arena_(&a) {}
+
+	/** Returns the arena allocations are served from. */
+	arena<>& get_arena() const { return *arena_; }
+
+  private:
+	void* do_allocate(size_t bytes, size_t alignment) override {
+		return detail::checked_allocation(arena_->allocate(bytes, alignment));
+	}
+	void do_deallocate(void* p, size_t bytes, size_t) override { arena_->deallocate(p, bytes); }
+	/** Resources are interchangeable if they share an arena. */
+	bool do_is_equal(const std::pmr::memory_resource& other) const noexcept override {
+		const arena_resource* rhs = dynamic_cast<const arena_resource*>(&other);
+		return rhs && rhs->arena_ == arena_;
+	}
+
+	arena<>* arena_;
+};
+#endif
+
+} /* namespace sstl */
+
+#endif /* STATIC_STL_ARENA_H_ */
@@ -3,9 +3,28 @@
 
 #include "algorithm.h"
 #include "iterator.h"
+#include "type_traits.h"
 
 namespace sstl {
 
+namespace detail {
+/**
+	Unsigned type the containers use to store their capacity and size. It sits
+	at a fixed offset so the size-erased bases can read it without knowing N,
+	which rules out picking a width per N; 32 bits fits any practical static
+	container while halving the metadata on 64-bit targets.
+*/
+typedef conditional < (sizeof(size_t) < sizeof(uint32_t)),
+        size_t, uint32_t >::type stored_size_type;
+
+/** Gives a compilation error if N does not fit in stored_size_type. */
+template<size_t N>
+struct check_capacity {
+	typedef typename
+	enable_if < (N <= size_t(stored_size_type(-1))) >::type type;
+};
+} /* namespace detail */
+
 /** Basic fixed-size array class. */
 template<typename T, size_t N = 0>
 class array;
@@ -30,16 +49,16 @@ class array<T> {
 
 	/** Copy assignment operator. */
 	array& operator=(const array& rhs) {
-		fill(copy_n(rhs.begin(),
-		            min(rhs.size(), size()),
+		sstl::fill(sstl::copy_n(rhs.begin(),
+		            sstl::min(rhs.size(), size()),
 		            begin()), end(), value_type());
 		return *this;
 	}
 	/** Copy assignment operator for compatible array. */
 	template<typename T2>
 	array& operator=(const array<T2>& rhs) {
-		fill(copy_n(rhs.begin(),
-		            min(rhs.size(), size()),
+		sstl::fill(sstl::copy_n(rhs.begin(),
+		            sstl::min(rhs.size(), size()),
 		            begin()), end(), value_type());
 		return *this;
 	}
@@ -92,8 +111,12 @@ class array<T> {
 	size_type max_size() const { return size(); }
 
   protected:
-	array() {}
+	SSTL_CONSTEXPR array() {}
+#if __cplusplus >= 201103
+	~array() = default;
+#else
 	~array() {}
+#endif
 };
 
 /** Child class with size-specific storage for the underlying array. */
@@ -115,43 +138,109 @@ class array : public array<T> {
 	typedef typename base::reverse_iterator       reverse_iterator;
 	typedef typename base::const_reverse_iterator const_reverse_iterator;
 
-	/** Default constructor. */
-	array() : capacity_(N) { fill_n(data_, N, value_type()); }
+	/** Default constructor, value-initializes every element. */
+	SSTL_CONSTEXPR array() : base(), capacity_(N), data_() {}
+#if __cplusplus >= 201103
+	/** Copy constructor. */
+	array(const array& other) = default;
+	/** Move constructor. */
+	array(array&& other) = default;
+	/** Element-wise constructor, any trailing elements are value-initialized. */
+	template<typename... Args>
+	SSTL_CONSTEXPR array(const_reference first, const_reference second,
+	                     const Args&... rest)
+		: base(), capacity_(N), data_{first, second, value_type(rest)...} {}
+#else
 	/** Copy constructor. */
-	array(const array& other) : capacity_(N) { copy_n(other.begin(), N, data_); }
+	array(const array& other) : capacity_(N) { sstl::copy_n(other.begin(), N, data_); }
+#endif
 	/** Construct from a compatible array. */
 	template<typename T2>
 	array(const array<T2>& other) : capacity_(N) {
-		fill(copy_n(other.begin(), min(other.size(), N), data_),
+		sstl::fill(sstl::copy_n(other.begin(), sstl::min(other.size(), N), data_),
 		     base::end(),
 		     value_type());
 	}
+	/** Default-initializing constructor, trivial elements are left uninitialized. */
+	explicit array(default_init_t) : capacity_(N) {}
 	/** Initialized constructor. */
-	explicit array(const_reference val) : capacity_(N) { fill_n(data_, N, val); }
+	explicit array(const_reference val) : capacity_(N) { sstl::fill_n(data_, N, val); }
 
 	/** Copy assignment operator. */
 	array& operator=(const array& rhs) {
-		copy_n(rhs.begin(), N, data_);
+		sstl::copy_n(rhs.begin(), N, data_);
 		return *this;
 	}
+#if __cplusplus >= 201103
+	/** Move assignment operator. */
+	array& operator=(array&& rhs) {
+		sstl::move(rhs.begin(), rhs.end(), data_);
+		return *this;
+	}
+#endif
 	/** Copy assignment operator for compatible array. */
 	template<typename T2>
 	array& operator=(const array<T2>& rhs) {
-		fill(copy_n(rhs.begin(), min(rhs.size(), N), data_),
+		sstl::fill(sstl::copy_n(rhs.begin(), sstl::min(rhs.size(), N), data_),
 		     base::end(),
 		     value_type());
 		return *this;
 	}
 
+	/*
+	 * The accessors below shadow the base class ones with N known at compile
+	 * time. The base can only reach the storage through a cast to a fixed
+	 * size, which is never allowed in a constant expression.
+	 */
+
+	/** Random access operator. */
+	SSTL_CONSTEXPR14 reference operator[](size_type pos) { return data_[pos]; }
+	SSTL_CONSTEXPR const_reference operator[](size_type pos) const { return data_[pos]; }
+
+	/** Access element at pos with bounds checking. */
+	SSTL_CONSTEXPR14 reference at(size_type pos) { return data_[pos % N]; }
+	SSTL_CONSTEXPR const_reference at(size_type pos) const { return data_[pos % N]; }
+
+	/** Access the first element. */
+	SSTL_CONSTEXPR14 reference front() { return data_[0]; }
+	SSTL_CONSTEXPR const_reference front() const { return data_[0]; }
+
+	/** Access the last element. */
+	SSTL_CONSTEXPR14 reference back() { return data_[N - 1]; }
+	SSTL_CONSTEXPR const_reference back() const { return data_[N - 1]; }
+
+	/** Access the underlying array pointer. */
+	SSTL_CONSTEXPR14 pointer data() { return data_; }
+	SSTL_CONSTEXPR const_pointer data() const { return data_; }
+
+	/** Returns an iterator to the first element in the array. */
+	SSTL_CONSTEXPR14 iterator begin() { return data_; }
+	SSTL_CONSTEXPR const_iterator begin() const { return data_; }
+	SSTL_CONSTEXPR const_iterator cbegin() const { return data_; }
+
+	/** Returns an iterator to the invalid element immediately following the array. */
+	SSTL_CONSTEXPR14 iterator end() { return data_ + N; }
+	SSTL_CONSTEXPR const_iterator end() const { return data_ + N; }
+	SSTL_CONSTEXPR const_iterator cend() const { return data_ + N; }
+
+	/** Checks whether the container has no elements. */
+	SSTL_CONSTEXPR bool empty() const { return false; }
+	/** Returns the number of elements in the container. */
+	SSTL_CONSTEXPR size_type size() const { return N; }
+	/** Returns the maximum possible number of elements. */
+	SSTL_CONSTEXPR size_type max_size() const { return N; }
+
   private:
-	size_type capacity_;
+	typedef typename detail::check_capacity<N>::type capacity_fits;
+
+	detail::stored_size_type capacity_;
 	value_type data_[N];
 };
 
 template<typename T>
 inline bool operator==(const array<T>& lhs, const array<T>& rhs) {
 	return lhs.size() == rhs.size() &&
-	       equal(lhs.cbegin(), lhs.cend(), rhs.cbegin());
+	       sstl::equal(lhs.cbegin(), lhs.cend(), rhs.cbegin());
 }
 
 template<typename T>
@@ -161,7 +250,7 @@ inline bool operator!=(const array<T>& lhs, const array<T>& rhs) {
 
 template<typename T>
 inline bool operator<(const array<T>& lhs, const array<T>& rhs) {
-	return lexicographical_compare(lhs.cbegin(), lhs.cend(),
+	return sstl::lexicographical_compare(lhs.cbegin(), lhs.cend(),
 	                               rhs.cbegin(), rhs.cend());
 }
 
@@ -0,0 +1,808 @@
+#ifndef STATIC_STL_BASIC_STRING_H_
+#define STATIC_STL_BASIC_STRING_H_
+
+#include <string.h>
+
+#include "algorithm.h"
+#include "array.h"
+#include "iterator.h"
+#include "type_traits.h"
+
+#if SSTL_HAS_SSE2
+#include <emmintrin.h>
+#endif
+
+namespace sstl {
+
+/**
+	Basic operations on character sequences used by basic_string. Copies are
+	block copies for every character type, the char specialization also maps
+	searches and comparisons onto the C library's vectorized memchr and memcmp.
+*/
+template<typename CharT>
+struct char_traits {
+	typedef CharT char_type;
+
+	/** Returns the length of the null terminated sequence s. */
+	static size_t length(const char_type* s) {
+		size_t count = 0;
+
+		for (; s[count] != char_type(); ++count) {}
+
+		return count;
+	}
+	/** Lexicographically compares count characters, returns a negative, zero or positive value. */
+	static int compare(const char_type* a, const char_type* b, size_t count) {
+		for (; count; --count, ++a, ++b) {
+			if (*a < *b) { return -1; }
+			if (*b < *a) { return 1; }
+		}
+
+		return 0;
+	}
+	/** Returns a pointer to the first ch within count characters of s, or null. */
+	static const char_type* find(const char_type* s, size_t count, char_type ch) {
+		for (; count; --count, ++s) {
+			if (*s == ch) { return s; }
+		}
+
+		return 0;
+	}
+	/** Copies count characters, the ranges must not overlap. */
+	static char_type* copy(char_type* dest, const char_type* src, size_t count) {
+		if (count) { memcpy(dest, src, count * sizeof(char_type)); }
+
+		return dest;
+	}
+	/** Copies count characters, the ranges may overlap. */
+	static char_type* move(char_type* dest, const char_type* src, size_t count) {
+		if (count) { memmove(dest, src, count * sizeof(char_type)); }
+
+		return dest;
+	}
+	/** Sets count characters to ch. */
+	static char_type* assign(char_type* dest, size_t count, char_type ch) {
+		sstl::fill_n(dest, count, ch);
+		return dest;
+	}
+};
+
+template<>
+struct char_traits<char> {
+	typedef char char_type;
+
+	static size_t length(const char_type* s) { return strlen(s); }
+	static int compare(const char_type* a, const char_type* b, size_t count) {
+		return count ? memcmp(a, b, count) : 0;
+	}
+	static const char_type* find(const char_type* s, size_t count, char_type ch) {
+		return count ? static_cast<const char_type*>(memchr(s, ch, count)) : 0;
+	}
+	static char_type* copy(char_type* dest, const char_type* src, size_t count) {
+		if (count) { memcpy(dest, src, count); }
+
+		return dest;
+	}
+	static char_type* move(char_type* dest, const char_type* src, size_t count) {
+		if (count) { memmove(dest, src, count); }
+
+		return dest;
+	}
+	static char_type* assign(char_type* dest, size_t count, char_type ch) {
+		if (count) { memset(dest, ch, count); }
+
+		return dest;
+	}
+};
+
+namespace detail {
+/** Returns a pointer to the last ch within count characters of s, or null. */
+template<typename CharT>
+inline const CharT* find_last(const CharT* s, size_t count, CharT ch) {
+	while (count) {
+		if (s[--count] == ch) { return s + count; }
+	}
+
+	return 0;
+}
+
+#if SSTL_HAS_SSE2
+/*
+ * The scans only load whole groups while at least 16 characters are left,
+ * but GCC cannot see that a string shorter than a group never gets there,
+ * and flags the load when the string's storage is smaller than 16 bytes.
+ */
+#if defined(__GNUC__) && !defined(__clang__)
+#  pragma GCC diagnostic push
+#  pragma GCC diagnostic ignored "-Warray-bounds"
+#endif
+/** Loads 16 characters, which may be unaligned. */
+inline __m128i load_group(const char* s) { return _mm_loadu_si128(reinterpret_cast<const __m128i*>(s)); }
+#if defined(__GNUC__) && !defined(__clang__)
+#  pragma GCC diagnostic pop
+#endif
+#endif
+
+/** Scans 16 characters at a time from the back, there is no portable memrchr. */
+inline const char* find_last(const char* s, size_t count, char ch) {
+#if SSTL_HAS_SSE2
+	const __m128i needle = _mm_set1_epi8(ch);
+
+	for (; count >= 16; count -= 16) {
+		const __m128i group = load_group(s + count - 16);
+		const uint32_t bits = uint32_t(_mm_movemask_epi8(_mm_cmpeq_epi8(group, needle)));
+
+		if (bits) { return s + count - 16 + highest_bit(bits); }
+	}
+#endif
+	while (count) {
+		if (s[--count] == ch) { return s + count; }
+	}
+
+	return 0;
+}
+
+/** Returns a pointer to the first of count characters of s which is one of the set_count characters of set, or null. */
+template<typename CharT>
+inline const CharT* find_first_of(const CharT* s, size_t count, const CharT* set, size_t set_count) {
+	for (; count; --count, ++s) {
+		if (char_traits<CharT>::find(set, set_count, *s)) { return s; }
+	}
+
+	return 0;
+}
+
+/** Set of bytes, one bit each, so membership is a single lookup whatever the size of the set. */
+class byte_set {
+  public:
+	byte_set(const char* set, size_t count) {
+		memset(bits_, 0, sizeof(bits_));
+
+		for (; count; --count, ++set) {
+			const uint8_t byte = uint8_t(*set);
+			bits_[byte >> 5] |= uint32_t(1) << (byte & 31);
+		}
+	}
+
+	bool contains(char ch) const {
+		const uint8_t byte = uint8_t(ch);
+		return (bits_[byte >> 5] >> (byte & 31)) & 1;
+	}
+
+  private:
+	uint32_t bits_[8];
+};
+
+/** Sets of up to this many characters are matched 16 characters at a time, larger ones through a byte_set. */
+const size_t find_first_of_group_limit = 4;
+
+inline const char* find_first_of(const char* s, size_t count, const char* set, size_t set_count) {
+	if (set_count == 1) { return char_traits<char>::find(s, count, *set); }
+
+	const char* const last = s + count;
+#if SSTL_HAS_SSE2
+	if (set_count <= find_first_of_group_limit) {
+		__m128i needles[find_first_of_group_limit];
+
+		for (size_t i = 0; i < set_count; ++i) { needles[i] = _mm_set1_epi8(set[i]); }
+
+		for (; last - s >= 16; s += 16) {
+			const __m128i group = load_group(s);
+			__m128i hits = _mm_cmpeq_epi8(group, needles[0]);
+
+			for (size_t i = 1; i < set_count; ++i) {
+				hits = _mm_or_si128(hits, _mm_cmpeq_epi8(group, needles[i]));
+			}
+
+			const uint32_t bits = uint32_t(_mm_movemask_epi8(hits));
+
+			if (bits) { return s + lowest_bit(bits); }
+		}
+	}
+#endif
+	const byte_set members(set, set_count);
+
+	for (; s != last; ++s) {
+		if (members.contains(*s)) { return s; }
+	}
+
+	return 0;
+}
+
+/**
+	Has the member typedef type R if It is one of the iterator types of a
+	string of CharT. Overloads taking an iterator position use it, so a
+	literal 0 picks the overload taking an index instead of a null iterator.
+*/
+template<typename It, typename CharT, typename R>
+struct if_string_iterator :
+	public enable_if < is_same<It, CharT*>::value || is_same<It, const CharT*>::value, R > {};
+} /* namespace detail */
+
+/**
+	Sequence of characters with fixed capacity. The characters are always
+	followed by a null terminator, so c_str() is free. Like vector,
+	operations which would grow the string past its capacity are truncated.
+*/
+template<typename CharT, size_t N = 0>
+class basic_string;
+
+/** Common zero-size base class for all strings. */
+template<typename CharT>
+class basic_string<CharT> {
+	typedef basic_string<CharT, 8> child;
+
+  public:
+	typedef char_traits<CharT>                     traits_type;
+	typedef CharT                                  value_type;
+	typedef value_type*                            pointer;
+	typedef const value_type*                      const_pointer;
+	typedef value_type&                            reference;
+	typedef const value_type&                      const_reference;
+	typedef size_t                                 size_type;
+	typedef ptrdiff_t                              difference_type;
+	typedef pointer                                iterator;
+	typedef const_pointer                          const_iterator;
+	typedef sstl::reverse_iterator<iterator>       reverse_iterator;
+	typedef sstl::reverse_iterator<const_iterator> const_reverse_iterator;
+
+	/** Special value meaning "until the end of the string" or "not found". */
+	static const size_type npos = size_type(-1);
+
+	/** Copy assignment operator. */
+	basic_string& operator=(const basic_string& rhs) { return assign(rhs); }
+	/** Replaces the contents with those of the null terminated string s. */
+	basic_string& operator=(const value_type* s) { return assign(s); }
+	/** Replaces the contents with the single character ch. */
+	basic_string& operator=(value_type ch) { return assign(1, ch); }
+
+	/** Random access operator. */
+	reference operator[](size_type pos) { return begin()[pos]; }
+	const_reference operator[](size_type pos) const { return begin()[pos]; }
+
+	/** Replaces the contents with count copies of character ch. */
+	basic_string& assign(size_type count, value_type ch) { return replace_fill(0, size(), count, ch); }
+	/** Replaces the contents with a copy of str. */
+	basic_string& assign(const basic_string& str) { return replace_copy(0, size(), str.data(), str.size()); }
+	/** Replaces the contents with the substring [pos, pos + count) of str. */
+	basic_string& assign(const basic_string& str, size_type pos, size_type count = npos) {
+		pos = sstl::min(pos, str.size());
+		return replace_copy(0, size(), str.data() + pos, sstl::min(count, str.size() - pos));
+	}
+	/** Replaces the contents with the first count characters of s. */
+	basic_string& assign(const value_type* s, size_type count) { return replace_copy(0, size(), s, count); }
+	/** Replaces the contents with the null terminated string s. */
+	basic_string& assign(const value_type* s) { return assign(s, traits_type::length(s)); }
+	/** Replaces the contents with copies of the characters in the range [first, last]. */
+	template<class InputIt>
+	basic_string& assign(InputIt first, InputIt last) {
+		typedef typename is_integral<InputIt>::type integral;
+		return replace_range_dispatch(0, size(), first, last, integral());
+	}
+
+	/** Returns a reference to the character at specified location pos, with bounds checking. */
+	reference at(size_type pos) { return begin()[pos % max_size()]; }
+	const_reference at(size_type pos) const { return begin()[pos % max_size()]; }
+
+	/** Returns a reference to the first character. */
+	reference front() { return *begin(); }
+	const_reference front() const { return *begin(); }
+
+	/** Returns a reference to the last character. */
+	reference back() { return end()[-1]; }
+	const_reference back() const { return end()[-1]; }
+
+	/** Returns a pointer to the characters, which are followed by a null terminator. */
+	pointer data() { return static_cast<child*>(this)->storage_.data_; }
+	const_pointer data() const { return static_cast<const child*>(this)->storage_.data_; }
+	/** Returns a pointer to the null terminated characters. */
+	const_pointer c_str() const { return data(); }
+
+	/** Returns an iterator to the first character. */
+	iterator begin() { return iterator(data()); }
+	const_iterator begin() const { return const_iterator(data()); }
+	const_iterator cbegin() const { return begin(); }
+
+	/** Returns an iterator to the character following the last character. */
+	iterator end() { return begin() + size(); }
+	const_iterator end() const { return begin() + size(); }
+	const_iterator cend() const { return end(); }
+
+	/** Returns a reverse iterator to the first character of the reversed string. */
+	reverse_iterator rbegin() { return reverse_iterator(end()); }
+	const_reverse_iterator rbegin() const { return const_reverse_iterator(end()); }
+	const_reverse_iterator crbegin() const { return rbegin(); }
+
+	/** Returns a reverse iterator to the character following the last character of the reversed string. */
+	reverse_iterator rend() { return reverse_iterator(begin()); }
+	const_reverse_iterator rend() const { return const_reverse_iterator(begin()); }
+	const_reverse_iterator crend() const { return rend(); }
+
+	/** Checks whether the string has no characters. */
+	bool empty() const { return size() == 0; }
+	/** Returns the number of characters. */
+	size_type size() const { return static_cast<const child*>(this)->size_; }
+	size_type length() const { return size(); }
+	/** Returns the maximum possible number of characters, not counting the null terminator. */
+	size_type max_size() const { return static_cast<const child*>(this)->capacity_; }
+	/** Returns the number of characters that the string has currently allocated space for. */
+	size_type capacity() const { return max_size(); }
+
+	/** Removes all characters. */
+	void clear() { set_size(0); }
+
+	/** Inserts count copies of character ch at index. */
+	basic_string& insert(size_type index, size_type count, value_type ch) {
+		return replace_fill(index, 0, count, ch);
+	}
+	/** Inserts the null terminated string s at index. */
+	basic_string& insert(size_type index, const value_type* s) {
+		return replace_copy(index, 0, s, traits_type::length(s));
+	}
+	/** Inserts the first count characters of s at index. */
+	basic_string& insert(size_type index, const value_type* s, size_type count) {
+		return replace_copy(index, 0, s, count);
+	}
+	/** Inserts str at index. */
+	basic_string& insert(size_type index, const basic_string& str) {
+		return replace_copy(index, 0, str.data(), str.size());
+	}
+	/** Inserts character ch before iterator pos. */
+	template<typename It>
+	typename detail::if_string_iterator<It, value_type, iterator>::type insert(It pos, value_type ch) {
+		return insert(pos, size_type(1), ch);
+	}
+	/** Inserts count copies of character ch before iterator pos. */
+	template<typename It>
+	typename detail::if_string_iterator<It, value_type, iterator>::type
+	insert(It pos, size_type count, value_type ch) {
+		const size_type index = size_type(pos - begin());
+		replace_fill(index, 0, count, ch);
+		return begin() + index;
+	}
+	/** Inserts the characters in the range [first, last] before iterator pos. */
+	template<typename It, class InputIt>
+	typename detail::if_string_iterator<It, value_type, iterator>::type
+	insert(It pos, InputIt first, InputIt last) {
+		typedef typename is_integral<InputIt>::type integral;
+		const size_type index = size_type(pos - begin());
+		replace_range_dispatch(index, 0, first, last, integral());
+		return begin() + index;
+	}
+
+	/** Removes count characters starting at index, or all that follow index. */
+	basic_string& erase(size_type index = 0, size_type count = npos) {
+		return replace_copy(index, count, data(), 0);
+	}
+	/** Removes the character at iterator pos, returns an iterator to the character that followed it. */
+	template<typename It>
+	typename detail::if_string_iterator<It, value_type, iterator>::type erase(It pos) {
+		return erase(pos, pos + 1);
+	}
+	/** Removes the characters in the iterator range [first, last). */
+	template<typename It>
+	typename detail::if_string_iterator<It, value_type, iterator>::type erase(It first, const_iterator last) {
+		const size_type index = size_type(first - begin());
+		replace_copy(index, size_type(last - first), data(), 0);
+		return begin() + index;
+	}
+
+	/** Appends character ch. */
+	void push_back(value_type ch) {
+		if (size() < max_size()) {
+			data()[size()] = ch;
+			set_size(size() + 1);
+		}
+	}
+	/** Removes the last character. */
+	void pop_back() { set_size(size() - 1); }
+
+	/** Appends count copies of character ch. */
+	basic_string& append(size_type count, value_type ch) { return replace_fill(size(), 0, count, ch); }
+	/** Appends str. */
+	basic_string& append(const basic_string& str) { return replace_copy(size(), 0, str.data(), str.size()); }
+	/** Appends the substring [pos, pos + count) of str. */
+	basic_string& append(const basic_string& str, size_type pos, size_type count = npos) {
+		pos = sstl::min(pos, str.size());
+		return replace_copy(size(), 0, str.data() + pos, sstl::min(count, str.size() - pos));
+	}
+	/** Appends the first count characters of s. */
+	basic_string& append(const value_type* s, size_type count) { return replace_copy(size(), 0, s, count); }
+	/** Appends the null terminated string s. */
+	basic_string& append(const value_type* s) { return append(s, traits_type::length(s)); }
+	/** Appends the characters in the range [first, last]. */
+	template<class InputIt>
+	basic_string& append(InputIt first, InputIt last) {
+		typedef typename is_integral<InputIt>::type integral;
+		return replace_range_dispatch(size(), 0, first, last, integral());
+	}
+
+	/** Appends str, a null terminated string or a character. */
+	basic_string& operator+=(const basic_string& str) { return append(str); }
+	basic_string& operator+=(const value_type* s) { return append(s); }
+	basic_string& operator+=(value_type ch) { push_back(ch); return *this; }
+
+	/** Replaces the count characters starting at pos with str. */
+	basic_string& replace(size_type pos, size_type count, const basic_string& str) {
+		return replace_copy(pos, count, str.data(), str.size());
+	}
+	/** Replaces the count characters starting at pos with the first count2 characters of s. */
+	basic_string& replace(size_type pos, size_type count, const value_type* s, size_type count2) {
+		return replace_copy(pos, count, s, count2);
+	}
+	/** Replaces the count characters starting at pos with the null terminated string s. */
+	basic_string& replace(size_type pos, size_type count, const value_type* s) {
+		return replace_copy(pos, count, s, traits_type::length(s));
+	}
+	/** Replaces the count characters starting at pos with count2 copies of character ch. */
+	basic_string& replace(size_type pos, size_type count, size_type count2, value_type ch) {
+		return replace_fill(pos, count, count2, ch);
+	}
+
+	/** Copies up to count characters starting at pos to dest, returns the number copied. */
+	size_type copy(value_type* dest, size_type count, size_type pos = 0) const {
+		pos = sstl::min(pos, size());
+		count = sstl::min(count, size() - pos);
+		traits_type::copy(dest, data() + pos, count);
+		return count;
+	}
+
+	/** Resizes the string to count characters, appending copies of ch if it grows. */
+	void resize(size_type count, value_type ch = value_type()) {
+		if (count <= size()) {
+			set_size(count);
+		} else {
+			append(count - size(), ch);
+		}
+	}
+
+	/** Lexicographically compares with str, returns a negative, zero or positive value. */
+	int compare(const basic_string& str) const { return compare(0, size(), str.data(), str.size()); }
+	/** Lexicographically compares with the null terminated string s. */
+	int compare(const value_type* s) const { return compare(0, size(), s, traits_type::length(s)); }
+	/** Lexicographically compares the substring [pos, pos + count) with the first count2 characters of s. */
+	int compare(size_type pos, size_type count, const value_type* s, size_type count2) const {
+		pos = sstl::min(pos, size());
+		count = sstl::min(count, size() - pos);
+
+		const int result = traits_type::compare(data() + pos, s, sstl::min(count, count2));
+
+		if (result != 0) { return result; }
+
+		return count < count2 ? -1 : count2 < count ? 1 : 0;
+	}
+
+	/** Finds the first occurrence of str at or after pos, returns npos if there is none. */
+	size_type find(const basic_string& str, size_type pos = 0) const { return find(str.data(), pos, str.size()); }
+	/** Finds the first occurrence of the first count characters of s at or after pos. */
+	size_type find(const value_type* s, size_type pos, size_type count) const {
+		if (count == 0) { return pos <= size() ? pos : npos; }
+		if (pos >= size() || count > size() - pos) { return npos; }
+
+		/* Look for the first character with find, then confirm the rest with compare. */
+		const_pointer first = data() + pos;
+		const_pointer const last = data() + size() - count + 1;
+
+		while ((first = traits_type::find(first, size_type(last - first), *s)) != 0) {
+			if (traits_type::compare(first + 1, s + 1, count - 1) == 0) { return size_type(first - data()); }
+
+			++first;
+		}
+
+		return npos;
+	}
+	/** Finds the first occurrence of the null terminated string s at or after pos. */
+	size_type find(const value_type* s, size_type pos = 0) const { return find(s, pos, traits_type::length(s)); }
+	/** Finds the first occurrence of character ch at or after pos. */
+	size_type find(value_type ch, size_type pos = 0) const {
+		if (pos >= size()) { return npos; }
+
+		const_pointer found = traits_type::find(data() + pos, size() - pos, ch);
+		return found ? size_type(found - data()) : npos;
+	}
+
+	/** Finds the last occurrence of str which starts at or before pos, returns npos if there is none. */
+	size_type rfind(const basic_string& str, size_type pos = npos) const { return rfind(str.data(), pos, str.size()); }
+	/** Finds the last occurrence of the first count characters of s which starts at or before pos. */
+	size_type rfind(const value_type* s, size_type pos, size_type count) const {
+		if (count > size()) { return npos; }
+
+		size_type end = sstl::min(pos, size() - count) + 1;
+
+		if (count == 0) { return end - 1; }
+
+		const_pointer found;
+
+		while ((found = detail::find_last(data(), end, *s)) != 0) {
+			if (traits_type::compare(found + 1, s + 1, count - 1) == 0) { return size_type(found - data()); }
+
+			end = size_type(found - data());
+		}
+
+		return npos;
+	}
+	/** Finds the last occurrence of the null terminated string s which starts at or before pos. */
+	size_type rfind(const value_type* s, size_type pos = npos) const { return rfind(s, pos, traits_type::length(s)); }
+	/** Finds the last occurrence of character ch at or before pos. */
+	size_type rfind(value_type ch, size_type pos = npos) const {
+		const size_type end = empty() ? 0 : sstl::min(pos, size() - 1) + 1;
+		const_pointer found = detail::find_last(data(), end, ch);
+		return found ? size_type(found - data()) : npos;
+	}
+
+	/** Finds the first character at or after pos which is one of the characters of str. */
+	size_type find_first_of(const basic_string& str, size_type pos = 0) const {
+		return find_first_of(str.data(), pos, str.size());
+	}
+	/** Finds the first character at or after pos which is one of the first count characters of s. */
+	size_type find_first_of(const value_type* s, size_type pos, size_type count) const {
+		if (pos >= size() || count == 0) { return npos; }
+
+		const_pointer found = detail::find_first_of(data() + pos, size() - pos, s, count);
+		return found ? size_type(found - data()) : npos;
+	}
+	/** Finds the first character at or after pos which is one of the characters of the null terminated string s. */
+	size_type find_first_of(const value_type* s, size_type pos = 0) const {
+		return find_first_of(s, pos, traits_type::length(s));
+	}
+	/** Finds the first occurrence of character ch at or after pos. */
+	size_type find_first_of(value_type ch, size_type pos = 0) const { return find(ch, pos); }
+
+  protected:
+	SSTL_CONSTEXPR basic_string() {}
+	~basic_string() {}
+
+	/** Sets the number of characters and writes the null terminator after them. */
+	void set_size(size_type count) {
+		static_cast<child*>(this)->size_ = detail::stored_size_type(count);
+		data()[count] = value_type();
+	}
+
+	/**
+		Replaces the count characters at pos with the first count2 characters
+		of s, which may point into this string. Like insertion into a vector,
+		count2 is cut short rather than losing characters after the gap.
+	*/
+	basic_string& replace_copy(size_type pos, size_type count, const value_type* s, size_type count2) {
+		pos = sstl::min(pos, size());
+		count = sstl::min(count, size() - pos);
+		count2 = sstl::min(count2, max_size() - (size() - count));
+
+		pointer const gap = data() + pos;
+		const size_type tail = size() - pos - count;
+
+		if (!aliases(s)) {
+			traits_type::move(gap + count2, gap + count, tail);
+			traits_type::copy(gap, s, count2);
+		} else if (count2 <= count) {
+			/* Shrinking, copy before the tail moves so a source in the tail is still in place. */
+			traits_type::move(gap, s, count2);
+			traits_type::move(gap + count2, gap + count, tail);
+		} else {
+			/* Growing, the tail moves right first and the source is fixed up to follow it. */
+			traits_type::move(gap + count2, gap + count, tail);
+
+			if (s + count2 <= gap + count) {
+				traits_type::move(gap, s, count2);
+			} else if (s >= gap + count) {
+				traits_type::copy(gap, s + (count2 - count), count2);
+			} else {
+				const size_type before = size_type(gap + count - s);
+				traits_type::move(gap, s, before);
+				traits_type::copy(gap + before, gap + count2, count2 - before);
+			}
+		}
+
+		set_size(size() - count + count2);
+		return *this;
+	}
+
+	/** Replaces the count characters at pos with count2 copies of ch, cut short like replace_copy. */
+	basic_string& replace_fill(size_type pos, size_type count, size_type count2, value_type ch) {
+		pos = sstl::min(pos, size());
+		count = sstl::min(count, size() - pos);
+		count2 = sstl::min(count2, max_size() - (size() - count));
+
+		pointer const gap = data() + pos;
+		traits_type::move(gap + count2, gap + count, size() - pos - count);
+		traits_type::assign(gap, count2, ch);
+		set_size(size() - count + count2);
+		return *this;
+	}
+
+  private:
+	/** Checks whether s points into the characters of this string. */
+	bool aliases(const value_type* s) const { return s >= data() && s < data() + size(); }
+
+	template<class Int>
+	basic_string& replace_range_dispatch(size_type pos, size_type count, Int count2, Int ch, true_type) {
+		return replace_fill(pos, count, size_type(count2), value_type(ch));
+	}
+	template<class InputIt>
+	basic_string& replace_range_dispatch(size_type pos, size_type count, InputIt first, InputIt last,
+	                                     false_type) {
+		typedef typename detail::is_memmovable<InputIt, pointer>::type block;
+		return replace_iterators_dispatch(pos, count, first, last, block());
+	}
+
+	template<class InputIt>
+	basic_string& replace_iterators_dispatch(size_type pos, size_type count, InputIt first, InputIt last,
+	                                         true_type) {
+		return replace_copy(pos, count, first, size_type(last - first));
+	}
+	template<class InputIt>
+	basic_string& replace_iterators_dispatch(size_type pos, size_type count, InputIt first, InputIt last,
+	                                         false_type) {
+		pos = sstl::min(pos, size());
+		count = sstl::min(count, size() - pos);
+
+		const size_type count2 = sstl::min(size_type(sstl::distance(first, last)),
+		                                   max_size() - (size() - count));
+
+		pointer const gap = data() + pos;
+		traits_type::move(gap + count2, gap + count, size() - pos - count);
+		sstl::copy_n(first, count2, gap);
+		set_size(size() - count + count2);
+		return *this;
+	}
+};
+
+template<typename CharT>
+const typename basic_string<CharT>::size_type basic_string<CharT>::npos;
+
+/** Child class with size-specific storage for the characters. */
+template<typename CharT, size_t N>
+class basic_string : public basic_string<CharT> {
+	friend class basic_string<CharT>;
+	typedef basic_string<CharT> base;
+
+  public:
+	typedef typename base::traits_type            traits_type;
+	typedef typename base::value_type             value_type;
+	typedef typename base::pointer                pointer;
+	typedef typename base::const_pointer          const_pointer;
+	typedef typename base::reference              reference;
+	typedef typename base::const_reference        const_reference;
+	typedef typename base::size_type              size_type;
+	typedef typename base::difference_type        difference_type;
+	typedef typename base::iterator               iterator;
+	typedef typename base::const_iterator         const_iterator;
+	typedef typename base::reverse_iterator       reverse_iterator;
+	typedef typename base::const_reverse_iterator const_reverse_iterator;
+
+	/** Default constructor, a constant initializer for strings with static storage. */
+	SSTL_CONSTEXPR basic_string() : base(), capacity_(N), size_(0), storage_() {}
+	/** Copy constructor. */
+	basic_string(const basic_string& other) : base(), capacity_(N) { construct(other.data(), other.size()); }
+	/** Copy adapter constructor, keeps as many characters as fit. */
+	basic_string(const base& other) : base(), capacity_(N) { construct(other.data(), other.size()); }
+	/** Constructs the string with the substring [pos, pos + count) of other. */
+	basic_string(const base& other, size_type pos, size_type count = base::npos) : base(), capacity_(N) {
+		pos = sstl::min(pos, other.size());
+		construct(other.data() + pos, sstl::min(count, other.size() - pos));
+	}
+	/** Constructs the string with the null terminated string s. */
+	basic_string(const value_type* s) : base(), capacity_(N) { construct(s, traits_type::length(s)); }
+	/** Constructs the string with the first count characters of s. */
+	basic_string(const value_type* s, size_type count) : base(), capacity_(N) { construct(s, count); }
+	/** Constructs the string with count copies of character ch. */
+	basic_string(size_type count, value_type ch) : base(), capacity_(N) {
+		count = sstl::min(count, N);
+		traits_type::assign(storage_.data_, count, ch);
+		base::set_size(count);
+	}
+	/** Constructs the string with the characters in the range [first, last]. */
+	template<class InputIt>
+	basic_string(InputIt first, InputIt last) : base(), capacity_(N), size_(0), storage_() {
+		base::assign(first, last);
+	}
+
+	/** Returns the maximum possible number of characters, not counting the null terminator. */
+	SSTL_CONSTEXPR14 size_type max_size() const { return N; }
+	/** Returns the number of characters that the string has currently allocated space for. */
+	SSTL_CONSTEXPR14 size_type capacity() const { return N; }
+
+	/** Copy assignment operator. */
+	basic_string& operator=(const basic_string& rhs) {
+		base::assign(rhs);
+		return *this;
+	}
+	/** Copy assignment operator for compatible string. */
+	basic_string& operator=(const base& rhs) {
+		base::assign(rhs);
+		return *this;
+	}
+	/** Replaces the contents with those of the null terminated string s. */
+	basic_string& operator=(const value_type* s) {
+		base::assign(s);
+		return *this;
+	}
+	/** Replaces the contents with the single character ch. */
+	basic_string& operator=(value_type ch) {
+		base::assign(1, ch);
+		return *this;
+	}
+
+  private:
+	void construct(const value_type* s, size_type count) {
+		count = sstl::min(count, N);
+		traits_type::copy(storage_.data_, s, count);
+		base::set_size(count);
+	}
+
+	typedef typename detail::check_capacity<N>::type capacity_fits;
+
+	detail::stored_size_type capacity_;
+	detail::stored_size_type size_;
+
+	/**
+		Character storage, wrapped so a constexpr constructor only has to
+		write the null terminator of the empty string, not all N characters.
+	*/
+	union storage {
+		struct terminator { value_type null_; };
+
+		SSTL_CONSTEXPR storage() : terminator_() {}
+
+		terminator terminator_;
+		value_type data_[N + 1];
+	} storage_;
+};
+
+#if __cplusplus >= 201103
+/** Fixed-capacity string of char, string<> is the size-erased base. */
+template<size_t N = 0>
+using string = basic_string<char, N>;
+
+/** Fixed-capacity string of wchar_t, wstring<> is the size-erased base. */
+template<size_t N = 0>
+using wstring = basic_string<wchar_t, N>;
+#endif
+
+template<typename CharT>
+inline bool operator==(const basic_string<CharT>& lhs, const basic_string<CharT>& rhs) {
+	return lhs.size() == rhs.size() && lhs.compare(rhs) == 0;
+}
+template<typename CharT>
+inline bool operator==(const basic_string<CharT>& lhs, const CharT* rhs) { return lhs.compare(rhs) == 0; }
+template<typename CharT>
+inline bool operator==(const CharT* lhs, const basic_string<CharT>& rhs) { return rhs.compare(lhs) == 0; }
+
+template<typename CharT>
+inline bool operator!=(const basic_string<CharT>& lhs, const basic_string<CharT>& rhs) { return !(lhs == rhs); }
+template<typename CharT>
+inline bool operator!=(const basic_string<CharT>& lhs, const CharT* rhs) { return !(lhs == rhs); }
+template<typename CharT>
+inline bool operator!=(const CharT* lhs, const basic_string<CharT>& rhs) { return !(lhs == rhs); }
+
+template<typename CharT>
+inline bool operator<(const basic_string<CharT>& lhs, const basic_string<CharT>& rhs) { return lhs.compare(rhs) < 0; }
+template<typename CharT>
+inline bool operator<(const basic_string<CharT>& lhs, const CharT* rhs) { return lhs.compare(rhs) < 0; }
+template<typename CharT>
+inline bool operator<(const CharT* lhs, const basic_string<CharT>& rhs) { return rhs.compare(lhs) > 0; }
+
+template<typename CharT>
+inline bool operator>(const basic_string<CharT>& lhs, const basic_string<CharT>& rhs) { return rhs < lhs; }
+template<typename CharT>
+inline bool operator>(const basic_string<CharT>& lhs, const CharT* rhs) { return rhs < lhs; }
+template<typename CharT>
+inline bool operator>(const CharT* lhs, const basic_string<CharT>& rhs) { return rhs < lhs; }
+
+template<typename CharT>
+inline bool operator<=(const basic_string<CharT>& lhs, const basic_string<CharT>& rhs) { return !(rhs < lhs); }
+template<typename CharT>
+inline bool operator<=(const basic_string<CharT>& lhs, const CharT* rhs) { return !(rhs < lhs); }
+template<typename CharT>
+inline bool operator<=(const CharT* lhs, const basic_string<CharT>& rhs) { return !(rhs < lhs); }
+
+template<typename CharT>
+inline bool operator>=(const basic_string<CharT>& lhs, const basic_string<CharT>& rhs) { return !(lhs < rhs); }
+template<typename CharT>
+inline bool operator>=(const basic_string<CharT>& lhs, const CharT* rhs) { return !(lhs < rhs); }
+template<typename CharT>
+inline bool operator>=(const CharT* lhs, const basic_string<CharT>& rhs) { return !(lhs < rhs); }
+
+} /* namespace sstl */
+
+#endif /* STATIC_STL_BASIC_STRING_H_ */
@@ -0,0 +1,321 @@
+#ifndef STATIC_STL_BITSET_H_
+#define STATIC_STL_BITSET_H_
+
+#include "type_traits.h"
+
+namespace sstl {
+
+namespace detail {
+/** Unsigned machine word the bits of a bitset are packed into, one of uint32_t and uint64_t. */
+typedef conditional < (sizeof(size_t) < sizeof(uint64_t)),
+        uint32_t, uint64_t >::type bitset_word;
+
+/** Number of bits in a bitset_word. */
+const size_t bitset_word_bits = sizeof(bitset_word) * 8;
+} /* namespace detail */
+
+/**
+	Fixed-size sequence of N bits, packed into machine words. Whole words
+	are processed at once: count() is a population count per word and the
+	find functions skip empty words with a single test, then locate the bit
+	with a count trailing zeros instruction. Bits past N are kept clear.
+*/
+template<size_t N>
+class bitset {
+	typedef detail::bitset_word word_type;
+
+  public:
+	/** Proxy returned by the non-const subscript operator, which reads and writes a single bit. */
+	class reference {
+		friend class bitset;
+
+	  public:
+		reference(const reference& other) : word_(other.word_), mask_(other.mask_) {}
+
+		reference& operator=(bool value) { set(value); return *this; }
+		reference& operator=(const reference& rhs) { set(bool(rhs)); return *this; }
+
+		operator bool() const { return (*word_ & mask_) != 0; }
+		bool operator~() const { return !bool(*this); }
+
+		/** Flips the referenced bit. */
+		reference& flip() { *word_ ^= mask_; return *this; }
+
+	  private:
+		reference(word_type* word, word_type mask) : word_(word), mask_(mask) {}
+
+		void set(bool value) {
+			if (value) {
+				*word_ |= mask_;
+			} else {
+				*word_ &= ~mask_;
+			}
+		}
+
+		word_type* word_;
+		word_type mask_;
+	};
+
+	/** Default constructor, all bits are clear. A constant initializer for bitsets with static storage. */
+	SSTL_CONSTEXPR bitset() : words_() {}
+	/** Constructs the bitset with the low bits set from value. */
+	bitset(uint64_t value) : words_() {
+		for (size_t i = 0; i < word_count && i * detail::bitset_word_bits < 64; ++i) {
+			words_[i] = word_type(value >> (i * detail::bitset_word_bits));
+		}
+
+		trim();
+	}
+
+	/** Returns the value of the bit at pos. */
+	SSTL_CONSTEXPR bool operator[](size_t pos) const { return test(pos); }
+	/** Returns a proxy for the bit at pos. */
+	reference operator[](size_t pos) { return reference(&words_[word_index(pos)], bit_mask(pos)); }
+
+	/** Returns the value of the bit at pos. */
+	SSTL_CONSTEXPR bool test(size_t pos) const { return (words_[word_index(pos)] & bit_mask(pos)) != 0; }
+
+	/** Checks whether all bits are set. */
+	bool all() const {
+		for (size_t i = 0; i + 1 < word_count; ++i) {
+			if (words_[i] != word_type(~word_type(0))) { return false; }
+		}
+
+		return words_[word_count - 1] == last_word_mask();
+	}
+	/** Checks whether any bit is set. */
+	bool any() const {
+		for (size_t i = 0; i < word_count; ++i) {
+			if (words_[i]) { return true; }
+		}
+
+		return false;
+	}
+	/** Checks whether no bit is set. */
+	bool none() const { return !any(); }
+
+	/** Returns the number of set bits. */
+	size_t count() const {
+		size_t total = 0;
+
+		for (size_t i = 0; i < word_count; ++i) { total += detail::popcount(words_[i]); }
+
+		return total;
+	}
+	/** Returns the number of bits. */
+	SSTL_CONSTEXPR size_t size() const { return N; }
+
+	/** Sets all bits. */
+	bitset& set() {
+		for (size_t i = 0; i < word_count; ++i) { words_[i] = word_type(~word_type(0)); }
+
+		trim();
+		return *this;
+	}
+	/** Sets the bit at pos to value. */
+	bitset& set(size_t pos, bool value = true) {
+		if (value) {
+			words_[word_index(pos)] |= bit_mask(pos);
+		} else {
+			words_[word_index(pos)] &= ~bit_mask(pos);
+		}
+
+		return *this;
+	}
+	/** Sets the bits in [first, last), whole words at a time. */
+	bitset& set_range(size_t first, size_t last) { return apply_range(first, last, true); }
+
+	/** Clears all bits. */
+	bitset& reset() {
+		for (size_t i = 0; i < word_count; ++i) { words_[i] = 0; }
+
+		return *this;
+	}
+	/** Clears the bit at pos. */
+	bitset& reset(size_t pos) { return set(pos, false); }
+	/** Clears the bits in [first, last), whole words at a time. */
+	bitset& reset_range(size_t first, size_t last) { return apply_range(first, last, false); }
+
+	/** Flips all bits. */
+	bitset& flip() {
+		for (size_t i = 0; i < word_count; ++i) { words_[i] = word_type(~words_[i]); }
+
+		trim();
+		return *this;
+	}
+	/** Flips the bit at pos. */
+	bitset& flip(size_t pos) {
+		words_[word_index(pos)] ^= bit_mask(pos);
+		return *this;
+	}
+
+	/** Returns the index of the lowest set bit, or size() if no bit is set. */
+	size_t find_first() const { return find_from_word(0); }
+	/** Returns the index of the lowest set bit after pos, or size() if there is none. */
+	size_t find_next(size_t pos) const {
+		if (++pos >= N) { return N; }
+
+		const size_t i = word_index(pos);
+		const word_type rest = words_[i] & word_type(~word_type(0) << (pos % detail::bitset_word_bits));
+
+		if (rest) { return i * detail::bitset_word_bits + detail::lowest_bit(rest); }
+
+		return find_from_word(i + 1);
+	}
+
+	/** Returns the low bits as an unsigned integer, higher bits are dropped. */
+	uint64_t to_ullong() const {
+		uint64_t value = 0;
+
+		for (size_t i = 0; i < word_count && i * detail::bitset_word_bits < 64; ++i) {
+			value |= uint64_t(words_[i]) << (i * detail::bitset_word_bits);
+		}
+
+		return value;
+	}
+
+	bitset& operator&=(const bitset& rhs) {
+		for (size_t i = 0; i < word_count; ++i) { words_[i] &= rhs.words_[i]; }
+
+		return *this;
+	}
+	bitset& operator|=(const bitset& rhs) {
+		for (size_t i = 0; i < word_count; ++i) { words_[i] |= rhs.words_[i]; }
+
+		return *this;
+	}
+	bitset& operator^=(const bitset& rhs) {
+		for (size_t i = 0; i < word_count; ++i) { words_[i] ^= rhs.words_[i]; }
+
+		return *this;
+	}
+	/** Returns a copy with all bits flipped. */
+	bitset operator~() const { return bitset(*this).flip(); }
+
+	/** Shifts the bits towards higher indices, filling with zeros. */
+	bitset& operator<<=(size_t shift) {
+		if (shift >= N) { return reset(); }
+
+		const size_t words = shift / detail::bitset_word_bits;
+		const size_t bits = shift % detail::bitset_word_bits;
+
+		for (size_t i = word_count; i-- > words;) {
+			word_type value = word_type(words_[i - words] << bits);
+
+			if (bits && i > words) { value |= words_[i - words - 1] >> (detail::bitset_word_bits - bits); }
+
+			words_[i] = value;
+		}
+
+		for (size_t i = 0; i < words; ++i) { words_[i] = 0; }
+
+		trim();
+		return *this;
+	}
+	/** Shifts the bits towards lower indices, filling with zeros. */
+	bitset& operator>>=(size_t shift) {
+		if (shift >= N) { return reset(); }
+
+		const size_t words = shift / detail::bitset_word_bits;
+		const size_t bits = shift % detail::bitset_word_bits;
+		const size_t kept = word_count - words;
+
+		for (size_t i = 0; i < kept; ++i) {
+			word_type value = word_type(words_[i + words] >> bits);
+
+			if (bits && i + words + 1 < word_count) {
+				value |= word_type(words_[i + words + 1] << (detail::bitset_word_bits - bits));
+			}
+
+			words_[i] = value;
+		}
+
+		for (size_t i = kept; i < word_count; ++i) { words_[i] = 0; }
+
+		return *this;
+	}
+	bitset operator<<(size_t shift) const { return bitset(*this) <<= shift; }
+	bitset operator>>(size_t shift) const { return bitset(*this) >>= shift; }
+
+	bool operator==(const bitset& rhs) const {
+		for (size_t i = 0; i < word_count; ++i) {
+			if (words_[i] != rhs.words_[i]) { return false; }
+		}
+
+		return true;
+	}
+	bool operator!=(const bitset& rhs) const { return !(*this == rhs); }
+
+  private:
+	/** Number of words, at least one so bitset<0> stays a valid type. */
+	static const size_t word_count = N ? (N + detail::bitset_word_bits - 1) / detail::bitset_word_bits : 1;
+
+	static SSTL_CONSTEXPR size_t word_index(size_t pos) { return pos / detail::bitset_word_bits; }
+	static SSTL_CONSTEXPR word_type bit_mask(size_t pos) {
+		return word_type(word_type(1) << (pos % detail::bitset_word_bits));
+	}
+	/** Mask of the bits of the last word which are below N. */
+	static word_type last_word_mask() {
+		return N % detail::bitset_word_bits ?
+		       word_type((word_type(1) << (N % detail::bitset_word_bits)) - 1) :
+		       N ? word_type(~word_type(0)) : word_type(0);
+	}
+
+	/** Clears the bits past N, which operations on whole words may have set. */
+	void trim() { words_[word_count - 1] &= last_word_mask(); }
+
+	size_t find_from_word(size_t i) const {
+		for (; i < word_count; ++i) {
+			if (words_[i]) { return i * detail::bitset_word_bits + detail::lowest_bit(words_[i]); }
+		}
+
+		return N;
+	}
+
+	/** Sets or clears [first, last): a mask for each partial end word and a plain store for each word in between. */
+	bitset& apply_range(size_t first, size_t last, bool value) {
+		last = last < N ? last : N;
+
+		if (first >= last) { return *this; }
+
+		const size_t first_word = word_index(first);
+		const size_t last_word = word_index(last - 1);
+		const word_type all = word_type(~word_type(0));
+		const word_type head = word_type(all << (first % detail::bitset_word_bits));
+		const word_type tail = word_type(all >> (detail::bitset_word_bits - 1 - (last - 1) % detail::bitset_word_bits));
+
+		if (first_word == last_word) {
+			apply_mask(first_word, word_type(head & tail), value);
+		} else {
+			apply_mask(first_word, head, value);
+
+			for (size_t i = first_word + 1; i < last_word; ++i) { words_[i] = value ? all : word_type(0); }
+
+			apply_mask(last_word, tail, value);
+		}
+
+		return *this;
+	}
+	void apply_mask(size_t i, word_type mask, bool value) {
+		if (value) {
+			words_[i] |= mask;
+		} else {
+			words_[i] &= word_type(~mask);
+		}
+	}
+
+	word_type words_[word_count];
+};
+
+template<size_t N>
+inline bitset<N> operator&(const bitset<N>& lhs, const bitset<N>& rhs) { return bitset<N>(lhs) &= rhs; }
+
+template<size_t N>
+inline bitset<N> operator|(const bitset<N>& lhs, const bitset<N>& rhs) { return bitset<N>(lhs) |= rhs; }
+
+template<size_t N>
+inline bitset<N> operator^(const bitset<N>& lhs, const bitset<N>& rhs) { return bitset<N>(lhs) ^= rhs; }
+
+} /* namespace sstl */
+
+#endif /* STATIC_STL_BITSET_H_ */
@@ -0,0 +1,222 @@
+#ifndef STATIC_STL_EYTZINGER_ARRAY_H_
+#define STATIC_STL_EYTZINGER_ARRAY_H_
+
+#include "algorithm.h"
+#include "functional.h"
+#include "iterator.h"
+#include "type_traits.h"
+#include "utility.h"
+#include "vector.h"
+
+namespace sstl {
+
+namespace detail {
+/** Search predicate of eytzinger_array::lower_bound, true for elements before the first one not less than key. */
+template<typename T, class Compare>
+struct eytzinger_less {
+	eytzinger_less(const T& key, Compare comp) : key_(key), comp_(comp) {}
+
+	bool operator()(const T& element) const { return comp_(element, key_); }
+
+	const T& key_;
+	Compare comp_;
+};
+
+/** Search predicate of eytzinger_array::upper_bound, true for elements before the first one greater than key. */
+template<typename T, class Compare>
+struct eytzinger_not_greater {
+	eytzinger_not_greater(const T& key, Compare comp) : key_(key), comp_(comp) {}
+
+	bool operator()(const T& element) const { return !comp_(key_, element); }
+
+	const T& key_;
+	Compare comp_;
+};
+} /* namespace detail */
+
+/**
+	Read-mostly sorted array of up to N elements, stored in the breadth-first
+	order of a complete binary search tree (the Eytzinger layout). The first
+	levels of the tree share a few cache lines which stay hot, and the
+	descendants four levels down a search path are contiguous, so every step
+	prefetches them and a lookup costs about one cache miss per four levels
+	instead of one per level. Searches are branch-free.
+
+	Elements are given sorted and T must be default constructible. Iteration
+	visits them in storage order, which is not sorted.
+*/
+template<typename T, size_t N = 0, class Compare = less<T> >
+class eytzinger_array;
+
+/** Common zero-size base class for all Eytzinger arrays. */
+template<typename T, class Compare>
+class eytzinger_array<T, 0, Compare> {
+	typedef eytzinger_array<T, 8, Compare> child;
+
+  public:
+	typedef T                 value_type;
+	typedef Compare           key_compare;
+	typedef const value_type* pointer;
+	typedef const value_type* const_pointer;
+	typedef const value_type& reference;
+	typedef const value_type& const_reference;
+	typedef size_t            size_type;
+	typedef ptrdiff_t         difference_type;
+	typedef const_pointer     iterator;
+	typedef const_pointer     const_iterator;
+
+	/** Copy assignment operator. */
+	eytzinger_array& operator=(const eytzinger_array& rhs) {
+		storage() = rhs.storage();
+		return *this;
+	}
+
+	/** Returns an iterator to the first element in storage order. */
+	const_iterator begin() const { return storage().begin(); }
+	const_iterator cbegin() const { return begin(); }
+
+	/** Returns an iterator to the element following the last element in storage order. */
+	const_iterator end() const { return storage().end(); }
+	const_iterator cend() const { return end(); }
+
+	/** Checks whether the container has no elements. */
+	bool empty() const { return size() == 0; }
+	/** Returns the number of elements in the container. */
+	size_type size() const { return storage().size(); }
+	/** Returns the maximum possible number of elements. */
+	size_type max_size() const { return storage().max_size(); }
+
+	/** Removes all elements from the container. */
+	void clear() { storage().clear(); }
+
+	/**
+		Replaces the contents with the sorted range [first, last], keeping its
+		first max_size() elements. Each element is written once, walking the
+		tree in order.
+	*/
+	template<class ForwardIt>
+	void assign(ForwardIt first, ForwardIt last) {
+		vector<value_type>& k = storage();
+		const size_type n = sstl::min(size_type(sstl::distance(first, last)), max_size());
+
+		k.resize(n);
+
+		if (n == 0) { return; }
+
+		size_type node = 1;
+
+		while (2 * node <= n) { node *= 2; }
+
+		for (size_type i = 0; i < n; ++i, ++first) {
+			k[node - 1] = *first;
+
+			if (2 * node + 1 <= n) {
+				/* Next is the leftmost node of the right subtree. */
+				for (node = 2 * node + 1; 2 * node <= n;) { node *= 2; }
+			} else {
+				/* Next is the first ancestor whose left subtree holds this node. */
+				node >>= detail::lowest_bit(uint64_t(~node)) + 1;
+			}
+		}
+	}
+
+	/** Returns an iterator to the first element in sorted order which is not less than key, or end(). */
+	const_iterator lower_bound(const value_type& key) const {
+		return search(detail::eytzinger_less<value_type, key_compare>(key, key_comp()));
+	}
+	/** Returns an iterator to the first element in sorted order which is greater than key, or end(). */
+	const_iterator upper_bound(const value_type& key) const {
+		return search(detail::eytzinger_not_greater<value_type, key_compare>(key, key_comp()));
+	}
+
+	/** Finds an element equal to key, returns end() if there is none. */
+	const_iterator find(const value_type& key) const {
+		const const_iterator pos = lower_bound(key);
+		return pos != end() && !key_comp()(key, *pos) ? pos : end();
+	}
+	/** Checks whether there is an element equal to key. */
+	bool contains(const value_type& key) const { return find(key) != end(); }
+
+	/** Returns the function object which compares the elements. */
+	key_compare key_comp() const { return key_compare(); }
+
+  protected:
+	SSTL_CONSTEXPR eytzinger_array() {}
+	~eytzinger_array() {}
+
+	vector<value_type>& storage() { return static_cast<child*>(this)->keys_; }
+	const vector<value_type>& storage() const { return static_cast<const child*>(this)->keys_; }
+
+  private:
+	/** Number of elements sharing a cache line, which is also the number of descendants prefetched per step. */
+	static const size_type prefetch_stride = sizeof(T) < SSTL_CACHE_LINE_SIZE / 2 ? SSTL_CACHE_LINE_SIZE / sizeof(T) : 2;
+
+	/**
+		Descends from the root, going right past every element before the
+		bound. The bound is the node of the last left turn: the bits of the
+		final index are the turns taken, so shifting off the trailing right
+		turns and that left turn leaves the bound, or zero if there is none.
+	*/
+	template<class Before>
+	const_iterator search(Before before) const {
+		const const_pointer keys = begin();
+		const size_type n = size();
+		size_type node = 1;
+
+		while (node <= n) {
+			SSTL_PREFETCH(keys + sstl::min(prefetch_stride * node, n) - 1);
+			node = 2 * node + (before(keys[node - 1]) ? 1 : 0);
+		}
+
+		node >>= detail::lowest_bit(uint64_t(~node)) + 1;
+		return node ? keys + node - 1 : end();
+	}
+};
+
+/** Child class with size-specific storage for the underlying vector. */
+template<typename T, size_t N, class Compare>
+class eytzinger_array : public eytzinger_array<T, 0, Compare> {
+	friend class eytzinger_array<T, 0, Compare>;
+	typedef eytzinger_array<T, 0, Compare> base;
+
+  public:
+	typedef typename base::value_type      value_type;
+	typedef typename base::key_compare     key_compare;
+	typedef typename base::pointer         pointer;
+	typedef typename base::const_pointer   const_pointer;
+	typedef typename base::reference       reference;
+	typedef typename base::const_reference const_reference;
+	typedef typename base::size_type       size_type;
+	typedef typename base::difference_type difference_type;
+	typedef typename base::iterator        iterator;
+	typedef typename base::const_iterator  const_iterator;
+
+	/** Default constructor, a constant initializer for arrays with static storage. */
+	SSTL_CONSTEXPR eytzinger_array() : base(), keys_() {}
+	/** Copy constructor. */
+	eytzinger_array(const eytzinger_array& other) : base(), keys_(other.keys_) {}
+	/** Constructs the array with the first N elements of the sorted range [first, last]. */
+	template<class ForwardIt>
+	eytzinger_array(ForwardIt first, ForwardIt last) : base(), keys_() {
+		base::assign(first, last);
+	}
+
+	/** Returns the maximum possible number of elements. */
+	SSTL_CONSTEXPR14 size_type max_size() const { return N; }
+
+	/** Copy assignment operator. */
+	eytzinger_array& operator=(const eytzinger_array& rhs) {
+		base::operator=(rhs);
+		return *this;
+	}
+
+  private:
+	vector<T, N> keys_;
+};
+
+template<typename T, class Compare>
+const typename eytzinger_array<T, 0, Compare>::size_type eytzinger_array<T, 0, Compare>::prefetch_stride;
+
+} /* namespace sstl */
+
+#endif /* STATIC_STL_EYTZINGER_ARRAY_H_ */
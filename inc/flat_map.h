@@ -0,0 +1,484 @@
+#ifndef STATIC_STL_FLAT_MAP_H_
+#define STATIC_STL_FLAT_MAP_H_
+
+#include "algorithm.h"
+#include "functional.h"
+#include "iterator.h"
+#include "memory.h"
+#include "type_traits.h"
+#include "utility.h"
+#include "vector.h"
+
+namespace sstl {
+
+namespace detail {
+/** Holds the pair of references yielded by a proxy iterator, so operator-> has something to point at. */
+template<typename Reference>
+struct arrow_proxy {
+	Reference* operator->() { return &ref; }
+
+	Reference ref;
+};
+
+/**
+	Random access iterator over a flat map, which walks the parallel key and
+	value arrays together and yields pairs of references into them.
+*/
+template<typename K, typename V>
+class flat_map_iterator {
+	template<typename, typename> friend class flat_map_iterator;
+
+  public:
+	typedef random_access_iterator_tag              iterator_category;
+	typedef pair<K, typename remove_const<V>::type> value_type;
+	typedef pair<const K&, V&>                      reference;
+	typedef arrow_proxy<reference>                  pointer;
+	typedef ptrdiff_t                               difference_type;
+
+	/** Default constructor. */
+	flat_map_iterator() : key_(0), value_(0) {}
+	/** Copy constructor, also converts an iterator into a const iterator. */
+	flat_map_iterator(const flat_map_iterator<K, typename remove_const<V>::type>& other)
+		: key_(other.key_), value_(other.value_) {}
+	/** Construct at the given key and its value. */
+	flat_map_iterator(const K* key, V* value) : key_(key), value_(value) {}
+
+	/** Returns references to the current key and value. */
+	reference operator*() const { return reference(*key_, *value_); }
+	/** Returns a proxy through which the current key and value are accessed as first and second. */
+	pointer operator->() const { pointer p = { **this }; return p; }
+	/** Returns references to the key and value at specified relative location. */
+	reference operator[](difference_type n) const { return reference(key_[n], value_[n]); }
+	/** Pre-increments the iterator. */
+	flat_map_iterator& operator++() { ++key_; ++value_; return *this; }
+	/** Post-increments the iterator. */
+	flat_map_iterator operator++(int) { flat_map_iterator tmp(*this); ++*this; return tmp; }
+	/** Pre-decrements the iterator. */
+	flat_map_iterator& operator--() { --key_; --value_; return *this; }
+	/** Post-decrements the iterator. */
+	flat_map_iterator operator--(int) { flat_map_iterator tmp(*this); --*this; return tmp; }
+	/** Returns an iterator which is advanced by n positions. */
+	flat_map_iterator operator+(difference_type n) const { return flat_map_iterator(key_ + n, value_ + n); }
+	/** Returns an iterator which is advanced by -n positions. */
+	flat_map_iterator operator-(difference_type n) const { return flat_map_iterator(key_ - n, value_ - n); }
+	/** Advances the iterator by n positions. */
+	flat_map_iterator& operator+=(difference_type n) { key_ += n; value_ += n; return *this; }
+	/** Advances the iterator by -n positions. */
+	flat_map_iterator& operator-=(difference_type n) { key_ -= n; value_ -= n; return *this; }
+
+	/** Returns the number of elements between rhs and this iterator. */
+	template<typename U>
+	difference_type operator-(const flat_map_iterator<K, U>& rhs) const { return key_ - rhs.key_; }
+
+	template<typename U>
+	bool operator==(const flat_map_iterator<K, U>& rhs) const { return key_ == rhs.key_; }
+	template<typename U>
+	bool operator!=(const flat_map_iterator<K, U>& rhs) const { return key_ != rhs.key_; }
+	template<typename U>
+	bool operator<(const flat_map_iterator<K, U>& rhs) const { return key_ < rhs.key_; }
+	template<typename U>
+	bool operator>(const flat_map_iterator<K, U>& rhs) const { return rhs.key_ < key_; }
+	template<typename U>
+	bool operator<=(const flat_map_iterator<K, U>& rhs) const { return !(rhs.key_ < key_); }
+	template<typename U>
+	bool operator>=(const flat_map_iterator<K, U>& rhs) const { return !(key_ < rhs.key_); }
+
+  private:
+	const K* key_;
+	V* value_;
+};
+
+template<typename K, typename V>
+inline flat_map_iterator<K, V> operator+(typename flat_map_iterator<K, V>::difference_type n,
+                                         const flat_map_iterator<K, V>& it) {
+	return it + n;
+}
+} /* namespace detail */
+
+/**
+	Sorted associative container with unique keys and fixed capacity. Keys
+	and values are kept in two separate sorted vectors, so a lookup only
+	touches key cache lines until it finds its match. Lookup is a binary
+	search, insertion and erasure shift the elements after the position.
+*/
+template<typename K, typename V, size_t N = 0, class Compare = less<K> >
+class flat_map;
+
+/** Common zero-size base class for all flat maps. */
+template<typename K, typename V, class Compare>
+class flat_map<K, V, 0, Compare> {
+	typedef flat_map<K, V, 8, Compare> child;
+
+  public:
+	typedef K                                            key_type;
+	typedef V                                            mapped_type;
+	typedef pair<K, V>                                   value_type;
+	typedef Compare                                      key_compare;
+	typedef pair<const K&, V&>                           reference;
+	typedef pair<const K&, const V&>                     const_reference;
+	typedef size_t                                       size_type;
+	typedef ptrdiff_t                                    difference_type;
+	typedef detail::flat_map_iterator<K, V>              iterator;
+	typedef detail::flat_map_iterator<K, const V>        const_iterator;
+	typedef sstl::reverse_iterator<iterator>             reverse_iterator;
+	typedef sstl::reverse_iterator<const_iterator>       const_reverse_iterator;
+
+	/** Copy assignment operator. */
+	flat_map& operator=(const flat_map& rhs) {
+		key_storage() = rhs.keys();
+		value_storage() = rhs.values();
+		return *this;
+	}
+#if __cplusplus >= 201103
+	/** Move assignment operator, leaves rhs empty. */
+	flat_map& operator=(flat_map&& rhs) {
+		key_storage() = sstl::move(rhs.key_storage());
+		value_storage() = sstl::move(rhs.value_storage());
+		return *this;
+	}
+#endif
+
+	/**
+		Returns a reference to the value mapped to key, inserting a
+		value-initialized one if the key is missing. If the key is missing
+		and the map is full, nothing is inserted: debug builds assert, see
+		SSTL_ASSERT_FULL_SUBSCRIPT, and otherwise the reference is to a
+		value-initialized stand-in shared with other maps, so writes through
+		it are discarded. Use insert or try_emplace where the map can fill up.
+	*/
+	mapped_type& operator[](const key_type& key) {
+		const size_type pos = lower_index(key);
+
+		if (pos == size() || key_comp()(key, keys()[pos])) {
+			if (size() == max_size()) { return detail::full_map_subscript<mapped_type>(); }
+
+			insert_at(pos, key, mapped_type());
+		}
+
+		return value_storage()[pos];
+	}
+
+	/** Returns an iterator to the first element of the container. */
+	iterator begin() { return iterator(keys().begin(), value_storage().begin()); }
+	const_iterator begin() const { return const_iterator(keys().begin(), values().begin()); }
+	const_iterator cbegin() const { return begin(); }
+
+	/** Returns an iterator to the element following the last element of the container. */
+	iterator end() { return begin() + difference_type(size()); }
+	const_iterator end() const { return begin() + difference_type(size()); }
+	const_iterator cend() const { return end(); }
+
+	/** Returns a reverse iterator to the first element of the reversed container. */
+	reverse_iterator rbegin() { return reverse_iterator(end()); }
+	const_reverse_iterator rbegin() const { return const_reverse_iterator(end()); }
+	const_reverse_iterator crbegin() const { return rbegin(); }
+
+	/** Returns a reverse iterator to the element following the last element of the reversed container. */
+	reverse_iterator rend() { return reverse_iterator(begin()); }
+	const_reverse_iterator rend() const { return const_reverse_iterator(begin()); }
+	const_reverse_iterator crend() const { return rend(); }
+
+	/** Checks whether the container has no elements. */
+	bool empty() const { return size() == 0; }
+	/** Returns the number of elements in the container. */
+	size_type size() const { return keys().size(); }
+	/** Returns the maximum possible number of elements. */
+	size_type max_size() const { return keys().max_size(); }
+	/** Returns the number of elements that the container has currently allocated space for. */
+	size_type capacity() const { return max_size(); }
+
+	/** Removes all elements from the container. */
+	void clear() {
+		key_storage().clear();
+		value_storage().clear();
+	}
+
+	/**
+		Inserts value unless an element with the same key exists. Returns the
+		position of the element with that key and whether value was inserted,
+		or end() and false if the key is missing and the map is full.
+	*/
+	pair<iterator, bool> insert(const value_type& value) {
+		return insert_unique(value.first, value.second);
+	}
+	/**
+		Inserts the elements in the range [first, last) whose keys are not
+		present yet. The new elements are appended and sorted in a single
+		pass, rather than each being shifted into place.
+	*/
+	template<class InputIt>
+	void insert(InputIt first, InputIt last) {
+		while (first != last && size() < max_size()) {
+			const size_type sorted = size();
+
+			for (; first != last && size() < max_size(); ++first) {
+				if (!contains_sorted((*first).first, sorted)) {
+					key_storage().push_back((*first).first);
+					value_storage().push_back((*first).second);
+				}
+			}
+
+			sort_unique(sorted);
+		}
+	}
+
+	/** Inserts obj under key, or assigns it to the element with that key if there already is one. */
+	pair<iterator, bool> insert_or_assign(const key_type& key, const mapped_type& obj) {
+		const size_type pos = lower_index(key);
+
+		if (pos == size() || key_comp()(key, keys()[pos])) { return insert_at(pos, key, obj); }
+
+		value_storage()[pos] = obj;
+		return pair<iterator, bool>(begin() + difference_type(pos), false);
+	}
+
+#if __cplusplus >= 201103
+	/** Inserts a value constructed in-place from args under key, unless an element with that key exists. */
+	template<class... Args>
+	pair<iterator, bool> try_emplace(const key_type& key, Args&&... args) {
+		const size_type pos = lower_index(key);
+
+		if (pos != size() && !key_comp()(key, keys()[pos])) {
+			return pair<iterator, bool>(begin() + difference_type(pos), false);
+		}
+
+		if (size() == max_size()) { return pair<iterator, bool>(end(), false); }
+
+		key_storage().insert(keys().begin() + pos, key);
+		value_storage().emplace(values().begin() + pos, sstl::forward<Args>(args)...);
+		return pair<iterator, bool>(begin() + difference_type(pos), true);
+	}
+#endif
+
+	/** Removes specified elements from the container. */
+	iterator erase(const_iterator pos) {
+		return erase(pos, pos + 1);
+	}
+	iterator erase(const_iterator first, const_iterator last) {
+		const difference_type from = first - cbegin();
+		const difference_type to = last - cbegin();
+		key_storage().erase(keys().begin() + from, keys().begin() + to);
+		value_storage().erase(values().begin() + from, values().begin() + to);
+		return begin() + from;
+	}
+	/** Removes the element with the given key, returns the number of elements removed. */
+	size_type erase(const key_type& key) {
+		const const_iterator it = find(key);
+
+		if (it == cend()) { return 0; }
+
+		erase(it);
+		return 1;
+	}
+
+	/** Returns the number of elements with the given key, which is either 0 or 1. */
+	size_type count(const key_type& key) const { return contains(key) ? 1 : 0; }
+	/** Checks whether there is an element with the given key. */
+	bool contains(const key_type& key) const { return contains_sorted(key, size()); }
+
+	/** Finds the element with the given key, returns end() if there is none. */
+	iterator find(const key_type& key) {
+		const size_type pos = lower_index(key);
+		return pos != size() && !key_comp()(key, keys()[pos]) ? begin() + difference_type(pos) : end();
+	}
+	const_iterator find(const key_type& key) const {
+		const size_type pos = lower_index(key);
+		return pos != size() && !key_comp()(key, keys()[pos]) ? begin() + difference_type(pos) : end();
+	}
+
+	/** Returns an iterator to the first element whose key is not less than key. */
+	iterator lower_bound(const key_type& key) { return begin() + difference_type(lower_index(key)); }
+	const_iterator lower_bound(const key_type& key) const {
+		return begin() + difference_type(lower_index(key));
+	}
+
+	/** Returns an iterator to the first element whose key is greater than key. */
+	iterator upper_bound(const key_type& key) { return begin() + difference_type(upper_index(key)); }
+	const_iterator upper_bound(const key_type& key) const {
+		return begin() + difference_type(upper_index(key));
+	}
+
+	/** Returns the function object which compares the keys. */
+	key_compare key_comp() const { return key_compare(); }
+
+	/** Returns the sorted keys, which are contiguous so they can be scanned without touching the values. */
+	const vector<key_type>& keys() const { return static_cast<const child*>(this)->keys_; }
+	/** Returns the values, in the same order as their keys. */
+	const vector<mapped_type>& values() const { return *static_cast<const child*>(this)->values_ptr_; }
+
+  protected:
+	SSTL_CONSTEXPR flat_map() {}
+	~flat_map() {}
+
+	vector<key_type>& key_storage() { return static_cast<child*>(this)->keys_; }
+	vector<mapped_type>& value_storage() { return *static_cast<child*>(this)->values_ptr_; }
+
+  private:
+	/** Exchanges entries of the parallel key and value arrays, see detail::stable_sort_indexed. */
+	struct swapper {
+		swapper(key_type* k, mapped_type* v) : keys(k), values(v) {}
+
+		void operator()(size_t i, size_t j) const {
+			sstl::swap(keys[i], keys[j]);
+			sstl::swap(values[i], values[j]);
+		}
+
+		key_type* keys;
+		mapped_type* values;
+	};
+
+	size_type lower_index(const key_type& key) const {
+		return size_type(detail::branchless_lower_bound(keys().begin(), size(), key, key_comp()) -
+		                 keys().begin());
+	}
+	size_type upper_index(const key_type& key) const {
+		return size_type(detail::branchless_upper_bound(keys().begin(), size(), key, key_comp()) -
+		                 keys().begin());
+	}
+
+	/** Checks whether key is among the first count keys, which must be sorted. */
+	bool contains_sorted(const key_type& key, size_type count) const {
+		const key_type* it = detail::branchless_lower_bound(keys().begin(), count, key, key_comp());
+		return it != keys().begin() + count && !key_comp()(key, *it);
+	}
+
+	pair<iterator, bool> insert_unique(const key_type& key, const mapped_type& obj) {
+		const size_type pos = lower_index(key);
+
+		if (pos != size() && !key_comp()(key, keys()[pos])) {
+			return pair<iterator, bool>(begin() + difference_type(pos), false);
+		}
+
+		return insert_at(pos, key, obj);
+	}
+
+	pair<iterator, bool> insert_at(size_type pos, const key_type& key, const mapped_type& obj) {
+		if (size() == max_size()) { return pair<iterator, bool>(end(), false); }
+
+		key_storage().insert(keys().begin() + pos, key);
+		value_storage().insert(values().begin() + pos, obj);
+		return pair<iterator, bool>(begin() + difference_type(pos), true);
+	}
+
+	/**
+		Restores the order after elements were appended behind the first
+		sorted ones: sorts everything once, unless the appended keys already
+		follow on in order, then keeps the first element of each run of equal
+		keys. The sort is stable, so that is the one appended first.
+	*/
+	void sort_unique(size_type sorted) {
+		vector<key_type>& k = key_storage();
+		vector<mapped_type>& v = value_storage();
+		const key_compare comp = key_comp();
+		size_type ordered = sorted ? sorted : 1;
+
+		while (ordered < k.size() && comp(k[ordered - 1], k[ordered])) { ++ordered; }
+
+		if (ordered >= k.size()) { return; }
+
+		detail::stable_sort_indexed(k.data(), k.size(), comp, swapper(k.data(), v.data()));
+		size_type kept = 1;
+
+		for (size_type i = 1; i < k.size(); ++i) {
+			if (comp(k[kept - 1], k[i])) {
+				if (kept != i) {
+					k[kept] = sstl::move(k[i]);
+					v[kept] = sstl::move(v[i]);
+				}
+
+				++kept;
+			}
+		}
+
+		k.erase(k.begin() + kept, k.end());
+		v.erase(v.begin() + kept, v.end());
+	}
+};
+
+/** Child class with size-specific storage for the underlying key and value vectors. */
+template<typename K, typename V, size_t N, class Compare>
+class flat_map : public flat_map<K, V, 0, Compare> {
+	friend class flat_map<K, V, 0, Compare>;
+	typedef flat_map<K, V, 0, Compare> base;
+
+  public:
+	typedef typename base::key_type               key_type;
+	typedef typename base::mapped_type            mapped_type;
+	typedef typename base::value_type             value_type;
+	typedef typename base::key_compare            key_compare;
+	typedef typename base::reference              reference;
+	typedef typename base::const_reference        const_reference;
+	typedef typename base::size_type              size_type;
+	typedef typename base::difference_type        difference_type;
+	typedef typename base::iterator               iterator;
+	typedef typename base::const_iterator         const_iterator;
+	typedef typename base::reverse_iterator       reverse_iterator;
+	typedef typename base::const_reverse_iterator const_reverse_iterator;
+
+	/** Default constructor, a constant initializer for maps with static storage. */
+	SSTL_CONSTEXPR flat_map() : base(), values_ptr_(&values_), keys_(), values_() {}
+	/** Copy constructor. */
+	flat_map(const flat_map& other)
+		: base(), values_ptr_(&values_), keys_(other.keys_), values_(other.values_) {}
+	/** Copy adapter constructor, keeps the elements with the N smallest keys. */
+	flat_map(const base& other)
+		: base(), values_ptr_(&values_), keys_(other.keys()), values_(other.values()) {}
+#if __cplusplus >= 201103
+	/** Move constructor, leaves other empty. */
+	flat_map(flat_map&& other)
+		: base(), values_ptr_(&values_), keys_(sstl::move(other.keys_)),
+		  values_(sstl::move(other.values_)) {}
+#endif
+	/**
+		Constructs the map with the elements in the range [first, last),
+		sorting them once and keeping the first element for each key.
+	*/
+	template<class InputIt>
+	flat_map(InputIt first, InputIt last)
+		: base(), values_ptr_(&values_), keys_(), values_() {
+		base::insert(first, last);
+	}
+
+	/** Returns the maximum possible number of elements. */
+	SSTL_CONSTEXPR14 size_type max_size() const { return N; }
+	/** Returns the number of elements that the container has currently allocated space for. */
+	SSTL_CONSTEXPR14 size_type capacity() const { return N; }
+
+	/** Copy assignment operator. */
+	flat_map& operator=(const flat_map& rhs) {
+		base::operator=(rhs);
+		return *this;
+	}
+	/** Copy assignment operator for compatible flat map. */
+	flat_map& operator=(const base& rhs) {
+		base::operator=(rhs);
+		return *this;
+	}
+#if __cplusplus >= 201103
+	/** Move assignment operator, leaves rhs empty. */
+	flat_map& operator=(flat_map&& rhs) {
+		base::operator=(static_cast<base&&>(rhs));
+		return *this;
+	}
+#endif
+
+  private:
+	/** Points at values_, whose offset depends on N, so the base can reach it. */
+	vector<V>* values_ptr_;
+	vector<K, N> keys_;
+	vector<V, N> values_;
+};
+
+template<typename K, typename V, class Compare>
+inline bool operator==(const flat_map<K, V, 0, Compare>& lhs, const flat_map<K, V, 0, Compare>& rhs) {
+	return lhs.keys() == rhs.keys() && lhs.values() == rhs.values();
+}
+
+template<typename K, typename V, class Compare>
+inline bool operator!=(const flat_map<K, V, 0, Compare>& lhs, const flat_map<K, V, 0, Compare>& rhs) {
+	return !(lhs == rhs);
+}
+
+} /* namespace sstl */
+
+#endif /* STATIC_STL_FLAT_MAP_H_ */
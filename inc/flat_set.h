@@ -0,0 +1,277 @@
+#ifndef STATIC_STL_FLAT_SET_H_
+#define STATIC_STL_FLAT_SET_H_
+
+#include "algorithm.h"
+#include "functional.h"
+#include "iterator.h"
+#include "type_traits.h"
+#include "utility.h"
+#include "vector.h"
+
+namespace sstl {
+
+/**
+	Sorted associative container with unique keys and fixed capacity, kept
+	in a single sorted vector. Lookup is a binary search, insertion and
+	erasure shift the elements after the position.
+*/
+template<typename K, size_t N = 0, class Compare = less<K> >
+class flat_set;
+
+/** Common zero-size base class for all flat sets. */
+template<typename K, class Compare>
+class flat_set<K, 0, Compare> {
+	typedef flat_set<K, 8, Compare> child;
+
+  public:
+	typedef K                                      key_type;
+	typedef K                                      value_type;
+	typedef Compare                                key_compare;
+	typedef Compare                                value_compare;
+	typedef const value_type*                      pointer;
+	typedef const value_type*                      const_pointer;
+	typedef const value_type&                      reference;
+	typedef const value_type&                      const_reference;
+	typedef size_t                                 size_type;
+	typedef ptrdiff_t                              difference_type;
+	typedef const_pointer                          iterator;
+	typedef const_pointer                          const_iterator;
+	typedef sstl::reverse_iterator<iterator>       reverse_iterator;
+	typedef sstl::reverse_iterator<const_iterator> const_reverse_iterator;
+
+	/** Copy assignment operator. */
+	flat_set& operator=(const flat_set& rhs) {
+		storage() = rhs.storage();
+		return *this;
+	}
+#if __cplusplus >= 201103
+	/** Move assignment operator, leaves rhs empty. */
+	flat_set& operator=(flat_set&& rhs) {
+		storage() = sstl::move(rhs.storage());
+		return *this;
+	}
+#endif
+
+	/** Returns an iterator to the first element of the container. */
+	const_iterator begin() const { return storage().begin(); }
+	const_iterator cbegin() const { return begin(); }
+
+	/** Returns an iterator to the element following the last element of the container. */
+	const_iterator end() const { return storage().end(); }
+	const_iterator cend() const { return end(); }
+
+	/** Returns a reverse iterator to the first element of the reversed container. */
+	const_reverse_iterator rbegin() const { return const_reverse_iterator(end()); }
+	const_reverse_iterator crbegin() const { return rbegin(); }
+
+	/** Returns a reverse iterator to the element following the last element of the reversed container. */
+	const_reverse_iterator rend() const { return const_reverse_iterator(begin()); }
+	const_reverse_iterator crend() const { return rend(); }
+
+	/** Checks whether the container has no elements. */
+	bool empty() const { return size() == 0; }
+	/** Returns the number of elements in the container. */
+	size_type size() const { return storage().size(); }
+	/** Returns the maximum possible number of elements. */
+	size_type max_size() const { return storage().max_size(); }
+	/** Returns the number of elements that the container has currently allocated space for. */
+	size_type capacity() const { return max_size(); }
+
+	/** Removes all elements from the container. */
+	void clear() { storage().clear(); }
+
+	/**
+		Inserts value unless an equal key exists. Returns the position of the
+		element equal to value and whether value was inserted, or end() and
+		false if value is missing and the set is full.
+	*/
+	pair<iterator, bool> insert(const value_type& value) {
+		const iterator pos = lower_bound(value);
+
+		if (pos != end() && !key_comp()(value, *pos)) { return pair<iterator, bool>(pos, false); }
+
+		if (size() == max_size()) { return pair<iterator, bool>(end(), false); }
+
+		return pair<iterator, bool>(storage().insert(pos, value), true);
+	}
+	/**
+		Inserts the keys in the range [first, last) which are not present yet.
+		The new keys are appended and sorted in a single pass, rather than each
+		being shifted into place.
+	*/
+	template<class InputIt>
+	void insert(InputIt first, InputIt last) {
+		while (first != last && size() < max_size()) {
+			const size_type sorted = size();
+
+			for (; first != last && size() < max_size(); ++first) {
+				if (!contains_sorted(*first, sorted)) { storage().push_back(*first); }
+			}
+
+			sort_unique(sorted);
+		}
+	}
+
+	/** Removes specified elements from the container. */
+	iterator erase(const_iterator pos) { return storage().erase(pos); }
+	iterator erase(const_iterator first, const_iterator last) { return storage().erase(first, last); }
+	/** Removes the element equal to key, returns the number of elements removed. */
+	size_type erase(const key_type& key) {
+		const const_iterator it = find(key);
+
+		if (it == end()) { return 0; }
+
+		erase(it);
+		return 1;
+	}
+
+	/** Returns the number of elements equal to key, which is either 0 or 1. */
+	size_type count(const key_type& key) const { return contains(key) ? 1 : 0; }
+	/** Checks whether there is an element equal to key. */
+	bool contains(const key_type& key) const { return contains_sorted(key, size()); }
+
+	/** Finds the element equal to key, returns end() if there is none. */
+	const_iterator find(const key_type& key) const {
+		const const_iterator pos = lower_bound(key);
+		return pos != end() && !key_comp()(key, *pos) ? pos : end();
+	}
+
+	/** Returns an iterator to the first element which is not less than key. */
+	const_iterator lower_bound(const key_type& key) const {
+		return detail::branchless_lower_bound(begin(), size(), key, key_comp());
+	}
+	/** Returns an iterator to the first element which is greater than key. */
+	const_iterator upper_bound(const key_type& key) const {
+		return detail::branchless_upper_bound(begin(), size(), key, key_comp());
+	}
+
+	/** Returns the function object which compares the keys. */
+	key_compare key_comp() const { return key_compare(); }
+	/** Returns the function object which compares the values, the same as key_comp(). */
+	value_compare value_comp() const { return value_compare(); }
+
+  protected:
+	SSTL_CONSTEXPR flat_set() {}
+	~flat_set() {}
+
+	vector<key_type>& storage() { return static_cast<child*>(this)->keys_; }
+	const vector<key_type>& storage() const { return static_cast<const child*>(this)->keys_; }
+
+  private:
+	/** Checks whether key is among the first count keys, which must be sorted. */
+	bool contains_sorted(const key_type& key, size_type count) const {
+		const const_iterator it = detail::branchless_lower_bound(begin(), count, key, key_comp());
+		return it != begin() + count && !key_comp()(key, *it);
+	}
+
+	/**
+		Restores the order after keys were appended behind the first sorted
+		ones: sorts everything once, unless the appended keys already follow
+		on in order, then keeps the first key of each run of equal keys. The
+		sort is stable, so that is the one appended first.
+	*/
+	void sort_unique(size_type sorted) {
+		vector<key_type>& k = storage();
+		const key_compare comp = key_comp();
+		size_type ordered = sorted ? sorted : 1;
+
+		while (ordered < k.size() && comp(k[ordered - 1], k[ordered])) { ++ordered; }
+
+		if (ordered >= k.size()) { return; }
+
+		sstl::stable_sort(k.begin(), k.end(), comp);
+		size_type kept = 1;
+
+		for (size_type i = 1; i < k.size(); ++i) {
+			if (comp(k[kept - 1], k[i])) {
+				if (kept != i) { k[kept] = sstl::move(k[i]); }
+
+				++kept;
+			}
+		}
+
+		k.erase(k.begin() + kept, k.end());
+	}
+};
+
+/** Child class with size-specific storage for the underlying vector. */
+template<typename K, size_t N, class Compare>
+class flat_set : public flat_set<K, 0, Compare> {
+	friend class flat_set<K, 0, Compare>;
+	typedef flat_set<K, 0, Compare> base;
+
+  public:
+	typedef typename base::key_type               key_type;
+	typedef typename base::value_type             value_type;
+	typedef typename base::key_compare            key_compare;
+	typedef typename base::value_compare          value_compare;
+	typedef typename base::pointer                pointer;
+	typedef typename base::const_pointer          const_pointer;
+	typedef typename base::reference              reference;
+	typedef typename base::const_reference        const_reference;
+	typedef typename base::size_type              size_type;
+	typedef typename base::difference_type        difference_type;
+	typedef typename base::iterator               iterator;
+	typedef typename base::const_iterator         const_iterator;
+	typedef typename base::reverse_iterator       reverse_iterator;
+	typedef typename base::const_reverse_iterator const_reverse_iterator;
+
+	/** Default constructor, a constant initializer for sets with static storage. */
+	SSTL_CONSTEXPR flat_set() : base(), keys_() {}
+	/** Copy constructor. */
+	flat_set(const flat_set& other) : base(), keys_(other.keys_) {}
+	/** Copy adapter constructor, keeps the N smallest keys. */
+	flat_set(const base& other) : base(), keys_(other.begin(), other.begin() + sstl::min(other.size(), N)) {}
+#if __cplusplus >= 201103
+	/** Move constructor, leaves other empty. */
+	flat_set(flat_set&& other) : base(), keys_(sstl::move(other.keys_)) {}
+#endif
+	/**
+		Constructs the set with the keys in the range [first, last), sorting
+		them once and keeping the first of each run of equal keys.
+	*/
+	template<class InputIt>
+	flat_set(InputIt first, InputIt last) : base(), keys_() {
+		base::insert(first, last);
+	}
+
+	/** Returns the maximum possible number of elements. */
+	SSTL_CONSTEXPR14 size_type max_size() const { return N; }
+	/** Returns the number of elements that the container has currently allocated space for. */
+	SSTL_CONSTEXPR14 size_type capacity() const { return N; }
+
+	/** Copy assignment operator. */
+	flat_set& operator=(const flat_set& rhs) {
+		base::operator=(rhs);
+		return *this;
+	}
+	/** Copy assignment operator for compatible flat set. */
+	flat_set& operator=(const base& rhs) {
+		base::operator=(rhs);
+		return *this;
+	}
+#if __cplusplus >= 201103
+	/** Move assignment operator, leaves rhs empty. */
+	flat_set& operator=(flat_set&& rhs) {
+		base::operator=(static_cast<base&&>(rhs));
+		return *this;
+	}
+#endif
+
+  private:
+	vector<K, N> keys_;
+};
+
+template<typename K, class Compare>
+inline bool operator==(const flat_set<K, 0, Compare>& lhs, const flat_set<K, 0, Compare>& rhs) {
+	return lhs.size() == rhs.size() && sstl::equal(lhs.begin(), lhs.end(), rhs.begin());
+}
+
+template<typename K, class Compare>
+inline bool operator!=(const flat_set<K, 0, Compare>& lhs, const flat_set<K, 0, Compare>& rhs) {
+	return !(lhs == rhs);
+}
+
+} /* namespace sstl */
+
+#endif /* STATIC_STL_FLAT_SET_H_ */
@@ -0,0 +1,109 @@
+#ifndef STATIC_STL_FUNCTIONAL_H_
+#define STATIC_STL_FUNCTIONAL_H_
+
+#include <string.h>
+
+#include "type_traits.h"
+
+namespace sstl {
+
+/** Function object for performing comparisons, invokes operator< on type T. */
+template<typename T>
+struct less {
+	typedef T    first_argument_type;
+	typedef T    second_argument_type;
+	typedef bool result_type;
+
+	SSTL_CONSTEXPR bool operator()(const T& lhs, const T& rhs) const { return lhs < rhs; }
+};
+
+/** Function object for performing comparisons, invokes operator< on type T with swapped arguments. */
+template<typename T>
+struct greater {
+	typedef T    first_argument_type;
+	typedef T    second_argument_type;
+	typedef bool result_type;
+
+	SSTL_CONSTEXPR bool operator()(const T& lhs, const T& rhs) const { return rhs < lhs; }
+};
+
+/** Function object for performing comparisons, invokes operator== on type T. */
+template<typename T>
+struct equal_to {
+	typedef T    first_argument_type;
+	typedef T    second_argument_type;
+	typedef bool result_type;
+
+	SSTL_CONSTEXPR bool operator()(const T& lhs, const T& rhs) const { return lhs == rhs; }
+};
+
+/**
+	Hash function object, the value itself for integral and enumeration
+	types and the bit pattern for floating-point types. Other key types need
+	a specialization. Hash tables scramble the
+	result, so this does not need to spread the bits itself.
+*/
+template<typename T>
+struct hash {
+	typedef T      argument_type;
+	typedef size_t result_type;
+
+	SSTL_CONSTEXPR size_t operator()(const T& value) const { return size_t(value); }
+};
+
+namespace detail {
+/** Hashes the bit pattern of a float, with -0.0 folded onto +0.0 since the two compare equal. */
+inline size_t hash_bits(float value) {
+	uint32_t bits = 0;
+
+	if (value != 0.0f) { memcpy(&bits, &value, sizeof(bits)); }
+
+	return size_t(bits);
+}
+
+/** Hashes the bit pattern of a double, with -0.0 folded onto +0.0 since the two compare equal. */
+inline size_t hash_bits(double value) {
+	uint64_t bits = 0;
+
+	if (value != 0.0) { memcpy(&bits, &value, sizeof(bits)); }
+
+	return size_t(bits ^ (bits >> 32));
+}
+} /* namespace detail */
+
+template<>
+struct hash<float> {
+	typedef float  argument_type;
+	typedef size_t result_type;
+
+	size_t operator()(float value) const { return detail::hash_bits(value); }
+};
+
+template<>
+struct hash<double> {
+	typedef double argument_type;
+	typedef size_t result_type;
+
+	size_t operator()(double value) const { return detail::hash_bits(value); }
+};
+
+/** Hashed as the nearest double, since long double has padding bits on some targets. */
+template<>
+struct hash<long double> {
+	typedef long double argument_type;
+	typedef size_t      result_type;
+
+	size_t operator()(long double value) const { return detail::hash_bits(static_cast<double>(value)); }
+};
+
+template<typename T>
+struct hash<T*> {
+	typedef T*     argument_type;
+	typedef size_t result_type;
+
+	size_t operator()(T* value) const { return reinterpret_cast<size_t>(value); }
+};
+
+} /* namespace sstl */
+
+#endif /* STATIC_STL_FUNCTIONAL_H_ */
@@ -0,0 +1,391 @@
+#ifndef STATIC_STL_HASH_TABLE_H_
+#define STATIC_STL_HASH_TABLE_H_
+
+#include <float.h>
+#include <new>
+#include <string.h>
+
+#include "algorithm.h"
+#include "array.h"
+#include "iterator.h"
+#include "memory.h"
+#include "type_traits.h"
+#include "utility.h"
+
+#if SSTL_HAS_SSE2
+#include <emmintrin.h>
+#endif
+
+namespace sstl {
+
+namespace detail {
+/*
+ * Open addressing with linear probing over a control byte array, in the
+ * style of Swiss tables. Each slot has a control byte which is either empty
+ * (zero, so a zero initialized table is empty) or 0x80 plus 7 bits of the
+ * slot's hash. A probe loads the control bytes of 16 consecutive slots at
+ * once and only compares keys where the 7 bits match. The first 15 control
+ * bytes are cloned after the last one, so a probe never has to split a load
+ * at the end of the table.
+ *
+ * Erasing shifts the following elements of the probe run back instead of
+ * leaving a tombstone, so lookups never have to step over deleted slots.
+ */
+
+/** Number of control bytes compared at once. */
+const size_t hash_group_width = 16;
+
+/** Control byte of an empty slot. */
+const uint8_t hash_ctrl_empty = 0;
+
+/** Scrambles a hash so every bit of it affects both the home slot and the control tag. */
+inline size_t hash_mix(size_t h) {
+	const uint64_t m = uint64_t(h) * UINT64_C(0x9E3779B97F4A7C15);
+	return size_t(m ^ (m >> 32));
+}
+
+/** Returns the control byte of a full slot with scrambled hash h. */
+inline uint8_t hash_tag(size_t h) { return uint8_t(0x80 | (h & 0x7F)); }
+
+/** Returns the home slot of scrambled hash h in a table of mask + 1 slots. */
+inline size_t hash_home(size_t h, size_t mask) { return (h >> 7) & mask; }
+
+/** Control bytes of hash_group_width consecutive slots, matched all at once into a bit mask. */
+class hash_group {
+  public:
+#if SSTL_HAS_SSE2
+	explicit hash_group(const uint8_t* ctrl)
+		: ctrl_(_mm_loadu_si128(reinterpret_cast<const __m128i*>(ctrl))) {}
+
+	/** Returns a bit for each slot whose control byte is tag. */
+	uint32_t match(uint8_t tag) const {
+		return uint32_t(_mm_movemask_epi8(_mm_cmpeq_epi8(ctrl_, _mm_set1_epi8(char(tag)))));
+	}
+	/** Returns a bit for each full slot. */
+	uint32_t match_full() const { return uint32_t(_mm_movemask_epi8(ctrl_)); }
+
+  private:
+	__m128i ctrl_;
+#else
+	explicit hash_group(const uint8_t* ctrl) : ctrl_(ctrl) {}
+
+	/** Returns a bit for each slot whose control byte is tag. */
+	uint32_t match(uint8_t tag) const {
+		uint32_t bits = 0;
+
+		for (size_t i = 0; i < hash_group_width; ++i) { bits |= uint32_t(ctrl_[i] == tag) << i; }
+
+		return bits;
+	}
+	/** Returns a bit for each full slot. */
+	uint32_t match_full() const {
+		uint32_t bits = 0;
+
+		for (size_t i = 0; i < hash_group_width; ++i) { bits |= uint32_t(ctrl_[i] >> 7) << i; }
+
+		return bits;
+	}
+
+  private:
+	const uint8_t* ctrl_;
+#endif
+
+  public:
+	/** Returns a bit for each empty slot. */
+	uint32_t match_empty() const { return match(hash_ctrl_empty); }
+};
+
+/** Returns the first full slot at or after pos, or count if there is none. */
+inline size_t hash_next_full(const uint8_t* ctrl, size_t pos, size_t count) {
+	for (; pos < count; pos += hash_group_width) {
+		const uint32_t bits = hash_group(ctrl + pos).match_full();
+
+		if (bits) { return sstl::min(pos + lowest_bit(bits), count); }
+	}
+
+	return count;
+}
+
+/**
+	Number of slots for a table of N elements: enough to stay at or below a
+	load of 7/8, rounded up to a power of two and to at least one group.
+*/
+template<size_t N>
+struct hash_slot_count {
+	static const size_t wanted = N + (N + 6) / 7;
+	static const size_t value = next_power_of_two < (wanted < hash_group_width ?
+	                                                 hash_group_width : wanted) >::value;
+};
+
+/** Forward iterator over the full slots of a hash table. */
+template<typename T>
+class hash_iterator {
+	template<typename> friend class hash_iterator;
+
+  public:
+	typedef forward_iterator_tag           iterator_category;
+	typedef typename remove_const<T>::type value_type;
+	typedef T*                             pointer;
+	typedef T&                             reference;
+	typedef ptrdiff_t                      difference_type;
+
+	/** Default constructor. */
+	hash_iterator() : ctrl_(0), slots_(0), pos_(0), count_(0) {}
+	/**
+		Converts an iterator into a const iterator. A template, so the
+		implicit copy constructor and assignment stay trivial.
+	*/
+	template<typename U>
+	hash_iterator(const hash_iterator<U>& other)
+		: ctrl_(other.ctrl_), slots_(other.slots_), pos_(other.pos_), count_(other.count_) {}
+	/** Construct at slot pos, which must be full or count, of a table with count slots. */
+	hash_iterator(const uint8_t* ctrl, pointer slots, size_t pos, size_t count)
+		: ctrl_(ctrl), slots_(slots), pos_(pos), count_(count) {}
+
+	/** Returns a reference to the current element. */
+	reference operator*() const { return slots_[pos_]; }
+	/** Returns a pointer to the current element. */
+	pointer operator->() const { return &slots_[pos_]; }
+	/** Pre-increments the iterator. */
+	hash_iterator& operator++() { pos_ = hash_next_full(ctrl_, pos_ + 1, count_); return *this; }
+	/** Post-increments the iterator. */
+	hash_iterator operator++(int) { hash_iterator tmp(*this); ++*this; return tmp; }
+
+	template<typename U>
+	bool operator==(const hash_iterator<U>& rhs) const { return pos_ == rhs.pos_; }
+	template<typename U>
+	bool operator!=(const hash_iterator<U>& rhs) const { return pos_ != rhs.pos_; }
+
+	/** Returns the index of the current slot. */
+	size_t index() const { return pos_; }
+
+  private:
+	const uint8_t* ctrl_;
+	pointer slots_;
+	size_t pos_;
+	size_t count_;
+};
+
+/**
+	Hash table storage and probing shared by unordered_map and unordered_set.
+	Traits provides key_type, slot_type, hasher, key_equal and a static
+	key(slot) which returns the key stored in a slot.
+*/
+template<class Traits, size_t S = 0>
+class hash_table;
+
+/** Common zero-size base class for all hash tables. */
+template<class Traits>
+class hash_table<Traits> {
+	typedef hash_table<Traits, hash_group_width> child;
+
+  public:
+	typedef typename Traits::key_type  key_type;
+	typedef typename Traits::slot_type slot_type;
+	typedef typename Traits::hasher    hasher;
+	typedef typename Traits::key_equal key_equal;
+	typedef size_t                     size_type;
+
+	/** Returns the number of elements. */
+	size_type size() const { return static_cast<const child*>(this)->size_; }
+	/** Returns the number of elements the table was sized for. */
+	size_type max_size() const { return static_cast<const child*>(this)->capacity_; }
+	/** Returns the number of elements allowed by the maximum load factor, at most max_size(). */
+	size_type limit() const { return static_cast<const child*>(this)->limit_; }
+	/** Returns the number of slots. */
+	size_type bucket_count() const { return size_type(static_cast<const child*>(this)->mask_) + 1; }
+
+	/**
+		Caps the number of elements at ml times bucket_count(), and at
+		max_size(). ml is clamped to at most 1, and values which are not
+		positive and finite leave the cap unchanged.
+	*/
+	void max_load_factor(float ml) {
+		if (!(ml > 0.0f && ml <= FLT_MAX)) { return; }
+
+		const float count = (ml < 1.0f ? ml : 1.0f) * float(bucket_count());
+		static_cast<child*>(this)->limit_ = stored_size_type(count < float(max_size()) ? count : max_size());
+	}
+
+	/** Returns a pointer to the first slot. */
+	slot_type* slots() {
+		return reinterpret_cast<slot_type*>(static_cast<child*>(this)->storage_.data_);
+	}
+	const slot_type* slots() const {
+		return reinterpret_cast<const slot_type*>(static_cast<const child*>(this)->storage_.data_);
+	}
+	/** Returns the control bytes, which directly follow the slots. */
+	const uint8_t* control() const {
+		return reinterpret_cast<const uint8_t*>(static_cast<const child*>(this)->storage_.data_) +
+		       bucket_count() * sizeof(element);
+	}
+
+	/** Returns the first full slot at or after pos, or bucket_count() if there is none. */
+	size_type next_full(size_type pos) const { return hash_next_full(control(), pos, bucket_count()); }
+
+	/** Returns the slot holding key, or bucket_count() if there is none. */
+	size_type find(const key_type& key) const {
+		const size_t h = hash_mix(hasher()(key));
+		const uint8_t tag = hash_tag(h);
+		const size_type mask = bucket_count() - 1;
+		const uint8_t* ctrl = control();
+		const slot_type* s = slots();
+
+		for (size_type pos = hash_home(h, mask);; pos = (pos + hash_group_width) & mask) {
+			const hash_group group(ctrl + pos);
+
+			for (uint32_t bits = group.match(tag); bits; bits &= bits - 1) {
+				const size_type i = (pos + lowest_bit(bits)) & mask;
+
+				if (key_equal()(Traits::key(s[i]), key)) { return i; }
+			}
+
+			if (group.match_empty()) { return mask + 1; }
+		}
+	}
+
+	/**
+		Returns the slot holding key and false, or claims an empty slot for
+		key and returns it and true. The caller must construct the element in
+		a claimed slot straight away. Returns bucket_count() and false if key
+		is missing and the table is at its limit.
+	*/
+	pair<size_type, bool> claim(const key_type& key) {
+		const size_t h = hash_mix(hasher()(key));
+		const uint8_t tag = hash_tag(h);
+		const size_type mask = bucket_count() - 1;
+		const uint8_t* ctrl = control();
+		const slot_type* s = slots();
+
+		for (size_type pos = hash_home(h, mask);; pos = (pos + hash_group_width) & mask) {
+			const hash_group group(ctrl + pos);
+
+			for (uint32_t bits = group.match(tag); bits; bits &= bits - 1) {
+				const size_type i = (pos + lowest_bit(bits)) & mask;
+
+				if (key_equal()(Traits::key(s[i]), key)) { return pair<size_type, bool>(i, false); }
+			}
+
+			if (const uint32_t empty = group.match_empty()) {
+				if (size() >= limit()) { return pair<size_type, bool>(mask + 1, false); }
+
+				const size_type i = (pos + lowest_bit(empty)) & mask;
+				set_control(i, tag);
+				++static_cast<child*>(this)->size_;
+				return pair<size_type, bool>(i, true);
+			}
+		}
+	}
+
+	/**
+		Destroys the element in slot i, then moves later elements of the same
+		probe run back into the gap, so no tombstone is left behind.
+	*/
+	void erase(size_type i) {
+		const size_type mask = bucket_count() - 1;
+		slot_type* s = slots();
+		size_type hole = i;
+
+		sstl::destroy_at(s + i);
+
+		for (size_type j = (i + 1) & mask; control()[j] != hash_ctrl_empty; j = (j + 1) & mask) {
+			const size_type home = hash_home(hash_mix(hasher()(Traits::key(s[j]))), mask);
+
+			/* Only move an element whose home is not between the hole and itself. */
+			if (((j - home) & mask) >= ((j - hole) & mask)) {
+				new(static_cast<void*>(s + hole)) slot_type(sstl::move(s[j]));
+				sstl::destroy_at(s + j);
+				set_control(hole, control()[j]);
+				hole = j;
+			}
+		}
+
+		set_control(hole, hash_ctrl_empty);
+		--static_cast<child*>(this)->size_;
+	}
+
+	/** Destroys every element. */
+	void clear() {
+		destroy_elements();
+		memset(control_bytes(), hash_ctrl_empty, bucket_count() + hash_group_width - 1);
+		static_cast<child*>(this)->size_ = 0;
+	}
+
+  protected:
+	SSTL_CONSTEXPR hash_table() {}
+	~hash_table() {}
+
+	void destroy_elements() {
+		typedef typename is_trivially_destructible<slot_type>::type trivial;
+		destroy_dispatch(trivial());
+	}
+
+  private:
+	typedef typename
+	aligned_storage<sizeof(slot_type), alignment_of<slot_type>::value>::type element;
+
+	hash_table(const hash_table&);
+	hash_table& operator=(const hash_table&);
+
+	uint8_t* control_bytes() { return const_cast<uint8_t*>(control()); }
+
+	/** Sets the control byte of slot i, and its clone if it has one. */
+	void set_control(size_type i, uint8_t value) {
+		uint8_t* ctrl = control_bytes();
+		ctrl[i] = value;
+
+		if (i < hash_group_width - 1) { ctrl[bucket_count() + i] = value; }
+	}
+
+	void destroy_dispatch(true_type) {}
+	void destroy_dispatch(false_type) {
+		for (size_type i = next_full(0); i < bucket_count(); i = next_full(i + 1)) {
+			sstl::destroy_at(slots() + i);
+		}
+	}
+};
+
+/** Child class with storage for S slots, S being a power of two of at least hash_group_width. */
+template<class Traits, size_t S>
+class hash_table : public hash_table<Traits> {
+	friend class hash_table<Traits>;
+	typedef hash_table<Traits> base;
+
+  public:
+	/** Constructs an empty table which holds up to capacity elements, a constant initializer. */
+	SSTL_CONSTEXPR explicit hash_table(size_t capacity)
+		: base(), capacity_(stored_size_type(capacity)), size_(0),
+		  limit_(stored_size_type(capacity)), mask_(S - 1), storage_(), control_() {}
+
+	~hash_table() { base::destroy_elements(); }
+
+  private:
+	typedef typename base::slot_type slot_type;
+	typedef typename
+	aligned_storage<sizeof(slot_type), alignment_of<slot_type>::value>::type element;
+
+	typedef typename check_capacity<S>::type capacity_fits;
+
+	stored_size_type capacity_;
+	stored_size_type size_;
+	stored_size_type limit_;
+	stored_size_type mask_;
+
+	/** Slot storage, see vector for why it is wrapped in a union. */
+	union storage {
+		struct empty {};
+
+		SSTL_CONSTEXPR storage() : empty_() {}
+
+		empty empty_;
+		element data_[S];
+	} storage_;
+
+	/** Control bytes, found by the base right after the slots. */
+	uint8_t control_[S + hash_group_width - 1];
+};
+} /* namespace detail */
+
+} /* namespace sstl */
+
+#endif /* STATIC_STL_HASH_TABLE_H_ */
@@ -0,0 +1,136 @@
+#ifndef STATIC_STL_INSTRUMENT_H_
+#define STATIC_STL_INSTRUMENT_H_
+
+/**
+	When non-zero, vectors and lists count how they are used in a
+	container_stats member and list themselves in a registry on their
+	first modification, so the sizes chosen for N can be checked against
+	what a running system needs. Off by default, when the containers carry
+	no counters, the hooks compile to nothing and this header declares
+	nothing else.
+*/
+#ifndef SSTL_INSTRUMENT
+#	define SSTL_INSTRUMENT 0
+#endif
+
+#if SSTL_INSTRUMENT
+#include <stdio.h>
+
+#include "type_traits.h"
+
+namespace sstl {
+
+/**
+	Usage counters of one instrumented container. The counters belong to
+	the instance: copies start from zero, and assigning containers leaves
+	them alone.
+
+	Nothing is synchronized, containers shared between threads need the
+	same external locking for their counters as for their elements.
+*/
+class container_stats {
+  public:
+	/** Label shown by dump_container_stats(), set it to tell containers apart. */
+	const char* name;
+	/** Kind of container, set on registration. */
+	const char* type;
+	/** Maximum number of elements, set on registration. */
+	size_t capacity;
+	/** Number of elements after the last modification. */
+	size_t size;
+	/** Largest number of elements held at once. */
+	size_t high_water;
+	/** Elements which did not fit and were dropped. */
+	size_t drops;
+	/** Elements shifted to open or close a gap by insert and erase. */
+	size_t moves;
+	/** Number of modifying calls. */
+	size_t operations;
+
+	SSTL_CONSTEXPR container_stats()
+		: name(0), type(0), capacity(0), size(0), high_water(0), drops(0), moves(0), operations(0),
+		  prev_(0), next_(0) {}
+	/** Copies start with their own counters. */
+	container_stats(const container_stats&)
+		: name(0), type(0), capacity(0), size(0), high_water(0), drops(0), moves(0), operations(0),
+		  prev_(0), next_(0) {}
+	/** Counters stay with their instance. */
+	container_stats& operator=(const container_stats&) { return *this; }
+
+	~container_stats() { unlink(); }
+
+	/** Returns the most recently registered container, null if there is none. */
+	static const container_stats* first() { return head(); }
+	/** Returns the container registered before this one, null at the end. */
+	const container_stats* next() const { return next_; }
+
+	/** Checks whether the container is in the registry. */
+	bool registered() const { return type != 0; }
+
+	/** Counts a modification which left size elements, dropping dropped and shifting moved. */
+	void record(const char* kind, size_t max_size, size_t size_after, size_t dropped, size_t moved) {
+		if (!registered()) { link(kind, max_size); }
+
+		size = size_after;
+		high_water = size_after > high_water ? size_after : high_water;
+		drops += dropped;
+		moves += moved;
+		++operations;
+	}
+
+  private:
+	/** Head of the registry, a function-local static so the header needs no definition elsewhere. */
+	static container_stats*& head() {
+		static container_stats* first = 0;
+		return first;
+	}
+
+	void link(const char* kind, size_t max_size) {
+		type = kind;
+		capacity = max_size;
+		next_ = head();
+
+		if (next_) { next_->prev_ = this; }
+
+		head() = this;
+	}
+	void unlink() {
+		if (!registered()) { return; }
+
+		if (prev_) {
+			prev_->next_ = next_;
+		} else {
+			head() = next_;
+		}
+
+		if (next_) { next_->prev_ = prev_; }
+	}
+
+	container_stats* prev_;
+	container_stats* next_;
+};
+
+/**
+	Writes one line per registered container to out: its name, type, size
+	and capacity, high-water mark with the share of the capacity it
+	reached, drops, moves and operations.
+*/
+inline void dump_container_stats(FILE* out) {
+	fprintf(out, "%-24s %-8s %10s %10s %10s %6s %10s %10s %10s\n",
+	        "name", "type", "size", "capacity", "high", "used", "drops", "moves", "operations");
+
+	for (const container_stats* s = container_stats::first(); s; s = s->next()) {
+		fprintf(out, "%-24s %-8s %10lu %10lu %10lu %5lu%% %10lu %10lu %10lu\n",
+		        s->name ? s->name : "-", s->type,
+		        static_cast<unsigned long>(s->size), static_cast<unsigned long>(s->capacity),
+		        static_cast<unsigned long>(s->high_water),
+		        static_cast<unsigned long>(s->capacity ? s->high_water * 100 / s->capacity : 0),
+		        static_cast<unsigned long>(s->drops), static_cast<unsigned long>(s->moves),
+		        static_cast<unsigned long>(s->operations));
+	}
+}
+
+} /* namespace sstl */
+#endif
+
+#endif /* STATIC_STL_INSTRUMENT_H_ */
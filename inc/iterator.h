@@ -41,6 +41,69 @@ struct iterator_traits<const T*> {
 	typedef ptrdiff_t                  difference_type;
 };
 
+namespace detail {
+template<class InputIt>
+inline typename iterator_traits<InputIt>::difference_type distance(
+    InputIt first, InputIt last, input_iterator_tag) {
+	typename iterator_traits<InputIt>::difference_type size = 0;
+
+	while (first != last) { ++size; ++first; }
+
+	return size;
+}
+template<class RandomIt>
+inline typename iterator_traits<RandomIt>::difference_type distance(
+    RandomIt first, RandomIt last, random_access_iterator_tag) {
+	return last - first;
+}
+
+template<class InputIt, class Distance>
+inline void advance(InputIt& it, Distance n, input_iterator_tag) {
+	for (; n > 0; --n) { ++it; }
+}
+template<class BidirIt, class Distance>
+inline void advance(BidirIt& it, Distance n, bidirectional_iterator_tag) {
+	for (; n > 0; --n) { ++it; }
+
+	for (; n < 0; ++n) { --it; }
+}
+template<class RandomIt, class Distance>
+inline void advance(RandomIt& it, Distance n, random_access_iterator_tag) {
+	it += n;
+}
+} /* namespace detail */
+
+/** Returns the number of hops from first to last. */
+template<class InputIt>
+inline typename iterator_traits<InputIt>::difference_type distance(
+    InputIt first, InputIt last) {
+	typedef typename iterator_traits<InputIt>::iterator_category category;
+	return detail::distance(first, last, category());
+}
+
+/** Increments the given iterator it by n elements, or decrements it if n is negative. */
+template<class InputIt, class Distance>
+inline void advance(InputIt& it, Distance n) {
+	typedef typename iterator_traits<InputIt>::iterator_category category;
+	detail::advance(it, n, category());
+}
+
+/** Returns the nth successor of iterator it. */
+template<class ForwardIt>
+inline ForwardIt next(ForwardIt it,
+                      typename iterator_traits<ForwardIt>::difference_type n = 1) {
+	sstl::advance(it, n);
+	return it;
+}
+
+/** Returns the nth predecessor of iterator it. */
+template<class BidirIt>
+inline BidirIt prev(BidirIt it,
+                    typename iterator_traits<BidirIt>::difference_type n = 1) {
+	sstl::advance(it, -n);
+	return it;
+}
+
 template<class Iterator>
 class reverse_iterator {
   public:
@@ -75,19 +138,19 @@ class reverse_iterator {
 	/** Pre-increments the iterator, applied in reverse. */
 	reverse_iterator& operator++() { --it_; return *this; }
 	/** Post-increments the iterator, applied in reverse. */
-	reverse_iterator operator++(int) { reverse_iterator tmp(*this); --it_; return *tmp; }
+	reverse_iterator operator++(int) { reverse_iterator tmp(*this); --it_; return tmp; }
 	/** Pre-decrements the iterator, applied in reverse. */
 	reverse_iterator& operator--() { ++it_; return *this; }
 	/** Post-decrements the iterator, applied in reverse. */
-	reverse_iterator operator--(int) { reverse_iterator tmp(*this); ++it_; return *tmp; }
+	reverse_iterator operator--(int) { reverse_iterator tmp(*this); ++it_; return tmp; }
 	/** Returns an iterator which is advanced by n positions. */
-	reverse_iterator operator+(difference_type n) const { return reverse_iterator(it_ - n); }
+	reverse_iterator operator+(difference_type n) const { return reverse_iterator(sstl::prev(it_, n)); }
 	/** Returns an iterator which is advanced by -n positions. */
-	reverse_iterator operator-(difference_type n) const { return reverse_iterator(it_ + n); }
+	reverse_iterator operator-(difference_type n) const { return reverse_iterator(sstl::next(it_, n)); }
 	/** Advances the iterator by n positions. */
-	reverse_iterator& operator+=(difference_type n) { return it_ -= n; }
+	reverse_iterator& operator+=(difference_type n) { sstl::advance(it_, -n); return *this; }
 	/** Advances the iterator by -n positions. */
-	reverse_iterator& operator-=(difference_type n) { return it_ += n; }
+	reverse_iterator& operator-=(difference_type n) { sstl::advance(it_, n); return *this; }
 
 	/** Returns the underlying base iterator. */
 	Iterator base() const { return it_; }
@@ -132,15 +195,18 @@ bool operator>=(const reverse_iterator<Iterator1>& lhs,
 	return !(lhs < rhs);
 }
 
-/** Returns the number of hops from first to last. */
-template<class InputIt>
-inline typename iterator_traits<InputIt>::difference_type distance(
-    InputIt first, InputIt last) {
-	typename iterator_traits<InputIt>::difference_type size = 0;
-
-	while (first != last) { ++size; ++first; }
+template<class Iterator1, class Iterator2>
+typename reverse_iterator<Iterator1>::difference_type operator-(
+    const reverse_iterator<Iterator1>& lhs,
+    const reverse_iterator<Iterator2>& rhs) {
+	return rhs.base() - lhs.base();
+}
 
-	return size;
+template<class Iterator>
+reverse_iterator<Iterator> operator+(
+    typename reverse_iterator<Iterator>::difference_type n,
+    const reverse_iterator<Iterator>& it) {
+	return it + n;
 }
 
 } /* namespace sstl */
@@ -0,0 +1,677 @@
+#ifndef STATIC_STL_LIST_H_
+#define STATIC_STL_LIST_H_
+
+#include <new>
+
+#include "algorithm.h"
+#include "instrument.h"
+#include "iterator.h"
+#include "memory.h"
+#include "type_traits.h"
+#include "utility.h"
+
+namespace sstl {
+
+namespace detail {
+/** Smallest index type which can refer to N list nodes and the sentinel. */
+template<size_t N>
+struct list_index {
+	typedef typename conditional < (N <= 0xffff), uint16_t, uint32_t >::type type;
+};
+
+/** Gives a compilation error if N nodes cannot be linked by Index. */
+template<size_t N, typename Index>
+struct check_list_capacity {
+	typedef typename enable_if < (N <= size_t(Index(-1))) >::type type;
+};
+
+/** Links of a list node. Node i + 1 is the ith node of the storage, zero is the sentinel. */
+template<typename Index>
+struct list_links {
+	Index prev_;
+	Index next_;
+};
+
+/** Node of a list, its value storage directly follows the links. */
+template<typename T, typename Index>
+struct list_node {
+	list_links<Index> links_;
+	typename aligned_storage<sizeof(T), alignment_of<T>::value>::type value_;
+};
+
+/** Bidirectional iterator over a list, following the index links of its nodes. */
+template<typename T, typename Index>
+class list_iterator {
+	template<typename, typename> friend class list_iterator;
+
+	typedef list_node<typename remove_const<T>::type, Index> node;
+	typedef list_links<Index>                                links;
+
+  public:
+	typedef bidirectional_iterator_tag     iterator_category;
+	typedef typename remove_const<T>::type value_type;
+	typedef T*                             pointer;
+	typedef T&                             reference;
+	typedef ptrdiff_t                      difference_type;
+
+	/** Default constructor. */
+	list_iterator() : nodes_(0), sentinel_(0), pos_(0) {}
+	/**
+		Converts an iterator into a const iterator. A template, so the
+		implicit copy constructor and assignment stay trivial.
+	*/
+	template<typename U>
+	list_iterator(const list_iterator<U, Index>& other)
+		: nodes_(other.nodes_), sentinel_(other.sentinel_), pos_(other.pos_) {}
+	/** Construct at node pos of a list with the given nodes and sentinel. */
+	list_iterator(node* nodes, links* sentinel, Index pos) : nodes_(nodes), sentinel_(sentinel), pos_(pos) {}
+
+	/** Returns a reference to the current element. */
+	reference operator*() const { return *reinterpret_cast<pointer>(&nodes_[pos_ - 1].value_); }
+	/** Returns a pointer to the current element. */
+	pointer operator->() const { return &**this; }
+	/** Pre-increments the iterator. */
+	list_iterator& operator++() { pos_ = link().next_; return *this; }
+	/** Post-increments the iterator. */
+	list_iterator operator++(int) { list_iterator tmp(*this); ++*this; return tmp; }
+	/** Pre-decrements the iterator. */
+	list_iterator& operator--() { pos_ = link().prev_; return *this; }
+	/** Post-decrements the iterator. */
+	list_iterator operator--(int) { list_iterator tmp(*this); --*this; return tmp; }
+
+	template<typename U>
+	bool operator==(const list_iterator<U, Index>& rhs) const { return pos_ == rhs.pos_; }
+	template<typename U>
+	bool operator!=(const list_iterator<U, Index>& rhs) const { return pos_ != rhs.pos_; }
+
+	/** Returns the index of the current node, zero at the end. */
+	Index index() const { return pos_; }
+
+  private:
+	const links& link() const { return pos_ ? nodes_[pos_ - 1].links_ : *sentinel_; }
+
+	node* nodes_;
+	links* sentinel_;
+	Index pos_;
+};
+} /* namespace detail */
+
+/**
+	Doubly linked list of up to N elements whose nodes live in an internal
+	array. Nodes link to each other by Index, by default the smallest
+	unsigned type which fits N, so a node of a list of up to 65535 elements
+	carries four bytes of links instead of sixteen on 64-bit targets.
+	Erased nodes go on a free list and are reused first.
+
+	Lists sharing Index share the base class list<T, 0, Index>, which
+	splices between lists of any size. Inserting into a full list does
+	nothing, like push_back() on a full vector.
+*/
+template<typename T, size_t N = 0, typename Index = typename detail::list_index<N>::type>
+class list;
+
+/** Common zero-size base class for all lists with the same index type. */
+template<typename T, typename Index>
+class list<T, 0, Index> {
+	typedef list<T, 8, Index> child;
+
+  public:
+	typedef T                                      value_type;
+	typedef value_type*                            pointer;
+	typedef const value_type*                      const_pointer;
+	typedef value_type&                            reference;
+	typedef const value_type&                      const_reference;
+	typedef size_t                                 size_type;
+	typedef ptrdiff_t                              difference_type;
+	typedef Index                                  index_type;
+	typedef detail::list_iterator<T, Index>        iterator;
+	typedef detail::list_iterator<const T, Index>  const_iterator;
+	typedef sstl::reverse_iterator<iterator>       reverse_iterator;
+	typedef sstl::reverse_iterator<const_iterator> const_reverse_iterator;
+
+	/** Copy assignment operator, reusing the nodes already in the list. */
+	list& operator=(const list& rhs) {
+		if (this != &rhs) { assign(rhs.begin(), rhs.end()); }
+
+		return *this;
+	}
+#if __cplusplus >= 201103
+	/** Move assignment operator, moving the elements one by one. */
+	list& operator=(list&& rhs) {
+		if (this != &rhs) {
+			clear();
+
+			for (iterator it = rhs.begin(); it != rhs.end(); ++it) { emplace_back(sstl::move(*it)); }
+
+			rhs.clear();
+		}
+
+		return *this;
+	}
+#endif
+
+	/** Replaces the contents with count copies of val. */
+	void assign(size_type count, const_reference val) {
+		iterator it = begin();
+
+		for (; it != end() && count; ++it, --count) { *it = val; }
+
+		erase(it, end());
+		insert(end(), count, val);
+	}
+	/** Replaces the contents with the range [first, last), keeping its first max_size() elements. */
+	template<class InputIt>
+	void assign(InputIt first, InputIt last) {
+		typedef typename is_integral<InputIt>::type integral;
+		assign_range_dispatch(first, last, integral());
+	}
+
+	/** Returns a reference to the first element in the container. */
+	reference front() { return *begin(); }
+	const_reference front() const { return *begin(); }
+
+	/** Returns reference to the last element in the container. */
+	reference back() { return *--end(); }
+	const_reference back() const { return *--end(); }
+
+	/** Returns an iterator to the first element of the container. */
+	iterator begin() { return make_iterator(sentinel().next_); }
+	const_iterator begin() const { return make_iterator(sentinel().next_); }
+	const_iterator cbegin() const { return begin(); }
+
+	/** Returns an iterator to the element following the last element of the container. */
+	iterator end() { return make_iterator(0); }
+	const_iterator end() const { return make_iterator(0); }
+	const_iterator cend() const { return end(); }
+
+	/** Returns a reverse iterator to the first element of the reversed container. */
+	reverse_iterator rbegin() { return reverse_iterator(end()); }
+	const_reverse_iterator rbegin() const { return const_reverse_iterator(end()); }
+	const_reverse_iterator crbegin() const { return rbegin(); }
+
+	/** Returns a reverse iterator to the element following the last element of the reversed container. */
+	reverse_iterator rend() { return reverse_iterator(begin()); }
+	const_reverse_iterator rend() const { return const_reverse_iterator(begin()); }
+	const_reverse_iterator crend() const { return rend(); }
+
+	/** Checks whether the container has no elements. */
+	bool empty() const { return size() == 0; }
+	/** Checks whether every node holds an element. */
+	bool full() const { return size() == max_size(); }
+	/** Returns the number of elements in the container. */
+	size_type size() const { return static_cast<const child*>(this)->size_; }
+	/** Returns the maximum possible number of elements. */
+	size_type max_size() const { return static_cast<const child*>(this)->capacity_; }
+
+	/** Removes all elements from the container and returns every node to the free storage. */
+	void clear() {
+		typedef typename is_trivially_destructible<value_type>::type trivial;
+		destroy_all(trivial());
+
+		child* self = static_cast<child*>(this);
+		self->size_ = 0;
+		self->used_ = 0;
+		self->free_ = 0;
+		self->sentinel_.prev_ = 0;
+		self->sentinel_.next_ = 0;
+	}
+
+	/** Inserts val before pos, returns an iterator to it, or pos if the list is full. O(1). */
+	iterator insert(const_iterator pos, const_reference val) {
+		const index_type i = acquire();
+
+		if (!i) {
+			record(1);
+			return make_iterator(pos.index());
+		}
+
+		new(static_cast<void*>(element(i))) value_type(val);
+		return attach(pos.index(), i);
+	}
+#if __cplusplus >= 201103
+	iterator insert(const_iterator pos, value_type&& val) {
+		const index_type i = acquire();
+
+		if (!i) {
+			record(1);
+			return make_iterator(pos.index());
+		}
+
+		new(static_cast<void*>(element(i))) value_type(sstl::move(val));
+		return attach(pos.index(), i);
+	}
+#endif
+	/** Inserts count copies of val before pos, as many as fit. Returns an iterator to the first one, or pos. */
+	iterator insert(const_iterator pos, size_type count, const_reference val) {
+		iterator first = make_iterator(pos.index());
+
+		for (; count && !full(); --count) {
+			const iterator it = insert(pos, val);
+
+			if (first == pos) { first = it; }
+		}
+
+		return first;
+	}
+	/** Inserts the range [first, last) before pos, as much as fits. Returns an iterator to the first one, or pos. */
+	template<class InputIt>
+	iterator insert(const_iterator pos, InputIt first, InputIt last) {
+		typedef typename is_integral<InputIt>::type integral;
+		return insert_range_dispatch(pos, first, last, integral());
+	}
+
+#if __cplusplus >= 201103
+	/** Inserts an element constructed in-place from args before pos, returns pos if the list is full. O(1). */
+	template<class... Args>
+	iterator emplace(const_iterator pos, Args&&... args) {
+		const index_type i = acquire();
+
+		if (!i) {
+			record(1);
+			return make_iterator(pos.index());
+		}
+
+		new(static_cast<void*>(element(i))) value_type(sstl::forward<Args>(args)...);
+		return attach(pos.index(), i);
+	}
+#endif
+
+	/** Removes the element at pos, returns an iterator to the element following it. O(1). */
+	iterator erase(const_iterator pos) {
+		const index_type i = pos.index();
+		const index_type next = link(i).next_;
+
+		detach(i);
+		sstl::destroy_at(element(i));
+		release(i);
+		record(0);
+		return make_iterator(next);
+	}
+	/** Removes the elements in [first, last). */
+	iterator erase(const_iterator first, const_iterator last) {
+		while (first != last) { first = erase(first); }
+
+		return make_iterator(last.index());
+	}
+
+	/** Appends the given element value to the end of the container. */
+	void push_back(const T& value) { insert(end(), value); }
+	/** Prepends the given element value to the beginning of the container. */
+	void push_front(const T& value) { insert(begin(), value); }
+#if __cplusplus >= 201103
+	void push_back(T&& value) { insert(end(), sstl::move(value)); }
+	void push_front(T&& value) { insert(begin(), sstl::move(value)); }
+
+	/** Appends an element constructed in-place from args to the end of the container. */
+	template<class... Args>
+	void emplace_back(Args&&... args) { emplace(end(), sstl::forward<Args>(args)...); }
+	/** Prepends an element constructed in-place from args to the beginning of the container. */
+	template<class... Args>
+	void emplace_front(Args&&... args) { emplace(begin(), sstl::forward<Args>(args)...); }
+#endif
+
+	/** Removes the last element of the container. */
+	void pop_back() { erase(--end()); }
+	/** Removes the first element of the container. */
+	void pop_front() { erase(begin()); }
+
+	/** Resizes the container to contain count elements, appending value-initialized ones. */
+	void resize(size_type count) {
+		for (; size() > count;) { pop_back(); }
+
+		for (; size() < count && !full();) {
+#if __cplusplus >= 201103
+			emplace_back();
+#else
+			push_back(value_type());
+#endif
+		}
+	}
+	/** Resizes the container to contain count elements, appending copies of value. */
+	void resize(size_type count, const value_type& value) {
+		for (; size() > count;) { pop_back(); }
+
+		if (size() < count) { insert(end(), count - size(), value); }
+	}
+
+	/**
+		Moves the elements of other before pos. Within one list the nodes are
+		relinked in O(1). Between lists each element is moved into a node of
+		this list, stopping once it is full, and the rest stay in other.
+	*/
+	void splice(const_iterator pos, list& other) {
+		if (&other != this) { splice(pos, other, other.begin(), other.end()); }
+	}
+	/** Moves the element at it from other before pos, O(1) within one list. */
+	void splice(const_iterator pos, list& other, const_iterator it) {
+		if (&other == this) {
+			const index_type i = it.index();
+
+			if (pos.index() == i || pos.index() == link(i).next_) { return; }
+
+			detach(i);
+			attach(pos.index(), i);
+		} else {
+			transfer(pos, other, it);
+		}
+	}
+	/** Moves the elements in [first, last) from other before pos, O(1) within one list. */
+	void splice(const_iterator pos, list& other, const_iterator first, const_iterator last) {
+		if (first == last) { return; }
+
+		if (&other != this) {
+			while (first != last && !full()) { first = transfer(pos, other, first); }
+
+			return;
+		}
+
+		const index_type f = first.index();
+		const index_type l = last.index();
+		const index_type p = pos.index();
+
+		if (p == l) { return; }
+
+		const index_type before = link(f).prev_;
+		const index_type back = link(l).prev_;
+
+		link(before).next_ = l;
+		link(l).prev_ = before;
+
+		const index_type prev = link(p).prev_;
+
+		link(prev).next_ = f;
+		link(f).prev_ = prev;
+		link(back).next_ = p;
+		link(p).prev_ = back;
+	}
+
+	/** Removes all elements equal to value. */
+	void remove(const value_type& value) {
+		/* value may be an element of the list, so that one is erased last. */
+		iterator self = end();
+
+		for (iterator it = begin(); it != end();) {
+			if (!(*it == value)) {
+				++it;
+			} else if (&*it == &value) {
+				self = it++;
+			} else {
+				it = erase(it);
+			}
+		}
+
+		if (self != end()) { erase(self); }
+	}
+	/** Removes all elements for which pred returns true. */
+	template<class UnaryPredicate>
+	void remove_if(UnaryPredicate pred) {
+		for (iterator it = begin(); it != end();) { it = pred(*it) ? erase(it) : ++it; }
+	}
+
+	/** Reverses the order of the elements by swapping the links of every node. */
+	void reverse() {
+		index_type i = 0;
+
+		do {
+			links& l = link(i);
+			sstl::swap(l.prev_, l.next_);
+			i = l.prev_;
+		} while (i != 0);
+	}
+
+#if SSTL_INSTRUMENT
+	/** Returns the usage counters of this list, see instrument.h. */
+	container_stats& stats() { return static_cast<child*>(this)->stats_; }
+	const container_stats& stats() const { return static_cast<const child*>(this)->stats_; }
+#endif
+
+  protected:
+	typedef detail::list_node<T, Index> node;
+	typedef detail::list_links<Index>   links;
+
+	SSTL_CONSTEXPR list() {}
+	~list() {}
+
+  private:
+	/** Counts a modification which dropped the given number of elements, if instrumented. Lists never shift elements. */
+	void record(size_type dropped) {
+#if SSTL_INSTRUMENT
+		stats().record("list", max_size(), size(), dropped, 0);
+#else
+		(void)dropped;
+#endif
+	}
+
+	node* nodes() { return static_cast<child*>(this)->storage_.data_; }
+	const node* nodes() const { return static_cast<const child*>(this)->storage_.data_; }
+
+	links& sentinel() { return static_cast<child*>(this)->sentinel_; }
+	const links& sentinel() const { return static_cast<const child*>(this)->sentinel_; }
+
+	links& link(index_type i) { return i ? nodes()[i - 1].links_ : sentinel(); }
+
+	pointer element(index_type i) { return reinterpret_cast<pointer>(&nodes()[i - 1].value_); }
+
+	iterator make_iterator(index_type i) { return iterator(nodes(), &sentinel(), i); }
+	const_iterator make_iterator(index_type i) const {
+		return const_iterator(const_cast<node*>(nodes()), const_cast<links*>(&sentinel()), i);
+	}
+
+	/** Takes a node off the free list, or a never used one if the list is empty. Returns zero if there is none. */
+	index_type acquire() {
+		child* self = static_cast<child*>(this);
+
+		if (self->free_) {
+			const index_type i = self->free_;
+			self->free_ = link(i).next_;
+			return i;
+		}
+
+		return self->used_ < max_size() ? ++self->used_ : 0;
+	}
+	/** Pushes node i, whose element is already destroyed, onto the free list. */
+	void release(index_type i) {
+		child* self = static_cast<child*>(this);
+		link(i).next_ = self->free_;
+		self->free_ = i;
+	}
+
+	/** Links node i before node pos and counts it and the modification. */
+	iterator attach(index_type pos, index_type i) {
+		links& next = link(pos);
+		links& l = link(i);
+
+		l.prev_ = next.prev_;
+		l.next_ = pos;
+		link(next.prev_).next_ = i;
+		next.prev_ = i;
+		++static_cast<child*>(this)->size_;
+		record(0);
+		return make_iterator(i);
+	}
+	/** Unlinks node i and uncounts it. */
+	void detach(index_type i) {
+		const links& l = link(i);
+
+		link(l.prev_).next_ = l.next_;
+		link(l.next_).prev_ = l.prev_;
+		--static_cast<child*>(this)->size_;
+	}
+
+	/** Moves the element at it from other, a different list, before pos. Returns the element following it in other. */
+	const_iterator transfer(const_iterator pos, list& other, const_iterator it) {
+		const index_type i = acquire();
+
+		if (!i) { return it; }
+
+		new(static_cast<void*>(element(i))) value_type(sstl::move(*other.make_iterator(it.index())));
+		attach(pos.index(), i);
+		return other.erase(it);
+	}
+
+	template<typename Int>
+	void assign_range_dispatch(Int count, Int val, true_type) {
+		assign(size_type(count), value_type(val));
+	}
+	template<class InputIt>
+	void assign_range_dispatch(InputIt first, InputIt last, false_type) {
+		iterator it = begin();
+
+		for (; it != end() && first != last; ++it, ++first) { *it = *first; }
+
+		erase(it, end());
+		insert(end(), first, last);
+	}
+
+	template<typename Int>
+	iterator insert_range_dispatch(const_iterator pos, Int count, Int val, true_type) {
+		return insert(pos, size_type(count), value_type(val));
+	}
+	template<class InputIt>
+	iterator insert_range_dispatch(const_iterator pos, InputIt first, InputIt last, false_type) {
+		iterator result = make_iterator(pos.index());
+
+		for (; first != last && !full(); ++first) {
+			const iterator it = insert(pos, *first);
+
+			if (result == pos) { result = it; }
+		}
+
+		return result;
+	}
+
+	/** Destroys the elements in list order. Trivially destructible elements need no visit. */
+	void destroy_all(false_type) {
+		for (index_type i = sentinel().next_; i != 0; i = link(i).next_) { sstl::destroy_at(element(i)); }
+	}
+	void destroy_all(true_type) {}
+};
+
+/** Child class with size-specific storage for the nodes. */
+template<typename T, size_t N, typename Index>
+class list : public list<T, 0, Index> {
+	friend class list<T, 0, Index>;
+	typedef list<T, 0, Index> base;
+
+  public:
+	typedef typename base::value_type             value_type;
+	typedef typename base::pointer                pointer;
+	typedef typename base::const_pointer          const_pointer;
+	typedef typename base::reference              reference;
+	typedef typename base::const_reference        const_reference;
+	typedef typename base::size_type              size_type;
+	typedef typename base::difference_type        difference_type;
+	typedef typename base::index_type             index_type;
+	typedef typename base::iterator               iterator;
+	typedef typename base::const_iterator         const_iterator;
+	typedef typename base::reverse_iterator       reverse_iterator;
+	typedef typename base::const_reverse_iterator const_reverse_iterator;
+
+	/** Default constructor, a constant initializer for lists with static storage. */
+	SSTL_CONSTEXPR list() : base(), capacity_(N), size_(0), used_(0), free_(0), sentinel_(), storage_() {}
+	/** Copy constructor. */
+	list(const list& other) : base(), capacity_(N), size_(0), used_(0), free_(0), sentinel_(), storage_() {
+		base::assign(other.begin(), other.end());
+	}
+#if __cplusplus >= 201103
+	/** Move constructor, moving the elements one by one. */
+	list(list&& other) : base(), capacity_(N), size_(0), used_(0), free_(0), sentinel_(), storage_() {
+		base::operator=(sstl::move(other));
+	}
+#endif
+	/** Constructs the list with count copies of val. */
+	list(size_type count, const_reference val)
+		: base(), capacity_(N), size_(0), used_(0), free_(0), sentinel_(), storage_() {
+		base::insert(base::end(), count, val);
+	}
+	/** Constructs the list with the first N values of the range [first, last). */
+	template<class InputIt>
+	list(InputIt first, InputIt last) : base(), capacity_(N), size_(0), used_(0), free_(0), sentinel_(), storage_() {
+		base::insert(base::end(), first, last);
+	}
+
+	~list() { base::clear(); }
+
+	/** Returns the maximum possible number of elements. */
+	SSTL_CONSTEXPR14 size_type max_size() const { return N; }
+
+	/** Copy assignment operator. */
+	list& operator=(const list& rhs) {
+		base::operator=(rhs);
+		return *this;
+	}
+#if __cplusplus >= 201103
+	/** Move assignment operator. */
+	list& operator=(list&& rhs) {
+		base::operator=(sstl::move(rhs));
+		return *this;
+	}
+#endif
+
+  private:
+	typedef typename detail::check_list_capacity<N, Index>::type capacity_fits;
+	typedef typename base::node  node;
+	typedef typename base::links links;
+
+	Index capacity_;
+	Index size_;
+	/** Nodes after the first used_ have never held an element, so they need no free list entries. */
+	Index used_;
+	/** Index of the first free node, zero if the free list is empty. */
+	Index free_;
+	/** Links of the end of the list. */
+	links sentinel_;
+#if SSTL_INSTRUMENT
+	/** Usage counters, ahead of the storage so their offset does not depend on N. */
+	container_stats stats_;
+#endif
+
+	/**
+		Node storage, wrapped so a constexpr constructor can initialize the
+		empty member instead, which leaves every byte of the nodes untouched.
+	*/
+	union storage {
+		struct empty {};
+
+		SSTL_CONSTEXPR storage() : empty_() {}
+
+		empty empty_;
+		node data_[N];
+	} storage_;
+};
+
+template<typename T, typename Index>
+inline bool operator==(const list<T, 0, Index>& lhs, const list<T, 0, Index>& rhs) {
+	return lhs.size() == rhs.size() &&
+	       sstl::equal(lhs.cbegin(), lhs.cend(), rhs.cbegin());
+}
+
+template<typename T, typename Index>
+inline bool operator!=(const list<T, 0, Index>& lhs, const list<T, 0, Index>& rhs) {
+	return !(lhs == rhs);
+}
+
+template<typename T, typename Index>
+inline bool operator<(const list<T, 0, Index>& lhs, const list<T, 0, Index>& rhs) {
+	return sstl::lexicographical_compare(lhs.cbegin(), lhs.cend(),
+	                               rhs.cbegin(), rhs.cend());
+}
+
+template<typename T, typename Index>
+inline bool operator>(const list<T, 0, Index>& lhs, const list<T, 0, Index>& rhs) {
+	return rhs < lhs;
+}
+
+template<typename T, typename Index>
+inline bool operator<=(const list<T, 0, Index>& lhs, const list<T, 0, Index>& rhs) {
+	return !(rhs < lhs);
+}
+
+template<typename T, typename Index>
+inline bool operator>=(const list<T, 0, Index>& lhs, const list<T, 0, Index>& rhs) {
+	return !(lhs < rhs);
+}
+
+} /* namespace sstl */
+
+#endif /* STATIC_STL_LIST_H_ */
@@ -1,13 +1,33 @@
 #ifndef STATIC_STL_MEMORY_H_
 #define STATIC_STL_MEMORY_H_
 
+#include <assert.h>
+
+#include <new>
+
+#include "algorithm.h"
 #include "iterator.h"
+#include "type_traits.h"
+
+/**
+	When non-zero, operator[] of a full map asserts when the key is missing
+	instead of quietly handing out the shared stand-in value, see
+	detail::full_map_subscript. On unless NDEBUG is defined.
+*/
+#ifndef SSTL_ASSERT_FULL_SUBSCRIPT
+#	ifdef NDEBUG
+#		define SSTL_ASSERT_FULL_SUBSCRIPT 0
+#	else
+#		define SSTL_ASSERT_FULL_SUBSCRIPT 1
+#	endif
+#endif
 
 namespace sstl {
 
-/** Copies elements from the range [first, last] to an uninitialized memory area beginning at d_first. */
+namespace detail {
 template<class InputIt, class ForwardIt>
-ForwardIt uninitialized_copy(InputIt first, InputIt last, ForwardIt d_first) {
+ForwardIt uninitialized_copy_dispatch(InputIt first, InputIt last,
+                                      ForwardIt d_first, false_type) {
 	typedef typename iterator_traits<ForwardIt>::value_type value_type;
 
 	for (; first != last; ++first, ++d_first) {
@@ -16,62 +36,191 @@ ForwardIt uninitialized_copy(InputIt first, InputIt last, ForwardIt d_first) {
 
 	return d_first;
 }
+template<class InputIt, class ForwardIt>
+ForwardIt uninitialized_copy_dispatch(InputIt first, InputIt last,
+                                      ForwardIt d_first, true_type) {
+	return sstl::copy(first, last, d_first);
+}
 
-/** Copies count elements from a range beginning at first to an uninitialized memory area beginning at d_first. */
 template<class InputIt, class Size, class ForwardIt>
-ForwardIt uninitialized_copy_n(InputIt first, Size count, ForwardIt d_first) {
+ForwardIt uninitialized_copy_n_dispatch(InputIt first, Size count,
+                                        ForwardIt d_first, false_type) {
 	typedef typename iterator_traits<ForwardIt>::value_type value_type;
 
-	for (; count; ++first, ++d_first, --count) {
+	for (; count > 0; ++first, ++d_first, --count) {
 		new(static_cast<void*>(&*d_first)) value_type(*first);
 	}
 
 	return d_first;
 }
+template<class InputIt, class Size, class ForwardIt>
+ForwardIt uninitialized_copy_n_dispatch(InputIt first, Size count,
+                                        ForwardIt d_first, true_type) {
+	return sstl::copy_n(first, count, d_first);
+}
+
+template<class InputIt, class ForwardIt>
+ForwardIt uninitialized_move_dispatch(InputIt first, InputIt last,
+                                      ForwardIt d_first, false_type) {
+	typedef typename iterator_traits<ForwardIt>::value_type value_type;
+
+	for (; first != last; ++first, ++d_first) {
+		new(static_cast<void*>(&*d_first)) value_type(sstl::move(*first));
+	}
+
+	return d_first;
+}
+template<class InputIt, class ForwardIt>
+ForwardIt uninitialized_move_dispatch(InputIt first, InputIt last,
+                                      ForwardIt d_first, true_type) {
+	return sstl::copy(first, last, d_first);
+}
+
+template<class InputIt, class Size, class ForwardIt>
+ForwardIt uninitialized_move_n_dispatch(InputIt first, Size count,
+                                        ForwardIt d_first, false_type) {
+	typedef typename iterator_traits<ForwardIt>::value_type value_type;
+
+	for (; count > 0; ++first, ++d_first, --count) {
+		new(static_cast<void*>(&*d_first)) value_type(sstl::move(*first));
+	}
+
+	return d_first;
+}
+template<class InputIt, class Size, class ForwardIt>
+ForwardIt uninitialized_move_n_dispatch(InputIt first, Size count,
+                                        ForwardIt d_first, true_type) {
+	return sstl::copy_n(first, count, d_first);
+}
 
-/** Copies the given value to an uninitialized memory area, defined by the range [first, last]. */
 template<class ForwardIt, typename T>
-void uninitialized_fill(ForwardIt first, ForwardIt last, const T& value) {
+void uninitialized_fill_dispatch(ForwardIt first, ForwardIt last,
+                                 const T& value, false_type) {
 	typedef typename iterator_traits<ForwardIt>::value_type value_type;
 
 	for (; first != last; ++first) {
 		new(static_cast<void*>(&*first)) value_type(value);
 	}
 }
+template<class ForwardIt, typename T>
+void uninitialized_fill_dispatch(ForwardIt first, ForwardIt last,
+                                 const T& value, true_type) {
+	sstl::fill(first, last, value);
+}
 
-/** Copies the given value value to the first count elements in an uninitialized memory area beginning at first. */
 template<class ForwardIt, class Size, typename T>
-ForwardIt uninitialized_fill_n(ForwardIt first, Size count, const T& value) {
+ForwardIt uninitialized_fill_n_dispatch(ForwardIt first, Size count,
+                                        const T& value, false_type) {
 	typedef typename iterator_traits<ForwardIt>::value_type value_type;
 
-	for (; count; ++first, --count) {
+	for (; count > 0; ++first, --count) {
 		new(static_cast<void*>(&*first)) value_type(value);
 	}
 
 	return first;
 }
+template<class ForwardIt, class Size, typename T>
+ForwardIt uninitialized_fill_n_dispatch(ForwardIt first, Size count,
+                                        const T& value, true_type) {
+	return sstl::fill_n(first, count, value);
+}
+} /* namespace detail */
 
-/** Constructs objects in the uninitialized storage designated by the range [first, last] by default-initialization. */
+/** Copies elements from the range [first, last] to an uninitialized memory area beginning at d_first. */
+template<class InputIt, class ForwardIt>
+ForwardIt uninitialized_copy(InputIt first, InputIt last, ForwardIt d_first) {
+	typedef typename detail::is_memmovable<InputIt, ForwardIt>::type block;
+	return detail::uninitialized_copy_dispatch(first, last, d_first, block());
+}
+
+/** Copies count elements from a range beginning at first to an uninitialized memory area beginning at d_first. */
+template<class InputIt, class Size, class ForwardIt>
+ForwardIt uninitialized_copy_n(InputIt first, Size count, ForwardIt d_first) {
+	typedef typename detail::is_memmovable<InputIt, ForwardIt>::type block;
+	return detail::uninitialized_copy_n_dispatch(first, count, d_first, block());
+}
+
+/** Moves elements from the range [first, last] to an uninitialized memory area beginning at d_first. */
+template<class InputIt, class ForwardIt>
+ForwardIt uninitialized_move(InputIt first, InputIt last, ForwardIt d_first) {
+	typedef typename detail::is_memmovable<InputIt, ForwardIt>::type block;
+	return detail::uninitialized_move_dispatch(first, last, d_first, block());
+}
+
+/** Moves count elements from a range beginning at first to an uninitialized memory area beginning at d_first. */
+template<class InputIt, class Size, class ForwardIt>
+ForwardIt uninitialized_move_n(InputIt first, Size count, ForwardIt d_first) {
+	typedef typename detail::is_memmovable<InputIt, ForwardIt>::type block;
+	return detail::uninitialized_move_n_dispatch(first, count, d_first, block());
+}
+
+/** Copies the given value to an uninitialized memory area, defined by the range [first, last]. */
+template<class ForwardIt, typename T>
+void uninitialized_fill(ForwardIt first, ForwardIt last, const T& value) {
+	typedef typename detail::is_memsettable<ForwardIt>::type block;
+	detail::uninitialized_fill_dispatch(first, last, value, block());
+}
+
+/** Copies the given value value to the first count elements in an uninitialized memory area beginning at first. */
+template<class ForwardIt, class Size, typename T>
+ForwardIt uninitialized_fill_n(ForwardIt first, Size count, const T& value) {
+	typedef typename detail::is_memsettable<ForwardIt>::type block;
+	return detail::uninitialized_fill_n_dispatch(first, count, value, block());
+}
+
+namespace detail {
 template<class ForwardIt>
-void uninitialized_default_construct(ForwardIt first, ForwardIt last) {
+void uninitialized_default_construct_dispatch(ForwardIt first, ForwardIt last,
+                                              false_type) {
 	typedef typename iterator_traits<ForwardIt>::value_type value_type;
 
 	for (; first != last; ++first) {
 		new(static_cast<void*>(&*first)) value_type;
 	}
 }
+template<class ForwardIt>
+void uninitialized_default_construct_dispatch(ForwardIt, ForwardIt, true_type) {}
 
-/** Constructs n objects in the uninitialized storage starting at first by default-initialization. */
 template<class ForwardIt, class Size>
-ForwardIt uninitialized_default_construct_n(ForwardIt first, Size n) {
+ForwardIt uninitialized_default_construct_n_dispatch(ForwardIt first, Size n,
+                                                    false_type) {
 	typedef typename iterator_traits<ForwardIt>::value_type value_type;
 
-	for (; n; ++first, --n) {
+	for (; n > 0; ++first, --n) {
 		new(static_cast<void*>(&*first)) value_type;
 	}
 
 	return first;
 }
+template<class ForwardIt, class Size>
+ForwardIt uninitialized_default_construct_n_dispatch(ForwardIt first, Size n,
+                                                    true_type) {
+	return n > 0 ? first + n : first;
+}
+
+/** Checks whether ForwardIt is a pointer to elements whose default-initialization does nothing. */
+template<class ForwardIt>
+struct is_trivial_default_init_range : public false_type {};
+
+template<typename T>
+struct is_trivial_default_init_range<T*> :
+	public is_trivially_default_constructible<T>::type {};
+} /* namespace detail */
+
+/** Constructs objects in the uninitialized storage designated by the range [first, last] by default-initialization. */
+template<class ForwardIt>
+void uninitialized_default_construct(ForwardIt first, ForwardIt last) {
+	typedef typename iterator_traits<ForwardIt>::value_type value_type;
+	typedef typename is_trivially_default_constructible<value_type>::type trivial;
+	detail::uninitialized_default_construct_dispatch(first, last, trivial());
+}
+
+/** Constructs n objects in the uninitialized storage starting at first by default-initialization. */
+template<class ForwardIt, class Size>
+ForwardIt uninitialized_default_construct_n(ForwardIt first, Size n) {
+	typedef typename detail::is_trivial_default_init_range<ForwardIt>::type trivial;
+	return detail::uninitialized_default_construct_n_dispatch(first, n, trivial());
+}
 
 /** Constructs objects in the uninitialized storage designated by the range [first, last] by value-initialization. */
 template<class ForwardIt>
@@ -101,20 +250,54 @@ void destroy_at(T* p) {
 	p->~T();
 }
 
+namespace detail {
+template<class ForwardIt>
+void destroy_dispatch(ForwardIt first, ForwardIt last, false_type) {
+	for (; first != last; ++first) { sstl::destroy_at(&*first); }
+}
+template<class ForwardIt>
+void destroy_dispatch(ForwardIt, ForwardIt, true_type) {}
+} /* namespace detail */
+
 /** Destroys the objects in the range [first, last]. */
 template<class ForwardIt>
 void destroy(ForwardIt first, ForwardIt last) {
-	for (; first != last; ++first) { destroy_at(&*first); }
+	typedef typename iterator_traits<ForwardIt>::value_type value_type;
+	typedef typename is_trivially_destructible<value_type>::type trivial;
+	detail::destroy_dispatch(first, last, trivial());
 }
 
 /** Destroys the n objects in the range starting at first. */
 template<class ForwardIt, class Size>
 ForwardIt destroy_n(ForwardIt first, Size n) {
-	for (; n; ++first, --n) { destroy_at(&*first); }
+	for (; n; ++first, --n) { sstl::destroy_at(&*first); }
 
 	return first;
 }
 
+namespace detail {
+/**
+	Reference which operator[] of a full map returns for a missing key, so
+	no element is overwritten. One value is shared by every map with the
+	same mapped type, one per thread from C++11 on, and it is reset on each
+	call, so writes through it are discarded.
+*/
+template<typename T>
+T& full_map_subscript() {
+#if SSTL_ASSERT_FULL_SUBSCRIPT
+	assert(!"operator[] on a full map, use insert or try_emplace to detect it");
+#endif
+
+#if __cplusplus >= 201103
+	static thread_local T value;
+#else
+	static T value;
+#endif
+	value = T();
+	return value;
+}
+} /* namespace detail */
+
 } /* namespace sstl */
 
 #endif /* STATIC_STL_MEMORY_H_ */
@@ -0,0 +1,231 @@
+#ifndef STATIC_STL_MPMC_QUEUE_H_
+#define STATIC_STL_MPMC_QUEUE_H_
+
+#if __cplusplus >= 201103
+
+#include <atomic>
+#include <new>
+
+#include "array.h"
+#include "memory.h"
+#include "type_traits.h"
+#include "utility.h"
+
+namespace sstl {
+
+namespace detail {
+/**
+	Queue slot with its own sequence number. The sequence is stored relative
+	to the slot index, so a queue where every sequence is zero is empty and
+	can be zero (or constant) initialized.
+*/
+template<typename T>
+struct mpmc_cell {
+	std::atomic<size_t> sequence;
+	typename aligned_storage<sizeof(T), alignment_of<T>::value>::type storage;
+};
+} /* namespace detail */
+
+/**
+	Bounded lock-free queue with fixed capacity for any number of producer and
+	consumer threads. Each slot carries a sequence number which says whether it
+	is ready for the producer or the consumer of a given position, so threads
+	only contend on the position counters. The capacity is rounded up to a
+	power of two, and is at least two.
+*/
+template<typename T, size_t N = 0>
+class mpmc_queue;
+
+/** Common zero-size base class for all multi-producer/multi-consumer queues. */
+template<typename T>
+class mpmc_queue<T> {
+	typedef mpmc_queue<T, 8>      child;
+	typedef detail::mpmc_cell<T> cell;
+
+  public:
+	typedef T                 value_type;
+	typedef value_type*       pointer;
+	typedef const value_type* const_pointer;
+	typedef value_type&       reference;
+	typedef const value_type& const_reference;
+	typedef size_t            size_type;
+
+	mpmc_queue(const mpmc_queue&) = delete;
+	mpmc_queue& operator=(const mpmc_queue&) = delete;
+
+	/** Appends a copy of value, returns false if the queue is full. */
+	bool try_push(const_reference value) { return try_emplace(value); }
+	/** Appends value by moving it, returns false if the queue is full. */
+	bool try_push(value_type&& value) { return try_emplace(sstl::move(value)); }
+
+	/** Appends an element constructed in-place from args, returns false if the queue is full. */
+	template<class... Args>
+	bool try_emplace(Args&&... args) {
+		size_type pos = 0;
+
+		if (!claim(static_cast<child*>(this)->enqueue_pos_, pos, 1, 0)) { return false; }
+
+		cell& c = cell_at(pos);
+		new(static_cast<void*>(&c.storage)) value_type(sstl::forward<Args>(args)...);
+		c.sequence.store(round(pos) + 1, std::memory_order_release);
+		return true;
+	}
+
+	/**
+		Appends copies of up to count values, claiming their slots with a
+		single update of the shared position. Returns the number appended.
+	*/
+	size_type try_push(const_pointer values, size_type count) {
+		size_type pos = 0;
+		count = claim(static_cast<child*>(this)->enqueue_pos_, pos, count, 0);
+
+		for (size_type i = 0; i < count; ++i) {
+			cell& c = cell_at(pos + i);
+			new(static_cast<void*>(&c.storage)) value_type(values[i]);
+			c.sequence.store(round(pos + i) + 1, std::memory_order_release);
+		}
+
+		return count;
+	}
+
+	/** Moves the oldest element into value, returns false if the queue is empty. */
+	bool try_pop(reference value) { return try_pop(&value, 1) == 1; }
+
+	/**
+		Moves up to count of the oldest elements into values, claiming their
+		slots with a single update of the shared position. Returns the
+		number removed.
+	*/
+	size_type try_pop(pointer values, size_type count) {
+		size_type pos = 0;
+		count = claim(static_cast<child*>(this)->dequeue_pos_, pos, count, 1);
+
+		for (size_type i = 0; i < count; ++i) {
+			cell& c = cell_at(pos + i);
+			pointer p = reinterpret_cast<pointer>(&c.storage);
+			values[i] = sstl::move(*p);
+			sstl::destroy_at(p);
+			c.sequence.store(round(pos + i) + capacity(), std::memory_order_release);
+		}
+
+		return count;
+	}
+
+	/** Returns the number of elements, only a snapshot while other threads are running. */
+	size_type size() const {
+		const child* self = static_cast<const child*>(this);
+		const size_type dequeued = self->dequeue_pos_.load(std::memory_order_acquire);
+		const size_type enqueued = self->enqueue_pos_.load(std::memory_order_acquire);
+		return enqueued > dequeued ? enqueued - dequeued : 0;
+	}
+	/** Checks whether the queue has no elements, with the same caveat as size(). */
+	bool empty() const { return size() == 0; }
+	/** Returns the maximum possible number of elements. */
+	size_type max_size() const { return static_cast<const child*>(this)->capacity_; }
+	/** Returns the number of elements that the container has allocated space for. */
+	size_type capacity() const { return max_size(); }
+
+  protected:
+	constexpr mpmc_queue() {}
+	~mpmc_queue() {}
+
+	/** Returns the cell for unwrapped position pos. */
+	cell& cell_at(size_type pos) {
+		return static_cast<child*>(this)->cells_[pos & (capacity() - 1)];
+	}
+	/** Returns the relative sequence a cell holds when it is ready for the producer of pos. */
+	size_type round(size_type pos) const { return pos & ~(capacity() - 1); }
+
+	/**
+		Claims up to count consecutive cells from the shared position, which
+		must hold relative sequence round + ready for a claim to succeed (0 for
+		producers, 1 for consumers). Sets pos to the first claimed position and
+		returns the number of cells claimed.
+	*/
+	size_type claim(std::atomic<size_t>& shared, size_type& pos, size_type count,
+	                size_type ready) {
+		pos = shared.load(std::memory_order_relaxed);
+
+		while (count) {
+			size_type available = 0;
+
+			for (; available < count; ++available) {
+				const size_type seq = cell_at(pos + available).sequence.load(std::memory_order_acquire);
+
+				if (seq != round(pos + available) + ready) { break; }
+			}
+
+			if (available) {
+				if (shared.compare_exchange_weak(pos, pos + available, std::memory_order_relaxed)) {
+					return available;
+				}
+			} else {
+				const size_type seq = cell_at(pos).sequence.load(std::memory_order_acquire);
+
+				/* The cell is a round behind, so the queue is full (or empty). */
+				if (ptrdiff_t(seq - (round(pos) + ready)) < 0) { return 0; }
+
+				pos = shared.load(std::memory_order_relaxed);
+			}
+		}
+
+		return 0;
+	}
+
+	/** Destroys the remaining elements, only safe once no other thread is using the queue. */
+	void destroy_elements() {
+		child* self = static_cast<child*>(this);
+		const size_type end = self->enqueue_pos_.load(std::memory_order_relaxed);
+
+		for (size_type pos = self->dequeue_pos_.load(std::memory_order_relaxed); pos != end; ++pos) {
+			sstl::destroy_at(reinterpret_cast<pointer>(&cell_at(pos).storage));
+		}
+	}
+};
+
+/** Child class with size-specific storage for the underlying queue. */
+template<typename T, size_t N>
+class mpmc_queue : public mpmc_queue<T> {
+	friend class mpmc_queue<T>;
+	typedef mpmc_queue<T> base;
+
+	static const size_t slot_count = detail::next_power_of_two < (N < 2 ? 2 : N) >::value;
+
+  public:
+	typedef typename base::value_type      value_type;
+	typedef typename base::pointer         pointer;
+	typedef typename base::const_pointer   const_pointer;
+	typedef typename base::reference       reference;
+	typedef typename base::const_reference const_reference;
+	typedef typename base::size_type       size_type;
+
+	/** Default constructor, a constant initializer for queues with static storage. */
+	constexpr mpmc_queue()
+		: base(), capacity_(slot_count), enqueue_pos_(0), dequeue_pos_(0), cells_() {}
+
+	~mpmc_queue() { base::destroy_elements(); }
+
+	/** Returns the maximum possible number of elements. */
+	SSTL_CONSTEXPR14 size_type max_size() const { return slot_count; }
+	/** Returns the number of elements that the container has allocated space for. */
+	SSTL_CONSTEXPR14 size_type capacity() const { return slot_count; }
+
+  private:
+	typedef typename detail::check_capacity<slot_count>::type capacity_fits;
+
+	detail::stored_size_type capacity_;
+
+	/** Next position to push, shared by all producers. */
+	alignas(SSTL_CACHE_LINE_SIZE) std::atomic<size_t> enqueue_pos_;
+
+	/** Next position to pop, shared by all consumers. */
+	alignas(SSTL_CACHE_LINE_SIZE) std::atomic<size_t> dequeue_pos_;
+
+	alignas(SSTL_CACHE_LINE_SIZE) detail::mpmc_cell<T> cells_[slot_count];
+};
+
+} /* namespace sstl */
+
+#endif /* __cplusplus >= 201103 */
+
+#endif /* STATIC_STL_MPMC_QUEUE_H_ */
@@ -0,0 +1,276 @@
+#ifndef STATIC_STL_OBJECT_POOL_H_
+#define STATIC_STL_OBJECT_POOL_H_
+
+#include <string.h>
+
+#include <new>
+
+#include "array.h"
+#include "memory.h"
+#include "type_traits.h"
+#include "utility.h"
+
+/**
+	When non-zero, object pools overwrite every slot they take back with
+	SSTL_POOL_POISON_BYTE, so a read through a dangling pointer shows an
+	obvious pattern instead of the old object. On unless NDEBUG is defined.
+*/
+#ifndef SSTL_POOL_POISON
+#	ifdef NDEBUG
+#		define SSTL_POOL_POISON 0
+#	else
+#		define SSTL_POOL_POISON 1
+#	endif
+#endif
+
+#ifndef SSTL_POOL_POISON_BYTE
+#	define SSTL_POOL_POISON_BYTE 0xdd
+#endif
+
+namespace sstl {
+
+/**
+	Fixed-size pool of up to N objects of type T with O(1) construct and
+	destroy. Free slots are chained through their own storage by index, so
+	the only bookkeeping beyond the slots is one liveness bit per slot.
+*/
+template<typename T, size_t N = 0>
+class object_pool;
+
+/** Common zero-size base class for all object pools. */
+template<typename T>
+class object_pool<T> {
+	typedef object_pool<T, 8> child;
+	typedef uint32_t live_word;
+
+  public:
+	typedef T                        value_type;
+	typedef value_type*              pointer;
+	typedef const value_type*        const_pointer;
+	typedef size_t                   size_type;
+	/** Stable index of an object in the pool, half the size of a pointer on 64-bit targets. */
+	typedef detail::stored_size_type handle_type;
+
+	/** Handle value which never refers to an object. */
+	static const handle_type invalid_handle = handle_type(-1);
+
+#if __cplusplus >= 201103
+	object_pool(const object_pool&) = delete;
+	object_pool& operator=(const object_pool&) = delete;
+
+	/** Constructs an object in-place from args, returns null if the pool is full. */
+	template<class... Args>
+	pointer construct(Args&&... args) {
+		const handle_type index = acquire();
+
+		if (index == invalid_handle) { return 0; }
+
+		return commit(index, new(static_cast<void*>(slots() + index)) value_type(sstl::forward<Args>(args)...));
+	}
+#else
+	/** Constructs a value-initialized object, returns null if the pool is full. */
+	pointer construct() {
+		const handle_type index = acquire();
+
+		if (index == invalid_handle) { return 0; }
+
+		return commit(index, new(static_cast<void*>(slots() + index)) value_type());
+	}
+	/** Constructs a copy of value, returns null if the pool is full. */
+	pointer construct(const value_type& value) {
+		const handle_type index = acquire();
+
+		if (index == invalid_handle) { return 0; }
+
+		return commit(index, new(static_cast<void*>(slots() + index)) value_type(value));
+	}
+#endif
+
+	/** Destroys the object at p and returns its slot to the pool. Null and pointers to free slots are ignored. */
+	void destroy(pointer p) {
+		const handle_type index = handle(p);
+
+		if (index == invalid_handle) { return; }
+
+		sstl::destroy_at(p);
+		release(index);
+	}
+
+	/** Returns the handle of the live object at p, or invalid_handle if p is not one. */
+	handle_type handle(const_pointer p) const {
+		const char* at = reinterpret_cast<const char*>(p);
+		const char* first = reinterpret_cast<const char*>(slots());
+
+		if (at < first || at >= first + max_size() * sizeof(slot)) { return invalid_handle; }
+
+		/* Pointers into the middle of a slot, such as to a member, are not objects of the pool. */
+		const size_t offset = size_t(at - first);
+
+		if (offset % sizeof(slot) != 0) { return invalid_handle; }
+
+		const handle_type index = handle_type(offset / sizeof(slot));
+		return is_live(index) ? index : invalid_handle;
+	}
+	/** Returns the live object referred to by h, or null if there is none. */
+	pointer get(handle_type h) {
+		return h < max_size() && is_live(h) ? reinterpret_cast<pointer>(slots() + h) : 0;
+	}
+	/** Returns the live object referred to by h, or null if there is none. */
+	const_pointer get(handle_type h) const {
+		return h < max_size() && is_live(h) ? reinterpret_cast<const_pointer>(slots() + h) : 0;
+	}
+	/** Checks whether p points to a live object of this pool. */
+	bool contains(const_pointer p) const { return handle(p) != invalid_handle; }
+
+	/** Checks whether the pool holds no objects. */
+	bool empty() const { return size() == 0; }
+	/** Checks whether every slot holds an object. */
+	bool full() const { return size() == max_size(); }
+	/** Returns the number of live objects. */
+	size_type size() const { return static_cast<const child*>(this)->size_; }
+	/** Returns the maximum possible number of objects. */
+	size_type max_size() const { return static_cast<const child*>(this)->capacity_; }
+
+	/**
+		Destroys every live object and returns all slots to the pool. Trivially
+		destructible objects are dropped without visiting their slots, which
+		leaves only the liveness bits to clear.
+	*/
+	void clear() {
+		typedef typename is_trivially_destructible<value_type>::type trivial;
+		destroy_live(trivial());
+
+		child* self = static_cast<child*>(this);
+		memset(live(), 0, live_word_count() * sizeof(live_word));
+#if SSTL_POOL_POISON
+		memset(static_cast<void*>(slots()), SSTL_POOL_POISON_BYTE, self->used_ * sizeof(slot));
+#endif
+		self->size_ = 0;
+		self->used_ = 0;
+		self->free_ = 0;
+	}
+
+  protected:
+	SSTL_CONSTEXPR object_pool() {}
+	~object_pool() {}
+
+	/** Slot of the pool, holding either an object or the link to the next free slot. */
+	union slot {
+		typename aligned_storage<sizeof(T), alignment_of<T>::value>::type value_;
+		/** One more than the index of the next free slot, zero at the end of the list. */
+		handle_type next_;
+	};
+
+  private:
+#if __cplusplus < 201103
+	object_pool(const object_pool&);
+	object_pool& operator=(const object_pool&);
+#endif
+
+	static const size_type live_word_bits = sizeof(live_word) * 8;
+
+	size_type live_word_count() const { return (max_size() + live_word_bits - 1) / live_word_bits; }
+
+	slot* slots() { return static_cast<child*>(this)->storage_.data_; }
+	const slot* slots() const { return static_cast<const child*>(this)->storage_.data_; }
+
+	/** The liveness bits directly follow the slots, which are at least as aligned as a live_word. */
+	live_word* live() { return reinterpret_cast<live_word*>(slots() + max_size()); }
+	const live_word* live() const { return reinterpret_cast<const live_word*>(slots() + max_size()); }
+
+	bool is_live(size_type index) const {
+		return (live()[index / live_word_bits] >> (index % live_word_bits)) & 1;
+	}
+
+	/** Takes a slot off the free list, or a never used one if the list is empty. */
+	handle_type acquire() {
+		child* self = static_cast<child*>(this);
+
+		if (self->free_) {
+			const handle_type index = self->free_ - 1;
+			self->free_ = slots()[index].next_;
+			return index;
+		}
+
+		return self->used_ < max_size() ? self->used_++ : invalid_handle;
+	}
+	/** Marks the slot at index live once its object has been constructed. */
+	pointer commit(handle_type index, pointer p) {
+		live()[index / live_word_bits] |= live_word(1) << (index % live_word_bits);
+		++static_cast<child*>(this)->size_;
+		return p;
+	}
+	/** Pushes the slot at index, whose object is already destroyed, onto the free list. */
+	void release(handle_type index) {
+		child* self = static_cast<child*>(this);
+		live()[index / live_word_bits] &= ~(live_word(1) << (index % live_word_bits));
+#if SSTL_POOL_POISON
+		memset(static_cast<void*>(slots() + index), SSTL_POOL_POISON_BYTE, sizeof(slot));
+#endif
+		slots()[index].next_ = self->free_;
+		self->free_ = index + 1;
+		--self->size_;
+	}
+
+	/** Visits the live objects a word of liveness bits at a time, skipping empty words. */
+	void destroy_live(false_type) {
+		const live_word* bits = live();
+
+		for (size_type i = 0; i < live_word_count(); ++i) {
+			for (live_word word = bits[i]; word; word &= word - 1) {
+				sstl::destroy_at(reinterpret_cast<pointer>(slots() + i * live_word_bits + detail::lowest_bit(word)));
+			}
+		}
+	}
+	void destroy_live(true_type) {}
+};
+
+template<typename T>
+const typename object_pool<T>::handle_type object_pool<T>::invalid_handle;
+
+/** Child class with size-specific storage for the slots. */
+template<typename T, size_t N>
+class object_pool : public object_pool<T> {
+	friend class object_pool<T>;
+	typedef object_pool<T> base;
+
+  public:
+	/** Default constructor, a constant initializer for pools with static storage. */
+	SSTL_CONSTEXPR object_pool() : base(), capacity_(N), size_(0), used_(0), free_(0), storage_(), live_() {}
+
+	~object_pool() { base::clear(); }
+
+	/** Returns the maximum possible number of objects. */
+	SSTL_CONSTEXPR14 size_t max_size() const { return N; }
+
+  private:
+	typedef typename detail::check_capacity<N>::type capacity_fits;
+	typedef typename base::slot slot;
+
+	detail::stored_size_type capacity_;
+	detail::stored_size_type size_;
+	/** Slots from used_ on have never held an object, so they need no free list entries. */
+	detail::stored_size_type used_;
+	/** One more than the index of the first free slot, zero if the free list is empty. */
+	detail::stored_size_type free_;
+
+	/**
+		Slot storage, wrapped so a constexpr constructor can initialize the
+		empty member instead, which leaves every byte of the slots untouched.
+	*/
+	union storage {
+		struct empty {};
+
+		SSTL_CONSTEXPR storage() : empty_() {}
+
+		empty empty_;
+		slot data_[N];
+	} storage_;
+
+	/** One bit per slot, set while the slot holds an object. */
+	uint32_t live_[(N + 31) / 32];
+};
+
+} /* namespace sstl */
+
+#endif /* STATIC_STL_OBJECT_POOL_H_ */
@@ -0,0 +1,270 @@
+#ifndef STATIC_STL_PRIORITY_QUEUE_H_
+#define STATIC_STL_PRIORITY_QUEUE_H_
+
+#include "algorithm.h"
+#include "functional.h"
+#include "iterator.h"
+#include "type_traits.h"
+#include "utility.h"
+#include "vector.h"
+
+namespace sstl {
+
+namespace detail {
+/** Gives a compilation error if a heap node would have fewer than two children. */
+template<size_t Arity>
+struct check_arity {
+	typedef typename enable_if < (Arity >= 2) >::type type;
+};
+
+/** Moves val up the Arity-ary max heap from hole until its parent is not less than it. */
+template<size_t Arity, class RandomIt, typename T, class Compare>
+void dary_push_heap(RandomIt first, size_t hole, T val, Compare comp) {
+	while (hole > 0) {
+		const size_t parent = (hole - 1) / Arity;
+
+		if (!comp(first[parent], val)) { break; }
+
+		first[hole] = sstl::move(first[parent]);
+		hole = parent;
+	}
+
+	first[hole] = sstl::move(val);
+}
+
+/**
+	Restores the Arity-ary max heap of len elements below hole after its
+	element was taken out, then puts val into the heap. The hole sinks to a
+	leaf along the largest children without comparing against val, which
+	usually belongs near the bottom, then val bubbles up from there.
+*/
+template<size_t Arity, class RandomIt, typename T, class Compare>
+void dary_adjust_heap(RandomIt first, size_t hole, size_t len, T val, Compare comp) {
+	const size_t top = hole;
+
+	for (size_t child = Arity * hole + 1; child < len; child = Arity * hole + 1) {
+		size_t largest = child;
+
+		if (child + Arity <= len) {
+			/* All children present: the fixed trip count unrolls and the selects compile to conditional moves. */
+			for (size_t i = 1; i < Arity; ++i) {
+				largest = comp(first[largest], first[child + i]) ? child + i : largest;
+			}
+		} else {
+			for (size_t i = child + 1; i < len; ++i) {
+				if (comp(first[largest], first[i])) { largest = i; }
+			}
+		}
+
+		first[hole] = sstl::move(first[largest]);
+		hole = largest;
+	}
+
+	while (hole > top) {
+		const size_t parent = (hole - 1) / Arity;
+
+		if (!comp(first[parent], val)) { break; }
+
+		first[hole] = sstl::move(first[parent]);
+		hole = parent;
+	}
+
+	first[hole] = sstl::move(val);
+}
+} /* namespace detail */
+
+/**
+	Fixed-capacity priority queue of up to N elements, top() being the
+	largest by Compare. The elements are an Arity-ary max heap in a vector:
+	with the default four children a node's children share a cache line
+	and the tree is half as deep as a binary heap, so pop() touches fewer
+	lines for a few more comparisons.
+
+	push() returns false and drops the element when the queue is full.
+*/
+template<typename T, size_t N = 0, class Compare = less<T>, size_t Arity = 4>
+class priority_queue;
+
+/** Common zero-size base class for all priority queues. */
+template<typename T, class Compare, size_t Arity>
+class priority_queue<T, 0, Compare, Arity> {
+	typedef priority_queue<T, 8, Compare, Arity> child;
+
+  public:
+	typedef vector<T>                                container_type;
+	typedef Compare                                  value_compare;
+	typedef typename container_type::value_type      value_type;
+	typedef typename container_type::size_type       size_type;
+	typedef typename container_type::reference       reference;
+	typedef typename container_type::const_reference const_reference;
+
+	/** Number of children of each node. */
+	static const size_type arity = Arity;
+
+	/** Copy assignment operator. */
+	priority_queue& operator=(const priority_queue& rhs) {
+		storage() = rhs.storage();
+		return *this;
+	}
+#if __cplusplus >= 201103
+	/** Move assignment operator. */
+	priority_queue& operator=(priority_queue&& rhs) {
+		storage() = sstl::move(rhs.storage());
+		return *this;
+	}
+#endif
+
+	/** Returns the largest element. The queue must not be empty. */
+	const_reference top() const { return storage().front(); }
+
+	/** Checks whether the container has no elements. */
+	bool empty() const { return size() == 0; }
+	/** Checks whether another element can be pushed. */
+	bool full() const { return size() == max_size(); }
+	/** Returns the number of elements in the container. */
+	size_type size() const { return storage().size(); }
+	/** Returns the maximum possible number of elements. */
+	size_type max_size() const { return storage().max_size(); }
+
+	/** Inserts a copy of value, returns false if the queue is full. O(log n). */
+	bool push(const value_type& value) {
+		if (full()) { return false; }
+
+		storage().push_back(value);
+		sift_up();
+		return true;
+	}
+#if __cplusplus >= 201103
+	/** Inserts value by moving it, returns false if the queue is full. O(log n). */
+	bool push(value_type&& value) {
+		if (full()) { return false; }
+
+		storage().push_back(sstl::move(value));
+		sift_up();
+		return true;
+	}
+
+	/** Inserts an element constructed from args, returns false if the queue is full. O(log n). */
+	template<class... Args>
+	bool emplace(Args&&... args) {
+		if (full()) { return false; }
+
+		storage().emplace_back(sstl::forward<Args>(args)...);
+		sift_up();
+		return true;
+	}
+#endif
+
+	/** Removes the largest element. The queue must not be empty. O(log n). */
+	void pop() {
+		vector<value_type>& k = storage();
+		value_type val(sstl::move(k.back()));
+
+		k.pop_back();
+
+		if (!k.empty()) {
+			detail::dary_adjust_heap<Arity>(k.begin(), 0, k.size(), sstl::move(val), value_comp());
+		}
+	}
+
+	/**
+		Replaces the contents with the first max_size() elements of [first,
+		last) and heapifies them bottom-up in O(n), cheaper than pushing
+		them one by one.
+	*/
+	template<class InputIt>
+	void assign(InputIt first, InputIt last) {
+		storage().assign(first, last);
+		heapify();
+	}
+
+	/** Removes all elements from the container. */
+	void clear() { storage().clear(); }
+
+	/** Returns the function object which orders the elements. */
+	value_compare value_comp() const { return value_compare(); }
+
+  protected:
+	SSTL_CONSTEXPR priority_queue() {}
+	~priority_queue() {}
+
+	vector<value_type>& storage() { return static_cast<child*>(this)->keys_; }
+	const vector<value_type>& storage() const { return static_cast<const child*>(this)->keys_; }
+
+	/** Arranges the stored elements into a heap, from the last parent up. */
+	void heapify() {
+		vector<value_type>& k = storage();
+		const size_type len = k.size();
+
+		for (size_type parent = len > 1 ? (len - 2) / Arity + 1 : 0; parent-- > 0;) {
+			value_type val(sstl::move(k[parent]));
+			detail::dary_adjust_heap<Arity>(k.begin(), parent, len, sstl::move(val), value_comp());
+		}
+	}
+
+  private:
+	typedef typename detail::check_arity<Arity>::type arity_fits;
+
+	/** Moves the element just appended up to its place. */
+	void sift_up() {
+		vector<value_type>& k = storage();
+		value_type val(sstl::move(k.back()));
+
+		detail::dary_push_heap<Arity>(k.begin(), k.size() - 1, sstl::move(val), value_comp());
+	}
+};
+
+/** Child class with size-specific storage for the underlying vector. */
+template<typename T, size_t N, class Compare, size_t Arity>
+class priority_queue : public priority_queue<T, 0, Compare, Arity> {
+	friend class priority_queue<T, 0, Compare, Arity>;
+	typedef priority_queue<T, 0, Compare, Arity> base;
+
+  public:
+	typedef typename base::container_type  container_type;
+	typedef typename base::value_compare   value_compare;
+	typedef typename base::value_type      value_type;
+	typedef typename base::size_type       size_type;
+	typedef typename base::reference       reference;
+	typedef typename base::const_reference const_reference;
+
+	/** Default constructor, a constant initializer for queues with static storage. */
+	SSTL_CONSTEXPR priority_queue() : base(), keys_() {}
+	/** Copy constructor. */
+	priority_queue(const priority_queue& other) : base(), keys_(other.keys_) {}
+#if __cplusplus >= 201103
+	/** Move constructor. */
+	priority_queue(priority_queue&& other) : base(), keys_(sstl::move(other.keys_)) {}
+#endif
+	/** Constructs the queue from the first N elements of [first, last), heapified in O(n). */
+	template<class InputIt>
+	priority_queue(InputIt first, InputIt last) : base(), keys_(first, last) {
+		base::heapify();
+	}
+
+	/** Returns the maximum possible number of elements. */
+	SSTL_CONSTEXPR14 size_type max_size() const { return N; }
+
+	/** Copy assignment operator. */
+	priority_queue& operator=(const priority_queue& rhs) {
+		base::operator=(rhs);
+		return *this;
+	}
+#if __cplusplus >= 201103
+	/** Move assignment operator. */
+	priority_queue& operator=(priority_queue&& rhs) {
+		base::operator=(sstl::move(rhs));
+		return *this;
+	}
+#endif
+
+  private:
+	vector<T, N> keys_;
+};
+
+template<typename T, class Compare, size_t Arity>
+const typename priority_queue<T, 0, Compare, Arity>::size_type priority_queue<T, 0, Compare, Arity>::arity;
+
+} /* namespace sstl */
+
+#endif /* STATIC_STL_PRIORITY_QUEUE_H_ */
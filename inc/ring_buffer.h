@@ -0,0 +1,444 @@
+#ifndef STATIC_STL_RING_BUFFER_H_
+#define STATIC_STL_RING_BUFFER_H_
+
+#include "algorithm.h"
+#include "array.h"
+#include "iterator.h"
+#include "memory.h"
+#include "type_traits.h"
+
+namespace sstl {
+
+namespace detail {
+/**
+	Random access iterator over ring buffer storage. The position is kept
+	unwrapped and only masked on access, so arithmetic and comparisons across
+	the wrap point behave as they would on a flat array.
+*/
+template<typename T>
+class ring_iterator {
+	template<typename> friend class ring_iterator;
+
+  public:
+	typedef random_access_iterator_tag     iterator_category;
+	typedef typename remove_const<T>::type value_type;
+	typedef T*                             pointer;
+	typedef T&                             reference;
+	typedef ptrdiff_t                      difference_type;
+
+	/** Default constructor. */
+	ring_iterator() : slots_(0), mask_(0), pos_(0) {}
+	/** Copy constructor, also converts an iterator into a const iterator. */
+	ring_iterator(const ring_iterator<value_type>& other)
+		: slots_(other.slots_), mask_(other.mask_), pos_(other.pos_) {}
+	/** Construct at unwrapped position pos of storage holding mask + 1 slots. */
+	ring_iterator(pointer slots, size_t mask, size_t pos)
+		: slots_(slots), mask_(mask), pos_(pos) {}
+
+	/** Returns a reference to the current element. */
+	reference operator*() const { return slots_[pos_ & mask_]; }
+	/** Returns a pointer to the current element. */
+	pointer operator->() const { return &slots_[pos_ & mask_]; }
+	/** Returns a reference to the element at specified relative location. */
+	reference operator[](difference_type n) const { return slots_[(pos_ + n) & mask_]; }
+	/** Pre-increments the iterator. */
+	ring_iterator& operator++() { ++pos_; return *this; }
+	/** Post-increments the iterator. */
+	ring_iterator operator++(int) { ring_iterator tmp(*this); ++pos_; return tmp; }
+	/** Pre-decrements the iterator. */
+	ring_iterator& operator--() { --pos_; return *this; }
+	/** Post-decrements the iterator. */
+	ring_iterator operator--(int) { ring_iterator tmp(*this); --pos_; return tmp; }
+	/** Returns an iterator which is advanced by n positions. */
+	ring_iterator operator+(difference_type n) const { return ring_iterator(slots_, mask_, pos_ + n); }
+	/** Returns an iterator which is advanced by -n positions. */
+	ring_iterator operator-(difference_type n) const { return ring_iterator(slots_, mask_, pos_ - n); }
+	/** Advances the iterator by n positions. */
+	ring_iterator& operator+=(difference_type n) { pos_ += n; return *this; }
+	/** Advances the iterator by -n positions. */
+	ring_iterator& operator-=(difference_type n) { pos_ -= n; return *this; }
+
+	/** Returns the number of elements between rhs and this iterator. */
+	template<typename U>
+	difference_type operator-(const ring_iterator<U>& rhs) const {
+		return difference_type(pos_ - rhs.pos_);
+	}
+
+	template<typename U>
+	bool operator==(const ring_iterator<U>& rhs) const { return pos_ == rhs.pos_; }
+	template<typename U>
+	bool operator!=(const ring_iterator<U>& rhs) const { return pos_ != rhs.pos_; }
+	template<typename U>
+	bool operator<(const ring_iterator<U>& rhs) const { return pos_ < rhs.pos_; }
+	template<typename U>
+	bool operator>(const ring_iterator<U>& rhs) const { return rhs.pos_ < pos_; }
+	template<typename U>
+	bool operator<=(const ring_iterator<U>& rhs) const { return !(rhs.pos_ < pos_); }
+	template<typename U>
+	bool operator>=(const ring_iterator<U>& rhs) const { return !(pos_ < rhs.pos_); }
+
+  private:
+	pointer slots_;
+	size_t mask_;
+	size_t pos_;
+};
+
+template<typename T>
+inline ring_iterator<T> operator+(typename ring_iterator<T>::difference_type n,
+                                  const ring_iterator<T>& it) {
+	return it + n;
+}
+} /* namespace detail */
+
+/**
+	Double-ended queue with fixed capacity, stored in a circular buffer. The
+	capacity is rounded up to a power of two so wrapping an index is a mask.
+*/
+template<typename T, size_t N = 0>
+class ring_buffer;
+
+/** Common zero-size base class for all ring buffers. */
+template<typename T>
+class ring_buffer<T> {
+	typedef ring_buffer<T, 8> child;
+
+  public:
+	typedef T                                      value_type;
+	typedef value_type*                            pointer;
+	typedef const value_type*                      const_pointer;
+	typedef value_type&                            reference;
+	typedef const value_type&                      const_reference;
+	typedef size_t                                 size_type;
+	typedef ptrdiff_t                              difference_type;
+	typedef detail::ring_iterator<T>               iterator;
+	typedef detail::ring_iterator<const T>         const_iterator;
+	typedef sstl::reverse_iterator<iterator>       reverse_iterator;
+	typedef sstl::reverse_iterator<const_iterator> const_reverse_iterator;
+
+	/** Copy assignment operator. */
+	ring_buffer& operator=(const ring_buffer& rhs) {
+		if (this != &rhs) { assign(rhs.begin(), rhs.end()); }
+
+		return *this;
+	}
+	/** Copy assignment operator for compatible ring buffer. */
+	template<typename T2>
+	ring_buffer& operator=(const ring_buffer<T2>& rhs) {
+		assign(rhs.begin(), rhs.end());
+		return *this;
+	}
+#if __cplusplus >= 201103
+	/** Move assignment operator, leaves rhs empty. */
+	ring_buffer& operator=(ring_buffer&& rhs) {
+		if (this != &rhs) {
+			clear();
+
+			for (iterator it = rhs.begin(); it != rhs.end() && !full(); ++it) {
+				push_back(sstl::move(*it));
+			}
+
+			rhs.clear();
+		}
+
+		return *this;
+	}
+#endif
+
+	/** Replaces the contents with copies of those in the range [first, last], up to the capacity. */
+	template<class InputIt>
+	void assign(InputIt first, InputIt last) {
+		clear();
+
+		for (; first != last && !full(); ++first) { push_back(*first); }
+	}
+
+	/** Random access operator. */
+	reference operator[](size_type pos) { return *slot(pos); }
+	const_reference operator[](size_type pos) const { return *slot(pos); }
+
+	/** Returns a reference to the element at specified location pos, with bounds checking. */
+	reference at(size_type pos) { return *slot(pos % max_size()); }
+	const_reference at(size_type pos) const { return *slot(pos % max_size()); }
+
+	/** Returns a reference to the first element in the container. */
+	reference front() { return *slot(0); }
+	const_reference front() const { return *slot(0); }
+
+	/** Returns reference to the last element in the container. */
+	reference back() { return *slot(size() - 1); }
+	const_reference back() const { return *slot(size() - 1); }
+
+	/** Returns an iterator to the first element of the container. */
+	iterator begin() { return iterator(slots(), mask(), head()); }
+	const_iterator begin() const { return const_iterator(slots(), mask(), head()); }
+	const_iterator cbegin() const { return begin(); }
+
+	/** Returns an iterator to the element following the last element of the container. */
+	iterator end() { return iterator(slots(), mask(), head() + size()); }
+	const_iterator end() const { return const_iterator(slots(), mask(), head() + size()); }
+	const_iterator cend() const { return end(); }
+
+	/** Returns a reverse iterator to the first element of the reversed container. */
+	reverse_iterator rbegin() { return reverse_iterator(end()); }
+	const_reverse_iterator rbegin() const { return const_reverse_iterator(end()); }
+	const_reverse_iterator crbegin() const { return rbegin(); }
+
+	/** Returns a reverse iterator to the element following the last element of the reversed container. */
+	reverse_iterator rend() { return reverse_iterator(begin()); }
+	const_reverse_iterator rend() const { return const_reverse_iterator(begin()); }
+	const_reverse_iterator crend() const { return rend(); }
+
+	/** Checks whether the container has no elements. */
+	bool empty() const { return size() == 0; }
+	/** Checks whether the container has no room for more elements. */
+	bool full() const { return size() == max_size(); }
+	/** Returns the number of elements in the container. */
+	size_type size() const { return static_cast<const child*>(this)->size_; }
+	/** Returns the maximum possible number of elements, N rounded up to a power of two. */
+	size_type max_size() const { return static_cast<const child*>(this)->capacity_; }
+	/** Returns the number of elements that the container has currently allocated space for. */
+	size_type capacity() const { return max_size(); }
+
+	/** Removes all elements from the container. */
+	void clear() {
+		const size_type run = head_run();
+		sstl::destroy(slots() + head(), slots() + head() + run);
+		sstl::destroy(slots(), slots() + (size() - run));
+		static_cast<child*>(this)->head_ = 0;
+		static_cast<child*>(this)->size_ = 0;
+	}
+
+	/*
+	 * The modifiers below read the counters once up front. An element store
+	 * may alias them (int and uint32_t, or any char type), which would
+	 * otherwise force a reload after constructing the element.
+	 */
+
+	/** Appends the given element value to the end of the container, if there is room. */
+	void push_back(const_reference value) {
+		child* self = static_cast<child*>(this);
+		const size_type size = self->size_;
+
+		if (size != self->capacity_) {
+			new(static_cast<void*>(slot_at(self->head_ + size))) value_type(value);
+			self->size_ = size + 1;
+		}
+	}
+	/** Prepends the given element value to the beginning of the container, if there is room. */
+	void push_front(const_reference value) {
+		child* self = static_cast<child*>(this);
+		const size_type size = self->size_;
+
+		if (size != self->capacity_) {
+			const size_type pos = (self->head_ - 1) & (self->capacity_ - 1);
+			new(static_cast<void*>(slots() + pos)) value_type(value);
+			self->head_ = pos;
+			self->size_ = size + 1;
+		}
+	}
+#if __cplusplus >= 201103
+	void push_back(value_type&& value) { emplace_back(sstl::move(value)); }
+	void push_front(value_type&& value) { emplace_front(sstl::move(value)); }
+
+	/** Appends an element constructed in-place from args to the end of the container. */
+	template<class... Args>
+	void emplace_back(Args&&... args) {
+		child* self = static_cast<child*>(this);
+		const size_type size = self->size_;
+
+		if (size != self->capacity_) {
+			new(static_cast<void*>(slot_at(self->head_ + size))) value_type(sstl::forward<Args>(args)...);
+			self->size_ = size + 1;
+		}
+	}
+	/** Prepends an element constructed in-place from args to the beginning of the container. */
+	template<class... Args>
+	void emplace_front(Args&&... args) {
+		child* self = static_cast<child*>(this);
+		const size_type size = self->size_;
+
+		if (size != self->capacity_) {
+			const size_type pos = (self->head_ - 1) & (self->capacity_ - 1);
+			new(static_cast<void*>(slots() + pos)) value_type(sstl::forward<Args>(args)...);
+			self->head_ = pos;
+			self->size_ = size + 1;
+		}
+	}
+#endif
+
+	/** Removes the first element of the container. */
+	void pop_front() {
+		child* self = static_cast<child*>(this);
+		const size_type head = self->head_;
+		const size_type size = self->size_;
+		const size_type mask = self->capacity_ - 1;
+
+		sstl::destroy_at(slots() + head);
+		self->head_ = (head + 1) & mask;
+		self->size_ = size - 1;
+	}
+	/** Removes the last element of the container. */
+	void pop_back() {
+		child* self = static_cast<child*>(this);
+		const size_type size = self->size_;
+
+		sstl::destroy_at(slot_at(self->head_ + size - 1));
+		self->size_ = size - 1;
+	}
+
+  protected:
+	SSTL_CONSTEXPR ring_buffer() {}
+	~ring_buffer() {}
+
+	/** Returns a pointer to the storage for the first slot. */
+	pointer slots() {
+		return reinterpret_cast<pointer>(static_cast<child*>(this)->storage_.data_);
+	}
+	const_pointer slots() const {
+		return reinterpret_cast<const_pointer>(static_cast<const child*>(this)->storage_.data_);
+	}
+
+	/** Returns a pointer to the element at logical position pos. */
+	pointer slot(size_type pos) { return slot_at(head() + pos); }
+	const_pointer slot(size_type pos) const { return slots() + ((head() + pos) & mask()); }
+	/** Returns a pointer to the slot at unwrapped index i. */
+	pointer slot_at(size_type i) { return slots() + (i & mask()); }
+
+	/** Returns the slot index of the first element. */
+	size_type head() const { return static_cast<const child*>(this)->head_; }
+	/** Returns the mask which wraps an index into the storage. */
+	size_type mask() const { return max_size() - 1; }
+	/** Returns the number of elements stored contiguously from the head, before the storage wraps. */
+	size_type head_run() const { return sstl::min(size(), max_size() - head()); }
+};
+
+/** Child class with size-specific storage for the underlying ring buffer. */
+template<typename T, size_t N>
+class ring_buffer : public ring_buffer<T> {
+	friend class ring_buffer<T>;
+	typedef ring_buffer<T> base;
+
+	static const size_t slot_count = detail::next_power_of_two<N>::value;
+
+  public:
+	typedef typename base::pointer                pointer;
+	typedef typename base::const_pointer          const_pointer;
+	typedef typename base::value_type             value_type;
+	typedef typename base::reference              reference;
+	typedef typename base::const_reference        const_reference;
+	typedef typename base::size_type              size_type;
+	typedef typename base::difference_type        difference_type;
+	typedef typename base::iterator               iterator;
+	typedef typename base::const_iterator         const_iterator;
+	typedef typename base::reverse_iterator       reverse_iterator;
+	typedef typename base::const_reverse_iterator const_reverse_iterator;
+
+	/** Default constructor, a constant initializer for ring buffers with static storage. */
+	SSTL_CONSTEXPR ring_buffer()
+		: base(), capacity_(slot_count), head_(0), size_(0), storage_() {}
+	/** Copy constructor, the copy starts at the beginning of its storage. */
+	ring_buffer(const ring_buffer& other)
+		: base(), capacity_(slot_count), head_(0), size_(other.size_) {
+		const size_type run = other.head_run();
+		sstl::uninitialized_copy_n(other.slots(), size_ - run,
+		                           sstl::uninitialized_copy_n(other.slot(0), run, base::slots()));
+	}
+	/** Copy adapter constructor. */
+	template<typename T2>
+	ring_buffer(const ring_buffer<T2>& other)
+		: base(), capacity_(slot_count), head_(0), size_(0) {
+		base::assign(other.begin(), other.end());
+	}
+#if __cplusplus >= 201103
+	/** Move constructor, leaves other empty. */
+	ring_buffer(ring_buffer&& other)
+		: base(), capacity_(slot_count), head_(0), size_(other.size_) {
+		const size_type run = other.head_run();
+		sstl::uninitialized_move_n(other.slots(), size_ - run,
+		                           sstl::uninitialized_move_n(other.slot(0), run, base::slots()));
+		other.clear();
+	}
+#endif
+
+	~ring_buffer() { base::clear(); }
+
+	/** Copy assignment operator. */
+	ring_buffer& operator=(const ring_buffer& rhs) {
+		base::operator=(rhs);
+		return *this;
+	}
+	/** Copy assignment operator for compatible ring buffer. */
+	template<typename T2>
+	ring_buffer& operator=(const ring_buffer<T2>& rhs) {
+		base::assign(rhs.begin(), rhs.end());
+		return *this;
+	}
+#if __cplusplus >= 201103
+	/** Move assignment operator, leaves rhs empty. */
+	ring_buffer& operator=(ring_buffer&& rhs) {
+		base::operator=(static_cast<base&&>(rhs));
+		return *this;
+	}
+#endif
+
+	/** Returns the maximum possible number of elements, N rounded up to a power of two. */
+	SSTL_CONSTEXPR14 size_type max_size() const { return slot_count; }
+	/** Returns the number of elements that the container has currently allocated space for. */
+	SSTL_CONSTEXPR14 size_type capacity() const { return slot_count; }
+
+  private:
+	typedef typename
+	aligned_storage<sizeof(T), alignment_of<T>::value>::type element;
+
+	typedef typename detail::check_capacity<slot_count>::type capacity_fits;
+
+	detail::stored_size_type capacity_;
+	detail::stored_size_type head_;
+	detail::stored_size_type size_;
+
+	/** Element storage, see vector for why it is wrapped in a union. */
+	union storage {
+		struct empty {};
+
+		SSTL_CONSTEXPR storage() : empty_() {}
+
+		empty empty_;
+		element data_[slot_count];
+	} storage_;
+};
+
+template<typename T>
+inline bool operator==(const ring_buffer<T>& lhs, const ring_buffer<T>& rhs) {
+	return lhs.size() == rhs.size() &&
+	       sstl::equal(lhs.cbegin(), lhs.cend(), rhs.cbegin());
+}
+
+template<typename T>
+inline bool operator!=(const ring_buffer<T>& lhs, const ring_buffer<T>& rhs) {
+	return !(lhs == rhs);
+}
+
+template<typename T>
+inline bool operator<(const ring_buffer<T>& lhs, const ring_buffer<T>& rhs) {
+	return sstl::lexicographical_compare(lhs.cbegin(), lhs.cend(),
+	                                     rhs.cbegin(), rhs.cend());
+}
+
+template<typename T>
+inline bool operator>(const ring_buffer<T>& lhs, const ring_buffer<T>& rhs) {
+	return rhs < lhs;
+}
+
+template<typename T>
+inline bool operator<=(const ring_buffer<T>& lhs, const ring_buffer<T>& rhs) {
+	return !(rhs < lhs);
+}
+
+template<typename T>
+inline bool operator>=(const ring_buffer<T>& lhs, const ring_buffer<T>& rhs) {
+	return !(lhs < rhs);
+}
+
+} /* namespace sstl */
+
+#endif /* STATIC_STL_RING_BUFFER_H_ */
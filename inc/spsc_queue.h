@@ -0,0 +1,224 @@
+#ifndef STATIC_STL_SPSC_QUEUE_H_
+#define STATIC_STL_SPSC_QUEUE_H_
+
+#if __cplusplus >= 201103
+
+#include <atomic>
+#include <new>
+
+#include "algorithm.h"
+#include "array.h"
+#include "memory.h"
+#include "type_traits.h"
+#include "utility.h"
+
+namespace sstl {
+
+/**
+	Wait-free queue with fixed capacity for exactly one producer thread and
+	one consumer thread. The capacity is rounded up to a power of two.
+*/
+template<typename T, size_t N = 0>
+class spsc_queue;
+
+/** Common zero-size base class for all single-producer/single-consumer queues. */
+template<typename T>
+class spsc_queue<T> {
+	typedef spsc_queue<T, 8> child;
+
+  public:
+	typedef T                 value_type;
+	typedef value_type*       pointer;
+	typedef const value_type* const_pointer;
+	typedef value_type&       reference;
+	typedef const value_type& const_reference;
+	typedef size_t            size_type;
+
+	spsc_queue(const spsc_queue&) = delete;
+	spsc_queue& operator=(const spsc_queue&) = delete;
+
+	/** Producer: appends a copy of value, returns false if the queue is full. */
+	bool push(const_reference value) { return emplace(value); }
+	/** Producer: appends value by moving it, returns false if the queue is full. */
+	bool push(value_type&& value) { return emplace(sstl::move(value)); }
+
+	/** Producer: appends an element constructed in-place from args, returns false if the queue is full. */
+	template<class... Args>
+	bool emplace(Args&&... args) {
+		child* self = static_cast<child*>(this);
+		const size_type tail = self->tail_.load(std::memory_order_relaxed);
+
+		if (tail - self->head_cache_ == capacity()) {
+			self->head_cache_ = self->head_.load(std::memory_order_acquire);
+
+			if (tail - self->head_cache_ == capacity()) { return false; }
+		}
+
+		new(static_cast<void*>(slot(tail))) value_type(sstl::forward<Args>(args)...);
+		self->tail_.store(tail + 1, std::memory_order_release);
+		return true;
+	}
+
+	/**
+		Producer: appends copies of up to count values, publishing them all
+		with a single atomic store. Returns the number of values appended.
+	*/
+	size_type push(const_pointer values, size_type count) {
+		child* self = static_cast<child*>(this);
+		const size_type tail = self->tail_.load(std::memory_order_relaxed);
+
+		if (capacity() - (tail - self->head_cache_) < count) {
+			self->head_cache_ = self->head_.load(std::memory_order_acquire);
+			count = sstl::min(count, capacity() - (tail - self->head_cache_));
+		}
+
+		const size_type run = sstl::min(count, capacity() - (tail & mask()));
+		sstl::uninitialized_copy_n(values, run, slot(tail));
+		sstl::uninitialized_copy_n(values + run, count - run, slots());
+		self->tail_.store(tail + count, std::memory_order_release);
+		return count;
+	}
+
+	/** Consumer: moves the oldest element into value, returns false if the queue is empty. */
+	bool pop(reference value) {
+		child* self = static_cast<child*>(this);
+		const size_type head = self->head_.load(std::memory_order_relaxed);
+
+		if (head == self->tail_cache_) {
+			self->tail_cache_ = self->tail_.load(std::memory_order_acquire);
+
+			if (head == self->tail_cache_) { return false; }
+		}
+
+		pointer p = slot(head);
+		value = sstl::move(*p);
+		sstl::destroy_at(p);
+		self->head_.store(head + 1, std::memory_order_release);
+		return true;
+	}
+
+	/**
+		Consumer: moves up to count of the oldest elements into values,
+		releasing their slots with a single atomic store. Returns the number
+		of elements removed.
+	*/
+	size_type pop(pointer values, size_type count) {
+		child* self = static_cast<child*>(this);
+		const size_type head = self->head_.load(std::memory_order_relaxed);
+
+		if (self->tail_cache_ - head < count) {
+			self->tail_cache_ = self->tail_.load(std::memory_order_acquire);
+			count = sstl::min(count, self->tail_cache_ - head);
+		}
+
+		const size_type run = sstl::min(count, capacity() - (head & mask()));
+		sstl::move(slot(head), slot(head) + run, values);
+		sstl::destroy(slot(head), slot(head) + run);
+		sstl::move(slots(), slots() + (count - run), values + run);
+		sstl::destroy(slots(), slots() + (count - run));
+		self->head_.store(head + count, std::memory_order_release);
+		return count;
+	}
+
+	/** Returns the number of elements, only exact when called from a thread that is not racing with either side. */
+	size_type size() const {
+		const child* self = static_cast<const child*>(this);
+		return self->tail_.load(std::memory_order_acquire) -
+		       self->head_.load(std::memory_order_acquire);
+	}
+	/** Checks whether the queue has no elements, with the same caveat as size(). */
+	bool empty() const { return size() == 0; }
+	/** Returns the maximum possible number of elements, N rounded up to a power of two. */
+	size_type max_size() const { return static_cast<const child*>(this)->capacity_; }
+	/** Returns the number of elements that the container has allocated space for. */
+	size_type capacity() const { return max_size(); }
+
+  protected:
+	constexpr spsc_queue() {}
+	~spsc_queue() {}
+
+	/** Returns a pointer to the storage for the first slot. */
+	pointer slots() {
+		return reinterpret_cast<pointer>(static_cast<child*>(this)->storage_.data_);
+	}
+	/** Returns a pointer to the slot for unwrapped index i. */
+	pointer slot(size_type i) { return slots() + (i & mask()); }
+	/** Returns the mask which wraps an index into the storage. */
+	size_type mask() const { return max_size() - 1; }
+
+	/** Destroys the remaining elements, only safe once neither side is running. */
+	void destroy_elements() {
+		child* self = static_cast<child*>(this);
+		const size_type tail = self->tail_.load(std::memory_order_relaxed);
+
+		for (size_type i = self->head_.load(std::memory_order_relaxed); i != tail; ++i) {
+			sstl::destroy_at(slot(i));
+		}
+	}
+};
+
+/** Child class with size-specific storage for the underlying queue. */
+template<typename T, size_t N>
+class spsc_queue : public spsc_queue<T> {
+	friend class spsc_queue<T>;
+	typedef spsc_queue<T> base;
+
+	static const size_t slot_count = detail::next_power_of_two<N>::value;
+
+  public:
+	typedef typename base::value_type      value_type;
+	typedef typename base::pointer         pointer;
+	typedef typename base::const_pointer   const_pointer;
+	typedef typename base::reference       reference;
+	typedef typename base::const_reference const_reference;
+	typedef typename base::size_type       size_type;
+
+	/** Default constructor, a constant initializer for queues with static storage. */
+	constexpr spsc_queue()
+		: base(), capacity_(slot_count), head_(0), tail_cache_(0), tail_(0),
+		  head_cache_(0), storage_() {}
+
+	~spsc_queue() { base::destroy_elements(); }
+
+	/** Returns the maximum possible number of elements, N rounded up to a power of two. */
+	SSTL_CONSTEXPR14 size_type max_size() const { return slot_count; }
+	/** Returns the number of elements that the container has allocated space for. */
+	SSTL_CONSTEXPR14 size_type capacity() const { return slot_count; }
+
+  private:
+	typedef typename
+	aligned_storage<sizeof(T), alignment_of<T>::value>::type element;
+
+	typedef typename detail::check_capacity<slot_count>::type capacity_fits;
+
+	/*
+	 * Each side writes only its own index, and keeps a cached copy of the
+	 * other side's index so it only touches the other cache line when the
+	 * cached copy says the queue is full (or empty).
+	 */
+	detail::stored_size_type capacity_;
+
+	/** Consumer side. */
+	alignas(SSTL_CACHE_LINE_SIZE) std::atomic<size_t> head_;
+	size_t tail_cache_;
+
+	/** Producer side. */
+	alignas(SSTL_CACHE_LINE_SIZE) std::atomic<size_t> tail_;
+	size_t head_cache_;
+
+	/** Element storage, see vector for why it is wrapped in a union. */
+	union alignas(SSTL_CACHE_LINE_SIZE) storage {
+		struct empty {};
+
+		constexpr storage() : empty_() {}
+
+		empty empty_;
+		element data_[slot_count];
+	} storage_;
+};
+
+} /* namespace sstl */
+
+#endif /* __cplusplus >= 201103 */
+
+#endif /* STATIC_STL_SPSC_QUEUE_H_ */
@@ -0,0 +1,81 @@
+#ifndef STATIC_STL_STATIC_ALLOCATOR_H_
+#define STATIC_STL_STATIC_ALLOCATOR_H_
+
+#include <new>
+
+#include "arena.h"
+#include "type_traits.h"
+
+namespace sstl {
+
+/**
+	Allocator meeting the std Allocator requirements which serves std
+	containers from an arena. Deallocation only reclaims memory of the
+	most recent allocation, the rest comes back when the arena is released.
+	Exhausting the arena throws std::bad_alloc.
+*/
+template<typename T>
+class static_allocator {
+	template<typename U>
+	friend class static_allocator;
+
+  public:
+	typedef T                 value_type;
+	typedef value_type*       pointer;
+	typedef const value_type* const_pointer;
+	typedef value_type&       reference;
+	typedef const value_type& const_reference;
+	typedef size_t            size_type;
+	typedef ptrdiff_t         difference_type;
+
+	template<typename U>
+	struct rebind { typedef static_allocator<U> other; };
+
+	/** Constructs an allocator which serves allocations from a. */
+	explicit static_allocator(arena<>& a) : arena_(&a) {}
+	/** Constructs an allocator for T sharing other's arena. */
+	template<typename U>
+	static_allocator(const static_allocator<U>& other) : arena_(other.arena_) {}
+
+	/** Allocates space for n objects of type T. Counts beyond max_size() fail without computing their size. */
+	pointer allocate(size_type n, const void* = 0) {
+		if (n > max_size()) { return static_cast<pointer>(detail::checked_allocation(0)); }
+
+		return static_cast<pointer>(detail::checked_allocation(
+		                                arena_->allocate(n * sizeof(T), alignment_of<T>::value)));
+	}
+	/** Returns the space for n objects at p. */
+	void deallocate(pointer p, size_type n) { arena_->deallocate(p, n * sizeof(T)); }
+
+	/** Returns the largest number of objects the arena could hold. */
+	size_type max_size() const { return arena_->max_size() / sizeof(T); }
+
+#if __cplusplus < 201103
+	pointer address(reference x) const { return &x; }
+	const_pointer address(const_reference x) const { return &x; }
+
+	void construct(pointer p, const_reference value) { new(static_cast<void*>(p)) value_type(value); }
+	void destroy(pointer p) { p->~value_type(); }
+#endif
+
+	/** Returns the arena allocations are served from. */
+	arena<>& get_arena() const { return *arena_; }
+
+  private:
+	arena<>* arena_;
+};
+
+/** Allocators are interchangeable if they share an arena. */
+template<typename T, typename U>
+inline bool operator==(const static_allocator<T>& lhs, const static_allocator<U>& rhs) {
+	return &lhs.get_arena() == &rhs.get_arena();
+}
+
+template<typename T, typename U>
+inline bool operator!=(const static_allocator<T>& lhs, const static_allocator<U>& rhs) {
+	return !(lhs == rhs);
+}
+
+} /* namespace sstl */
+
+#endif /* STATIC_STL_STATIC_ALLOCATOR_H_ */
@@ -4,6 +4,64 @@
 #include <stddef.h>
 #include <stdint.h>
 
+/*
+ * C++11 only allows a single return statement in a constexpr function, so
+ * anything with a loop or a branch on the tag is marked SSTL_CONSTEXPR14.
+ * Both expand to nothing where constexpr is not available.
+ */
+#if __cplusplus >= 201103
+#  define SSTL_CONSTEXPR constexpr
+#else
+#  define SSTL_CONSTEXPR
+#endif
+
+#if __cplusplus >= 201402
+#  define SSTL_CONSTEXPR14 constexpr
+#else
+#  define SSTL_CONSTEXPR14
+#endif
+
+/*
+ * True while a constant expression is being evaluated, which lets the block
+ * copy and fill paths fall back to plain loops that the compiler can run.
+ * Without compiler support those paths stay usable at run time only.
+ */
+#if __cplusplus >= 201402 && defined(__has_builtin)
+#  if __has_builtin(__builtin_is_constant_evaluated)
+#    define SSTL_IS_CONSTANT_EVALUATED() __builtin_is_constant_evaluated()
+#  endif
+#endif
+#if __cplusplus >= 201402 && !defined(SSTL_IS_CONSTANT_EVALUATED) && \
+    !defined(__clang__) && defined(__GNUC__) && (__GNUC__ >= 9)
+#  define SSTL_IS_CONSTANT_EVALUATED() __builtin_is_constant_evaluated()
+#endif
+#if !defined(SSTL_IS_CONSTANT_EVALUATED)
+#  define SSTL_IS_CONSTANT_EVALUATED() false
+#endif
+
+/** Alignment used to keep data written by different threads on separate cache lines. */
+#ifndef SSTL_CACHE_LINE_SIZE
+#  define SSTL_CACHE_LINE_SIZE 64
+#endif
+
+/** Hints that the cache line holding address will be read soon, a no-op where the compiler has no such builtin. */
+#if defined(__GNUC__) || defined(__clang__)
+#  define SSTL_PREFETCH(address) __builtin_prefetch(address)
+#else
+#  define SSTL_PREFETCH(address) ((void)0)
+#endif
+
+/*
+ * Set when SSE2 intrinsics can be used. Define SSTL_NO_SSE2 to force the
+ * portable scalar code paths instead.
+ */
+#if !defined(SSTL_NO_SSE2) && (defined(__SSE2__) || defined(_M_X64) || \
+    (defined(_M_IX86_FP) && _M_IX86_FP >= 2))
+#  define SSTL_HAS_SSE2 1
+#else
+#  define SSTL_HAS_SSE2 0
+#endif
+
 namespace sstl {
 
 /** Provides the member typedef type which is the same as T, except that its topmost const-qualifier is removed. */
@@ -26,6 +84,18 @@ struct remove_cv {
 	typedef typename remove_const<typename remove_volatile<T>::type>::type type;
 };
 
+/** Provides the member typedef type which is the type referred to by T, or T if it is not a reference. */
+template<typename T>
+struct remove_reference { typedef T type; };
+
+template<typename T>
+struct remove_reference<T&> { typedef T type; };
+
+#if __cplusplus >= 201103
+template<typename T>
+struct remove_reference<T&&> { typedef T type; };
+#endif
+
 /** Wraps a static constant of specified type. */
 template<typename T, T v>
 struct integral_constant {
@@ -34,8 +104,8 @@ struct integral_constant {
 	typedef T                 value_type;
 	typedef integral_constant type;
 
-	operator value_type() const { return value; }
-	value_type operator()() const { return value; }
+	SSTL_CONSTEXPR operator value_type() const { return value; }
+	SSTL_CONSTEXPR value_type operator()() const { return value; }
 };
 
 typedef integral_constant<bool, true>  true_type;
@@ -74,7 +144,234 @@ struct enable_if {};
 template<class T>
 struct enable_if<true, T> { typedef T type; };
 
+/** Provides member typedef type, which is defined as T if B is true, or as F if B is false. */
+template<bool B, typename T, typename F>
+struct conditional { typedef T type; };
+
+template<typename T, typename F>
+struct conditional<false, T, F> { typedef F type; };
+
+/** Checks whether T and U name the same type, including cv-qualifications. */
+template<typename T, typename U>
+struct is_same : public false_type {};
+
+template<typename T>
+struct is_same<T, T> : public true_type {};
+
+/** Checks whether T is a const-qualified type. */
+template<typename T>
+struct is_const : public false_type {};
+
+template<typename T>
+struct is_const<const T> : public true_type {};
+
+/** Checks whether T is a volatile-qualified type. */
+template<typename T>
+struct is_volatile : public false_type {};
+
+template<typename T>
+struct is_volatile<volatile T> : public true_type {};
+
+namespace detail {
+template<typename> struct is_pointer : public false_type {};
+template<typename T> struct is_pointer<T*> : public true_type {};
+
+template<typename> struct is_floating_point : public false_type {};
+template<> struct is_floating_point<float> : public true_type {};
+template<> struct is_floating_point<double> : public true_type {};
+template<> struct is_floating_point<long double> : public true_type {};
+} /* namespace detail */
+
+/** Checks whether T is a pointer to object or a pointer to function. */
+template<typename T> struct is_pointer :
+	public detail::is_pointer<typename remove_cv<T>::type>::type {};
+
+/** Checks whether T is a floating-point type. */
+template<typename T> struct is_floating_point :
+	public detail::is_floating_point<typename remove_cv<T>::type>::type {};
+
+/** Checks whether T is an arithmetic type. */
+template<typename T> struct is_arithmetic :
+	public integral_constant < bool, is_integral<T>::value ||
+	is_floating_point<T>::value > {};
+
+namespace detail {
+template<typename T, bool = is_integral<T>::value>
+struct is_signed : public integral_constant < bool, (T(-1) < T(0)) > {};
+
+/** Floating-point types are all signed, and not allowed in C++98 constant expressions. */
+template<typename T>
+struct is_signed<T, false> : public is_floating_point<T>::type {};
+} /* namespace detail */
+
+/** Checks whether T is an arithmetic type which can represent negative values. */
+template<typename T> struct is_signed :
+	public detail::is_signed<typename remove_cv<T>::type>::type {};
+
+/** Checks whether T is an arithmetic type which cannot represent negative values. */
+template<typename T> struct is_unsigned :
+	public integral_constant < bool, is_arithmetic<T>::value &&
+	!is_signed<T>::value > {};
+
+/*
+ * The triviality traits below cannot be implemented in the language itself
+ * before C++11, so they lean on compiler intrinsics when available. Without
+ * them, only scalar types are reported as trivial, which is always safe.
+ */
+#if defined(__clang__)
+#  if __has_feature(is_trivially_copyable)
+#    define SSTL_IS_TRIVIALLY_COPYABLE(T) __is_trivially_copyable(T)
+#  endif
+#  if __has_feature(is_trivially_destructible)
+#    define SSTL_IS_TRIVIALLY_DESTRUCTIBLE(T) __is_trivially_destructible(T)
+#  endif
+#  if __has_feature(is_enum)
+#    define SSTL_IS_ENUM(T) __is_enum(T)
+#  endif
+#  if __has_feature(is_trivially_constructible)
+#    define SSTL_IS_TRIVIALLY_DEFAULT_CONSTRUCTIBLE(T) __is_trivially_constructible(T)
+#  endif
+#elif defined(__GNUC__) && (__GNUC__ >= 5)
+#  define SSTL_IS_TRIVIALLY_COPYABLE(T) __is_trivially_copyable(T)
+#  define SSTL_IS_TRIVIALLY_DESTRUCTIBLE(T) __has_trivial_destructor(T)
+#  define SSTL_IS_TRIVIALLY_DEFAULT_CONSTRUCTIBLE(T) __has_trivial_constructor(T)
+#  define SSTL_IS_ENUM(T) __is_enum(T)
+#elif defined(__GNUC__) && ((__GNUC__ > 4) || (__GNUC__ == 4 && __GNUC_MINOR__ >= 3))
+#  define SSTL_IS_TRIVIALLY_COPYABLE(T) \
+	(__has_trivial_copy(T) && __has_trivial_assign(T) && __has_trivial_destructor(T))
+#  define SSTL_IS_TRIVIALLY_DESTRUCTIBLE(T) __has_trivial_destructor(T)
+#  define SSTL_IS_TRIVIALLY_DEFAULT_CONSTRUCTIBLE(T) __has_trivial_constructor(T)
+#  define SSTL_IS_ENUM(T) __is_enum(T)
+#elif defined(_MSC_VER) && (_MSC_VER >= 1700)
+#  define SSTL_IS_TRIVIALLY_COPYABLE(T) __is_trivially_copyable(T)
+#  define SSTL_IS_TRIVIALLY_DESTRUCTIBLE(T) __has_trivial_destructor(T)
+#  define SSTL_IS_TRIVIALLY_DEFAULT_CONSTRUCTIBLE(T) __has_trivial_constructor(T)
+#  define SSTL_IS_ENUM(T) __is_enum(T)
+#endif
+
+/** Checks whether T is an enumeration type, always false without compiler support. */
+#if defined(SSTL_IS_ENUM)
+template<typename T> struct is_enum :
+	public integral_constant<bool, SSTL_IS_ENUM(T)> {};
+#else
+template<typename T> struct is_enum : public false_type {};
+#endif
+
+/** Checks whether T is a scalar type. */
+template<typename T> struct is_scalar :
+	public integral_constant < bool, is_arithmetic<T>::value ||
+	is_pointer<T>::value || is_enum<T>::value > {};
+
+/** Checks whether T can be copied with memcpy/memmove. */
+#if defined(SSTL_IS_TRIVIALLY_COPYABLE)
+template<typename T> struct is_trivially_copyable :
+	public integral_constant<bool, SSTL_IS_TRIVIALLY_COPYABLE(T)> {};
+#else
+template<typename T> struct is_trivially_copyable :
+	public is_scalar<T>::type {};
+#endif
+
+/** Checks whether destroying a T is a no-op. */
+#if defined(SSTL_IS_TRIVIALLY_DESTRUCTIBLE)
+template<typename T> struct is_trivially_destructible :
+	public integral_constant<bool, SSTL_IS_TRIVIALLY_DESTRUCTIBLE(T)> {};
+#else
+template<typename T> struct is_trivially_destructible :
+	public is_scalar<T>::type {};
+#endif
+
+/** Checks whether default-initializing a T leaves it untouched. */
+#if defined(SSTL_IS_TRIVIALLY_DEFAULT_CONSTRUCTIBLE)
+template<typename T> struct is_trivially_default_constructible :
+	public integral_constant<bool, SSTL_IS_TRIVIALLY_DEFAULT_CONSTRUCTIBLE(T)> {};
+#else
+template<typename T> struct is_trivially_default_constructible :
+	public is_scalar<T>::type {};
+#endif
+
+/** Checks whether a range of T can be filled with memset, i.e. T is a trivially copyable single byte. */
+template<typename T> struct is_bitwise_fillable :
+	public integral_constant < bool, sizeof(T) == 1 &&
+	is_trivially_copyable<T>::value && !is_volatile<T>::value > {};
+
 namespace detail {
+/** Provides the member constant value, the smallest power of two that is at least N. */
+template < size_t N, size_t P = 1, bool Done = (P >= N) >
+struct next_power_of_two {
+	static const size_t value = next_power_of_two < N, P * 2 >::value;
+};
+
+template<size_t N, size_t P>
+struct next_power_of_two<N, P, true> {
+	static const size_t value = P;
+};
+
+/*
+ * Bit scans and population counts, compiled to single instructions where
+ * the compiler provides builtins. The fallbacks are plain C++98.
+ */
+
+/** Returns the index of the lowest set bit, bits must not be zero. */
+inline unsigned lowest_bit(uint32_t bits) {
+#if defined(__GNUC__)
+	return unsigned(__builtin_ctz(bits));
+#else
+	unsigned index = 0;
+
+	for (; !(bits & 1); bits >>= 1) { ++index; }
+
+	return index;
+#endif
+}
+inline unsigned lowest_bit(uint64_t bits) {
+#if defined(__GNUC__)
+	return unsigned(__builtin_ctzll(bits));
+#else
+	const uint32_t low = uint32_t(bits);
+	return low ? lowest_bit(low) : 32u + lowest_bit(uint32_t(bits >> 32));
+#endif
+}
+
+/** Returns the index of the highest set bit, bits must not be zero. */
+inline unsigned highest_bit(uint32_t bits) {
+#if defined(__GNUC__)
+	return 31u - unsigned(__builtin_clz(bits));
+#else
+	unsigned index = 0;
+
+	for (; bits >>= 1;) { ++index; }
+
+	return index;
+#endif
+}
+inline unsigned highest_bit(uint64_t bits) {
+#if defined(__GNUC__)
+	return 63u - unsigned(__builtin_clzll(bits));
+#else
+	const uint32_t high = uint32_t(bits >> 32);
+	return high ? 32u + highest_bit(high) : highest_bit(uint32_t(bits));
+#endif
+}
+
+/** Returns the number of set bits. */
+inline unsigned popcount(uint32_t bits) {
+#if defined(__GNUC__)
+	return unsigned(__builtin_popcount(bits));
+#else
+	bits = bits - ((bits >> 1) & 0x55555555u);
+	bits = (bits & 0x33333333u) + ((bits >> 2) & 0x33333333u);
+	bits = (bits + (bits >> 4)) & 0x0F0F0F0Fu;
+	return unsigned((bits * 0x01010101u) >> 24);
+#endif
+}
+inline unsigned popcount(uint64_t bits) {
+#if defined(__GNUC__)
+	return unsigned(__builtin_popcountll(bits));
+#else
+	return popcount(uint32_t(bits)) + popcount(uint32_t(bits >> 32));
+#endif
+}
+
 template<typename T>
 struct alignment_of {
 	struct alignment_wrapper {
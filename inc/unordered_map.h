@@ -0,0 +1,305 @@
+#ifndef STATIC_STL_UNORDERED_MAP_H_
+#define STATIC_STL_UNORDERED_MAP_H_
+
+#include <new>
+
+#include "functional.h"
+#include "hash_table.h"
+#include "memory.h"
+#include "type_traits.h"
+#include "utility.h"
+
+namespace sstl {
+
+namespace detail {
+/** Hash table traits for unordered_map, whose slots are key and value pairs. */
+template<typename K, typename V, class Hash, class KeyEqual>
+struct hash_map_traits {
+	typedef K                  key_type;
+	typedef pair<const K, V>   slot_type;
+	typedef Hash               hasher;
+	typedef KeyEqual           key_equal;
+
+	static const K& key(const slot_type& slot) { return slot.first; }
+};
+} /* namespace detail */
+
+/**
+	Associative container with unique keys and fixed capacity, stored in an
+	open addressing hash table. The table has room for N elements at a load
+	of at most 7/8, and never allocates. Erasing may move other elements,
+	which invalidates iterators and references to them.
+*/
+template<typename K, typename V, size_t N = 0, class Hash = hash<K>, class KeyEqual = equal_to<K> >
+class unordered_map;
+
+/** Common zero-size base class for all unordered maps. */
+template<typename K, typename V, class Hash, class KeyEqual>
+class unordered_map<K, V, 0, Hash, KeyEqual> {
+	typedef unordered_map<K, V, 8, Hash, KeyEqual>               child;
+	typedef detail::hash_table<detail::hash_map_traits<K, V, Hash, KeyEqual> > table_type;
+
+  public:
+	typedef K                                             key_type;
+	typedef V                                             mapped_type;
+	typedef pair<const K, V>                              value_type;
+	typedef size_t                                        size_type;
+	typedef ptrdiff_t                                     difference_type;
+	typedef Hash                                          hasher;
+	typedef KeyEqual                                      key_equal;
+	typedef value_type&                                   reference;
+	typedef const value_type&                             const_reference;
+	typedef value_type*                                   pointer;
+	typedef const value_type*                             const_pointer;
+	typedef detail::hash_iterator<value_type>             iterator;
+	typedef detail::hash_iterator<const value_type>       const_iterator;
+
+	/** Copy assignment operator. */
+	unordered_map& operator=(const unordered_map& rhs) {
+		if (this != &rhs) {
+			clear();
+			insert(rhs.begin(), rhs.end());
+		}
+
+		return *this;
+	}
+#if __cplusplus >= 201103
+	/** Move assignment operator, leaves rhs empty. */
+	unordered_map& operator=(unordered_map&& rhs) {
+		if (this != &rhs) {
+			clear();
+
+			for (iterator it = rhs.begin(); it != rhs.end(); ++it) {
+				try_emplace(it->first, sstl::move(it->second));
+			}
+
+			rhs.clear();
+		}
+
+		return *this;
+	}
+#endif
+
+	/**
+		Returns a reference to the value mapped to key, inserting a
+		value-initialized one if the key is missing. If the key is missing
+		and the map is at its limit, nothing is inserted: debug builds assert, see
+		SSTL_ASSERT_FULL_SUBSCRIPT, and otherwise the reference is to a
+		value-initialized stand-in shared with other maps, so writes through
+		it are discarded. Use insert or try_emplace where the map can fill up.
+	*/
+	mapped_type& operator[](const key_type& key) {
+		const pair<size_type, bool> slot = table().claim(key);
+
+		if (slot.first == bucket_count()) { return detail::full_map_subscript<mapped_type>(); }
+
+		if (slot.second) {
+			new(static_cast<void*>(table().slots() + slot.first)) value_type(key, mapped_type());
+		}
+
+		return table().slots()[slot.first].second;
+	}
+
+	/** Returns an iterator to the first element of the container. */
+	iterator begin() { return iterator_at(table().next_full(0)); }
+	const_iterator begin() const { return iterator_at(table().next_full(0)); }
+	const_iterator cbegin() const { return begin(); }
+
+	/** Returns an iterator to the element following the last element of the container. */
+	iterator end() { return iterator_at(bucket_count()); }
+	const_iterator end() const { return iterator_at(bucket_count()); }
+	const_iterator cend() const { return end(); }
+
+	/** Checks whether the container has no elements. */
+	bool empty() const { return size() == 0; }
+	/** Returns the number of elements in the container. */
+	size_type size() const { return table().size(); }
+	/** Returns the maximum possible number of elements. */
+	size_type max_size() const { return table().max_size(); }
+
+	/** Returns the number of slots in the table. */
+	size_type bucket_count() const { return table().bucket_count(); }
+	/** Returns the average number of elements per slot. */
+	float load_factor() const { return float(size()) / float(bucket_count()); }
+	/** Returns the load factor at which inserting new keys fails. */
+	float max_load_factor() const { return float(table().limit()) / float(bucket_count()); }
+	/**
+		Sets the load factor at which inserting new keys fails, trading
+		capacity for shorter probes. It is capped at max_size() elements,
+		values above 1 count as 1, and values which are not positive and
+		finite are ignored.
+	*/
+	void max_load_factor(float ml) { table().max_load_factor(ml); }
+
+	/** Removes all elements from the container. */
+	void clear() { table().clear(); }
+
+	/**
+		Inserts value unless an element with the same key exists. Returns the
+		position of the element with that key and whether value was inserted,
+		or end() and false if the key is missing and the map is at its limit.
+	*/
+	pair<iterator, bool> insert(const value_type& value) {
+		const pair<size_type, bool> slot = table().claim(value.first);
+
+		if (slot.second) { new(static_cast<void*>(table().slots() + slot.first)) value_type(value); }
+
+		return pair<iterator, bool>(iterator_at(slot.first), slot.second);
+	}
+	/** Inserts the elements in the range [first, last) whose keys are not present yet. */
+	template<class InputIt>
+	void insert(InputIt first, InputIt last) {
+		for (; first != last; ++first) { insert(value_type((*first).first, (*first).second)); }
+	}
+
+	/** Inserts obj under key, or assigns it to the element with that key if there already is one. */
+	pair<iterator, bool> insert_or_assign(const key_type& key, const mapped_type& obj) {
+		const pair<size_type, bool> slot = table().claim(key);
+
+		if (slot.second) {
+			new(static_cast<void*>(table().slots() + slot.first)) value_type(key, obj);
+		} else if (slot.first != bucket_count()) {
+			table().slots()[slot.first].second = obj;
+		}
+
+		return pair<iterator, bool>(iterator_at(slot.first), slot.second);
+	}
+
+#if __cplusplus >= 201103
+	/** Inserts a value constructed in-place from args under key, unless an element with that key exists. */
+	template<class... Args>
+	pair<iterator, bool> try_emplace(const key_type& key, Args&&... args) {
+		const pair<size_type, bool> slot = table().claim(key);
+
+		if (slot.second) {
+			new(static_cast<void*>(table().slots() + slot.first))
+			value_type(key, mapped_type(sstl::forward<Args>(args)...));
+		}
+
+		return pair<iterator, bool>(iterator_at(slot.first), slot.second);
+	}
+#endif
+
+	/**
+		Removes the element at pos, returns an iterator to the next element.
+		Erasing while iterating can visit an element twice when the table
+		moves it back across its end.
+	*/
+	iterator erase(const_iterator pos) {
+		const size_type i = pos.index();
+		table().erase(i);
+		return iterator_at(table().next_full(i));
+	}
+	/** Removes the element with the given key, returns the number of elements removed. */
+	size_type erase(const key_type& key) {
+		const size_type i = table().find(key);
+
+		if (i == bucket_count()) { return 0; }
+
+		table().erase(i);
+		return 1;
+	}
+
+	/** Returns the number of elements with the given key, which is either 0 or 1. */
+	size_type count(const key_type& key) const { return contains(key) ? 1 : 0; }
+	/** Checks whether there is an element with the given key. */
+	bool contains(const key_type& key) const { return table().find(key) != bucket_count(); }
+
+	/** Finds the element with the given key, returns end() if there is none. */
+	iterator find(const key_type& key) { return iterator_at(table().find(key)); }
+	const_iterator find(const key_type& key) const { return iterator_at(table().find(key)); }
+
+	/** Returns the function that hashes the keys. */
+	hasher hash_function() const { return hasher(); }
+	/** Returns the function that compares keys for equality. */
+	key_equal key_eq() const { return key_equal(); }
+
+  protected:
+	SSTL_CONSTEXPR unordered_map() {}
+	~unordered_map() {}
+
+  private:
+	table_type& table() { return static_cast<child*>(this)->table_; }
+	const table_type& table() const { return static_cast<const child*>(this)->table_; }
+
+	iterator iterator_at(size_type pos) {
+		return iterator(table().control(), table().slots(), pos, bucket_count());
+	}
+	const_iterator iterator_at(size_type pos) const {
+		return const_iterator(table().control(), table().slots(), pos, bucket_count());
+	}
+};
+
+/** Child class with size-specific storage for the underlying hash table. */
+template<typename K, typename V, size_t N, class Hash, class KeyEqual>
+class unordered_map : public unordered_map<K, V, 0, Hash, KeyEqual> {
+	friend class unordered_map<K, V, 0, Hash, KeyEqual>;
+	typedef unordered_map<K, V, 0, Hash, KeyEqual> base;
+
+  public:
+	typedef typename base::key_type        key_type;
+	typedef typename base::mapped_type     mapped_type;
+	typedef typename base::value_type      value_type;
+	typedef typename base::size_type       size_type;
+	typedef typename base::difference_type difference_type;
+	typedef typename base::hasher          hasher;
+	typedef typename base::key_equal       key_equal;
+	typedef typename base::reference       reference;
+	typedef typename base::const_reference const_reference;
+	typedef typename base::pointer         pointer;
+	typedef typename base::const_pointer   const_pointer;
+	typedef typename base::iterator        iterator;
+	typedef typename base::const_iterator  const_iterator;
+
+	/** Default constructor, a constant initializer for maps with static storage. */
+	SSTL_CONSTEXPR unordered_map() : base(), table_(N) {}
+	/** Copy constructor. */
+	unordered_map(const unordered_map& other) : base(), table_(N) {
+		base::insert(other.begin(), other.end());
+	}
+	/** Copy adapter constructor, keeps as many elements as fit. */
+	unordered_map(const base& other) : base(), table_(N) {
+		base::insert(other.begin(), other.end());
+	}
+#if __cplusplus >= 201103
+	/** Move constructor, leaves other empty. */
+	unordered_map(unordered_map&& other) : base(), table_(N) {
+		base::operator=(static_cast<base&&>(other));
+	}
+#endif
+	/** Constructs the map with the elements in the range [first, last), keeping the first element for each key. */
+	template<class InputIt>
+	unordered_map(InputIt first, InputIt last) : base(), table_(N) {
+		base::insert(first, last);
+	}
+
+	/** Returns the maximum possible number of elements. */
+	SSTL_CONSTEXPR14 size_type max_size() const { return N; }
+
+	/** Copy assignment operator. */
+	unordered_map& operator=(const unordered_map& rhs) {
+		base::operator=(rhs);
+		return *this;
+	}
+	/** Copy assignment operator for compatible unordered map. */
+	unordered_map& operator=(const base& rhs) {
+		base::operator=(rhs);
+		return *this;
+	}
+#if __cplusplus >= 201103
+	/** Move assignment operator, leaves rhs empty. */
+	unordered_map& operator=(unordered_map&& rhs) {
+		base::operator=(static_cast<base&&>(rhs));
+		return *this;
+	}
+#endif
+
+  private:
+	typedef detail::hash_map_traits<K, V, Hash, KeyEqual> traits;
+
+	detail::hash_table<traits, detail::hash_slot_count<N>::value> table_;
+};
+
+} /* namespace sstl */
+
+#endif /* STATIC_STL_UNORDERED_MAP_H_ */
@@ -0,0 +1,260 @@
+#ifndef STATIC_STL_UNORDERED_SET_H_
+#define STATIC_STL_UNORDERED_SET_H_
+
+#include <new>
+
+#include "functional.h"
+#include "hash_table.h"
+#include "type_traits.h"
+#include "utility.h"
+
+namespace sstl {
+
+namespace detail {
+/** Hash table traits for unordered_set, whose slots are the keys themselves. */
+template<typename K, class Hash, class KeyEqual>
+struct hash_set_traits {
+	typedef K        key_type;
+	typedef K        slot_type;
+	typedef Hash     hasher;
+	typedef KeyEqual key_equal;
+
+	static const K& key(const slot_type& slot) { return slot; }
+};
+} /* namespace detail */
+
+/**
+	Associative container with unique keys and fixed capacity, stored in an
+	open addressing hash table. The table has room for N keys at a load of
+	at most 7/8, and never allocates. Erasing may move other keys, which
+	invalidates iterators and references to them.
+*/
+template<typename K, size_t N = 0, class Hash = hash<K>, class KeyEqual = equal_to<K> >
+class unordered_set;
+
+/** Common zero-size base class for all unordered sets. */
+template<typename K, class Hash, class KeyEqual>
+class unordered_set<K, 0, Hash, KeyEqual> {
+	typedef unordered_set<K, 8, Hash, KeyEqual>                       child;
+	typedef detail::hash_table<detail::hash_set_traits<K, Hash, KeyEqual> > table_type;
+
+  public:
+	typedef K                                 key_type;
+	typedef K                                 value_type;
+	typedef size_t                            size_type;
+	typedef ptrdiff_t                         difference_type;
+	typedef Hash                              hasher;
+	typedef KeyEqual                          key_equal;
+	typedef const value_type&                 reference;
+	typedef const value_type&                 const_reference;
+	typedef const value_type*                 pointer;
+	typedef const value_type*                 const_pointer;
+	typedef detail::hash_iterator<const K>    iterator;
+	typedef detail::hash_iterator<const K>    const_iterator;
+
+	/** Copy assignment operator. */
+	unordered_set& operator=(const unordered_set& rhs) {
+		if (this != &rhs) {
+			clear();
+			insert(rhs.begin(), rhs.end());
+		}
+
+		return *this;
+	}
+#if __cplusplus >= 201103
+	/** Move assignment operator, leaves rhs empty. */
+	unordered_set& operator=(unordered_set&& rhs) {
+		if (this != &rhs) {
+			clear();
+
+			for (size_type i = rhs.table().next_full(0); i < rhs.bucket_count();
+			     i = rhs.table().next_full(i + 1)) {
+				insert(sstl::move(rhs.table().slots()[i]));
+			}
+
+			rhs.clear();
+		}
+
+		return *this;
+	}
+#endif
+
+	/** Returns an iterator to the first element of the container. */
+	const_iterator begin() const { return iterator_at(table().next_full(0)); }
+	const_iterator cbegin() const { return begin(); }
+
+	/** Returns an iterator to the element following the last element of the container. */
+	const_iterator end() const { return iterator_at(bucket_count()); }
+	const_iterator cend() const { return end(); }
+
+	/** Checks whether the container has no elements. */
+	bool empty() const { return size() == 0; }
+	/** Returns the number of elements in the container. */
+	size_type size() const { return table().size(); }
+	/** Returns the maximum possible number of elements. */
+	size_type max_size() const { return table().max_size(); }
+
+	/** Returns the number of slots in the table. */
+	size_type bucket_count() const { return table().bucket_count(); }
+	/** Returns the average number of elements per slot. */
+	float load_factor() const { return float(size()) / float(bucket_count()); }
+	/** Returns the load factor at which inserting new keys fails. */
+	float max_load_factor() const { return float(table().limit()) / float(bucket_count()); }
+	/**
+		Sets the load factor at which inserting new keys fails, trading
+		capacity for shorter probes. It is capped at max_size() keys,
+		values above 1 count as 1, and values which are not positive and
+		finite are ignored.
+	*/
+	void max_load_factor(float ml) { table().max_load_factor(ml); }
+
+	/** Removes all elements from the container. */
+	void clear() { table().clear(); }
+
+	/**
+		Inserts value unless an equal key exists. Returns the position of the
+		element equal to value and whether value was inserted, or end() and
+		false if value is missing and the set is at its limit.
+	*/
+	pair<iterator, bool> insert(const value_type& value) {
+		const pair<size_type, bool> slot = table().claim(value);
+
+		if (slot.second) { new(static_cast<void*>(table().slots() + slot.first)) value_type(value); }
+
+		return pair<iterator, bool>(iterator_at(slot.first), slot.second);
+	}
+#if __cplusplus >= 201103
+	pair<iterator, bool> insert(value_type&& value) {
+		const pair<size_type, bool> slot = table().claim(value);
+
+		if (slot.second) {
+			new(static_cast<void*>(table().slots() + slot.first)) value_type(sstl::move(value));
+		}
+
+		return pair<iterator, bool>(iterator_at(slot.first), slot.second);
+	}
+#endif
+	/** Inserts the keys in the range [first, last) which are not present yet. */
+	template<class InputIt>
+	void insert(InputIt first, InputIt last) {
+		for (; first != last; ++first) { insert(*first); }
+	}
+
+	/**
+		Removes the element at pos, returns an iterator to the next element.
+		Erasing while iterating can visit an element twice when the table
+		moves it back across its end.
+	*/
+	iterator erase(const_iterator pos) {
+		const size_type i = pos.index();
+		table().erase(i);
+		return iterator_at(table().next_full(i));
+	}
+	/** Removes the element equal to key, returns the number of elements removed. */
+	size_type erase(const key_type& key) {
+		const size_type i = table().find(key);
+
+		if (i == bucket_count()) { return 0; }
+
+		table().erase(i);
+		return 1;
+	}
+
+	/** Returns the number of elements equal to key, which is either 0 or 1. */
+	size_type count(const key_type& key) const { return contains(key) ? 1 : 0; }
+	/** Checks whether there is an element equal to key. */
+	bool contains(const key_type& key) const { return table().find(key) != bucket_count(); }
+
+	/** Finds the element equal to key, returns end() if there is none. */
+	const_iterator find(const key_type& key) const { return iterator_at(table().find(key)); }
+
+	/** Returns the function that hashes the keys. */
+	hasher hash_function() const { return hasher(); }
+	/** Returns the function that compares keys for equality. */
+	key_equal key_eq() const { return key_equal(); }
+
+  protected:
+	SSTL_CONSTEXPR unordered_set() {}
+	~unordered_set() {}
+
+  private:
+	table_type& table() { return static_cast<child*>(this)->table_; }
+	const table_type& table() const { return static_cast<const child*>(this)->table_; }
+
+	const_iterator iterator_at(size_type pos) const {
+		return const_iterator(table().control(), table().slots(), pos, bucket_count());
+	}
+};
+
+/** Child class with size-specific storage for the underlying hash table. */
+template<typename K, size_t N, class Hash, class KeyEqual>
+class unordered_set : public unordered_set<K, 0, Hash, KeyEqual> {
+	friend class unordered_set<K, 0, Hash, KeyEqual>;
+	typedef unordered_set<K, 0, Hash, KeyEqual> base;
+
+  public:
+	typedef typename base::key_type        key_type;
+	typedef typename base::value_type      value_type;
+	typedef typename base::size_type       size_type;
+	typedef typename base::difference_type difference_type;
+	typedef typename base::hasher          hasher;
+	typedef typename base::key_equal       key_equal;
+	typedef typename base::reference       reference;
+	typedef typename base::const_reference const_reference;
+	typedef typename base::pointer         pointer;
+	typedef typename base::const_pointer   const_pointer;
+	typedef typename base::iterator        iterator;
+	typedef typename base::const_iterator  const_iterator;
+
+	/** Default constructor, a constant initializer for sets with static storage. */
+	SSTL_CONSTEXPR unordered_set() : base(), table_(N) {}
+	/** Copy constructor. */
+	unordered_set(const unordered_set& other) : base(), table_(N) {
+		base::insert(other.begin(), other.end());
+	}
+	/** Copy adapter constructor, keeps as many keys as fit. */
+	unordered_set(const base& other) : base(), table_(N) {
+		base::insert(other.begin(), other.end());
+	}
+#if __cplusplus >= 201103
+	/** Move constructor, leaves other empty. */
+	unordered_set(unordered_set&& other) : base(), table_(N) {
+		base::operator=(static_cast<base&&>(other));
+	}
+#endif
+	/** Constructs the set with the keys in the range [first, last). */
+	template<class InputIt>
+	unordered_set(InputIt first, InputIt last) : base(), table_(N) {
+		base::insert(first, last);
+	}
+
+	/** Returns the maximum possible number of elements. */
+	SSTL_CONSTEXPR14 size_type max_size() const { return N; }
+
+	/** Copy assignment operator. */
+	unordered_set& operator=(const unordered_set& rhs) {
+		base::operator=(rhs);
+		return *this;
+	}
+	/** Copy assignment operator for compatible unordered set. */
+	unordered_set& operator=(const base& rhs) {
+		base::operator=(rhs);
+		return *this;
+	}
+#if __cplusplus >= 201103
+	/** Move assignment operator, leaves rhs empty. */
+	unordered_set& operator=(unordered_set&& rhs) {
+		base::operator=(static_cast<base&&>(rhs));
+		return *this;
+	}
+#endif
+
+  private:
+	typedef detail::hash_set_traits<K, Hash, KeyEqual> traits;
+
+	detail::hash_table<traits, detail::hash_slot_count<N>::value> table_;
+};
+
+} /* namespace sstl */
+
+#endif /* STATIC_STL_UNORDERED_SET_H_ */
@@ -1,8 +1,89 @@
 #ifndef STATIC_STL_UTILITY_H_
 #define STATIC_STL_UTILITY_H_
 
+#include "type_traits.h"
+
 namespace sstl {
 
+#if __cplusplus >= 201103
+/** Indicates that t may be "moved from", by producing an xvalue expression that identifies its argument. */
+template<typename T>
+SSTL_CONSTEXPR inline typename remove_reference<T>::type&& move(T&& t) {
+	return static_cast<typename remove_reference<T>::type&&>(t);
+}
+
+/** Forwards lvalues as either lvalues or as rvalues, depending on T. */
+template<typename T>
+SSTL_CONSTEXPR inline T&& forward(typename remove_reference<T>::type& t) {
+	return static_cast<T&&>(t);
+}
+template<typename T>
+SSTL_CONSTEXPR inline T&& forward(typename remove_reference<T>::type&& t) {
+	return static_cast<T&&>(t);
+}
+#else
+/** Without rvalue references, moving an object is the same as copying it. */
+template<typename T>
+SSTL_CONSTEXPR inline T& move(T& t) {
+	return t;
+}
+#endif
+
+/** Tag type selecting default-initialization, which leaves trivial elements uninitialized. */
+struct default_init_t {};
+
+/** Tag value for constructors taking a default_init_t. */
+const default_init_t default_init = default_init_t();
+
+namespace detail {
+/** Parameter type for passing a T, which avoids forming a reference to a reference before C++11. */
+template<typename T>
+struct param_type { typedef const T& type; };
+
+template<typename T>
+struct param_type<T&> { typedef T& type; };
+} /* namespace detail */
+
+/** Stores two heterogeneous objects as a single unit. */
+template<typename T1, typename T2>
+struct pair {
+	typedef T1 first_type;
+	typedef T2 second_type;
+
+	/** Default constructor, value-initializes both elements. */
+	SSTL_CONSTEXPR pair() : first(), second() {}
+	/** Initializes first with a and second with b. */
+	SSTL_CONSTEXPR pair(typename detail::param_type<T1>::type a,
+	                    typename detail::param_type<T2>::type b) : first(a), second(b) {}
+	/** Converts from a pair of compatible types. */
+	template<typename U1, typename U2>
+	SSTL_CONSTEXPR pair(const pair<U1, U2>& other) : first(other.first), second(other.second) {}
+
+	T1 first;
+	T2 second;
+};
+
+/** Creates a pair, deducing the element types from the arguments. */
+template<typename T1, typename T2>
+SSTL_CONSTEXPR inline pair<T1, T2> make_pair(const T1& a, const T2& b) {
+	return pair<T1, T2>(a, b);
+}
+
+template<typename T1, typename T2, typename U1, typename U2>
+SSTL_CONSTEXPR inline bool operator==(const pair<T1, T2>& lhs, const pair<U1, U2>& rhs) {
+	return lhs.first == rhs.first && lhs.second == rhs.second;
+}
+
+template<typename T1, typename T2, typename U1, typename U2>
+SSTL_CONSTEXPR inline bool operator!=(const pair<T1, T2>& lhs, const pair<U1, U2>& rhs) {
+	return !(lhs == rhs);
+}
+
+template<typename T1, typename T2, typename U1, typename U2>
+SSTL_CONSTEXPR inline bool operator<(const pair<T1, T2>& lhs, const pair<U1, U2>& rhs) {
+	return lhs.first < rhs.first || (!(rhs.first < lhs.first) && lhs.second < rhs.second);
+}
+
 namespace rel_ops {
 
 /** Implements operator!= in terms of operator==. */
@@ -2,6 +2,7 @@
 #define STATIC_STL_VECTOR_H_
 
 #include "array.h"
+#include "instrument.h"
 #include "memory.h"
 #include "type_traits.h"
 
@@ -40,6 +41,29 @@ class vector<T> {
 		assign(rhs.begin(), rhs.end());
 		return *this;
 	}
+#if __cplusplus >= 201103
+	/** Move assignment operator, leaves rhs empty. */
+	vector& operator=(vector&& rhs) {
+		if (this != &rhs) {
+			const size_type requested = rhs.size();
+			const size_type count = sstl::min(requested, max_size());
+
+			if (count <= size()) {
+				sstl::move(rhs.begin(), rhs.begin() + count, begin());
+				resize(count);
+			} else {
+				sstl::move(rhs.begin(), rhs.begin() + size(), begin());
+				sstl::uninitialized_move(rhs.begin() + size(), rhs.begin() + count, end());
+				static_cast<child*>(this)->size_ = count;
+			}
+
+			record(requested - count, 0);
+			rhs.clear();
+		}
+
+		return *this;
+	}
+#endif
 
 	/** Random access operator. */
 	reference operator[](size_type pos) { return begin()[pos]; }
@@ -48,7 +72,7 @@ class vector<T> {
 	/** Replaces the contents with count copies of value val. */
 	void assign(size_type count, const_reference val) {
 		resize(count);
-		fill_n(begin(), size(), val);
+		sstl::fill_n(begin(), size(), val);
 	}
 	/** Replaces the contents with copies of those in the range [first, last]. */
 	template<class InputIt>
@@ -70,16 +94,16 @@ class vector<T> {
 	const_reference back() const { return end()[-1]; }
 
 	/** Returns pointer to the underlying array serving as element storage. */
-	pointer data() { return pointer(static_cast<child*>(this)->data_.data()); }
+	pointer data() {
+		return reinterpret_cast<pointer>(static_cast<child*>(this)->storage_.data_);
+	}
 	const_pointer data() const {
-		return const_pointer(static_cast<const child*>(this)->data_.data());
+		return reinterpret_cast<const_pointer>(static_cast<const child*>(this)->storage_.data_);
 	}
 
 	/** Returns an iterator to the first element of the container. */
-	iterator begin() { return iterator(static_cast<child*>(this)->data_.begin()); }
-	const_iterator begin() const {
-		return const_iterator(static_cast<const child*>(this)->data_.begin());
-	}
+	iterator begin() { return iterator(data()); }
+	const_iterator begin() const { return const_iterator(data()); }
 	const_iterator cbegin() const { return begin(); }
 
 	/** Returns an iterator to the element following the last element of the container. */
@@ -103,7 +127,7 @@ class vector<T> {
 	size_type size() const { return static_cast<const child*>(this)->size_; }
 	/** Returns the maximum possible number of elements. */
 	size_type max_size() const {
-		return static_cast<const child*>(this)->data_.size();
+		return static_cast<const child*>(this)->capacity_;
 	}
 	/** Returns the number of elements that the container has currently allocated space for. */
 	size_type capacity() const { return max_size(); }
@@ -113,24 +137,41 @@ class vector<T> {
 
 	/** Inserts val before pos. */
 	iterator insert(const_iterator pos, const_reference val) {
-		if (size() < max_size()) {
-			resize(size() + 1);
-			const difference_type d = distance(cbegin(), pos);
-			rotate(rbegin(), rbegin() + 1, reverse_iterator(begin() + d));
-			*iterator(pos) = val;
+		const size_type inserted = size() < max_size() ? 1 : 0;
+
+		if (inserted) {
+			const value_type tmp(val);
+			open_gap(iterator(pos), 1);
+			*iterator(pos) = tmp;
+		}
+
+		record_insert(pos, 1, inserted);
+		return iterator(pos);
+	}
+#if __cplusplus >= 201103
+	iterator insert(const_iterator pos, value_type&& val) {
+		const size_type inserted = size() < max_size() ? 1 : 0;
+
+		if (inserted) {
+			value_type tmp(sstl::move(val));
+			open_gap(iterator(pos), 1);
+			*iterator(pos) = sstl::move(tmp);
 		}
 
+		record_insert(pos, 1, inserted);
 		return iterator(pos);
 	}
+#endif
 	iterator insert(const_iterator pos, size_type count, const_reference val) {
-		if (size() < max_size()) {
-			count = min(count, max_size() - size());
-			resize(size() + count);
-			const difference_type d = distance(cbegin(), pos);
-			rotate(rbegin(), rbegin() + count, reverse_iterator(begin() + d));
-			fill_n(iterator(pos), count, val);
+		const size_type inserted = sstl::min(count, max_size() - size());
+
+		if (inserted) {
+			const value_type tmp(val);
+			open_gap(iterator(pos), inserted);
+			sstl::fill_n(iterator(pos), inserted, tmp);
 		}
 
+		record_insert(pos, count, inserted);
 		return iterator(pos);
 	}
 	template<class InputIt>
@@ -141,65 +182,157 @@ class vector<T> {
 
 	/** Removes specified elements from the container. */
 	iterator erase(const_iterator pos) {
-		iterator it = iterator(pos);
-		rotate(it, it + 1, end());
-		resize(size() - 1);
-		return it;
+		return erase(pos, sstl::next(pos));
 	}
 	iterator erase(const_iterator first, const_iterator last) {
+		if (first == last) { return iterator(first); }
+
+		const size_type moved = size_type(cend() - last);
 		iterator start = iterator(first);
-		iterator finish = iterator(last);
-		rotate(start, finish, end());
-		resize(size() - distance(start, finish));
+		truncate(size_type(sstl::move(iterator(last), end(), start) - begin()));
+		record(0, moved);
 		return start;
 	}
 
+#if __cplusplus >= 201103
+	/** Inserts an element constructed in-place from args before pos. */
+	template<class... Args>
+	iterator emplace(const_iterator pos, Args&&... args) {
+		const size_type inserted = size() < max_size() ? 1 : 0;
+
+		if (inserted) {
+			value_type tmp(sstl::forward<Args>(args)...);
+			open_gap(iterator(pos), 1);
+			*iterator(pos) = sstl::move(tmp);
+		}
+
+		record_insert(pos, 1, inserted);
+		return iterator(pos);
+	}
+#endif
+
 	/** Appends the given element value to the end of the container. */
 	void push_back(const T& value) {
-		if (size() < max_size()) {
-			uninitialized_fill_n(end(), 1, value);
+		const bool room = size() < max_size();
+
+		if (room) {
+			sstl::uninitialized_fill_n(end(), 1, value);
 			++static_cast<child*>(this)->size_;
 		}
+
+		record(room ? 0 : 1, 0);
 	}
+#if __cplusplus >= 201103
+	void push_back(T&& value) {
+		const bool room = size() < max_size();
+
+		if (room) {
+			new(static_cast<void*>(end())) value_type(sstl::move(value));
+			++static_cast<child*>(this)->size_;
+		}
+
+		record(room ? 0 : 1, 0);
+	}
+
+	/** Appends an element constructed in-place from args to the end of the container. */
+	template<class... Args>
+	void emplace_back(Args&&... args) {
+		const bool room = size() < max_size();
+
+		if (room) {
+			new(static_cast<void*>(end())) value_type(sstl::forward<Args>(args)...);
+			++static_cast<child*>(this)->size_;
+		}
+
+		record(room ? 0 : 1, 0);
+	}
+#endif
 
 	/** Removes the last element of the container. */
 	void pop_back() { resize(size() - 1); }
 
 	/** Resizes the container to contain count elements. */
 	void resize(size_type count) {
+		const size_type dropped = count > max_size() ? count - max_size() : 0;
+
 		if (count <= size()) {
-			destroy(begin() + count, end());
-			static_cast<child*>(this)->size_ = count;
+			truncate(count);
 		} else {
-			count = min(count, max_size());
-			uninitialized_value_construct(end(), begin() + count);
+			count = sstl::min(count, max_size());
+			sstl::uninitialized_value_construct(end(), begin() + count);
 			static_cast<child*>(this)->size_ = count;
 		}
+
+		record(dropped, 0);
 	}
 	void resize(size_type count, const value_type& value) {
+		const size_type dropped = count > max_size() ? count - max_size() : 0;
+
 		if (count <= size()) {
-			destroy(begin() + count, end());
+			truncate(count);
+		} else {
+			count = sstl::min(count, max_size());
+			sstl::uninitialized_fill(end(), begin() + count, value);
 			static_cast<child*>(this)->size_ = count;
+		}
+
+		record(dropped, 0);
+	}
+	/** Resizes the container, default-initializing new elements so trivial ones are left uninitialized. */
+	void resize(size_type count, default_init_t) {
+		const size_type dropped = count > max_size() ? count - max_size() : 0;
+
+		if (count <= size()) {
+			truncate(count);
 		} else {
-			count = min(count, max_size());
-			uninitialized_fill(end(), begin() + count, value);
+			count = sstl::min(count, max_size());
+			sstl::uninitialized_default_construct(end(), begin() + count);
 			static_cast<child*>(this)->size_ = count;
 		}
+
+		record(dropped, 0);
 	}
 
+#if SSTL_INSTRUMENT
+	/** Returns the usage counters of this vector, see instrument.h. */
+	container_stats& stats() { return static_cast<child*>(this)->stats_; }
+	const container_stats& stats() const { return static_cast<const child*>(this)->stats_; }
+#endif
+
   protected:
-	vector() {}
+	SSTL_CONSTEXPR vector() {}
 	~vector() {}
 
+	/** Counts a modification which dropped and shifted the given numbers of elements, if instrumented. */
+	void record(size_type dropped, size_type moved) {
+#if SSTL_INSTRUMENT
+		stats().record("vector", max_size(), size(), dropped, moved);
+#else
+		(void)dropped;
+		(void)moved;
+#endif
+	}
+
   private:
+	/** Counts an insertion of count elements before pos, of which the first inserted fit. */
+	void record_insert(const_iterator pos, size_type count, size_type inserted) {
+		record(count - inserted, inserted ? size_type(cend() - pos) - inserted : 0);
+	}
+
+	/** Destroys the elements from count on. */
+	void truncate(size_type count) {
+		sstl::destroy(begin() + count, end());
+		static_cast<child*>(this)->size_ = count;
+	}
+
 	template<class Int>
 	void assign_range_dispatch(Int count, Int val, true_type) {
 		assign(size_type(count), const_reference(val));
 	}
 	template<class InputIt>
 	void assign_range_dispatch(InputIt first, InputIt last, false_type) {
-		resize(distance(first, last));
-		copy_n(first, size(), begin());
+		resize(sstl::distance(first, last));
+		sstl::copy_n(first, size(), begin());
 	}
 
 	template<class InputIt>
@@ -210,17 +343,42 @@ class vector<T> {
 	template<class InputIt>
 	iterator insert_range_dispatch(const_iterator pos, InputIt first, InputIt last,
 	                               false_type) {
-		if (size() < max_size()) {
-			difference_type count = min(distance(first, last),
-			                            difference_type(max_size() - size()));
-			resize(size() + count);
-			const difference_type d = distance(cbegin(), pos);
-			rotate(rbegin(), rbegin() + count, reverse_iterator(begin() + d));
-			copy_n(first, count, iterator(pos));
+		const difference_type requested = sstl::distance(first, last);
+		const difference_type count = sstl::min(requested, difference_type(max_size() - size()));
+
+		if (count) {
+			open_gap(iterator(pos), size_type(count));
+			sstl::copy_n(first, count, iterator(pos));
 		}
 
+		record_insert(pos, size_type(requested), size_type(count));
 		return iterator(pos);
 	}
+
+	/**
+		Shifts [pos, end()) right by count slots in a single pass and grows the
+		size to match. The count slots starting at pos are left holding live
+		elements, ready to be assigned over.
+	*/
+	void open_gap(iterator pos, size_type count) {
+		typedef typename detail::is_memmovable<iterator, iterator>::type block;
+		open_gap_dispatch(pos, count, block());
+		static_cast<child*>(this)->size_ += count;
+	}
+	void open_gap_dispatch(iterator pos, size_type count, true_type) {
+		sstl::copy_backward(pos, end(), end() + count);
+	}
+	void open_gap_dispatch(iterator pos, size_type count, false_type) {
+		const iterator old_end = end();
+
+		if (count < size_type(old_end - pos)) {
+			sstl::uninitialized_move(old_end - count, old_end, old_end);
+			sstl::move_backward(pos, old_end - count, old_end);
+		} else {
+			sstl::uninitialized_move(pos, old_end, pos + count);
+			sstl::uninitialized_value_construct(old_end, pos + count);
+		}
+	}
 };
 
 /** Child class with size-specific storage for the underlying array. */
@@ -242,33 +400,56 @@ class vector : public vector<T> {
 	typedef typename base::reverse_iterator       reverse_iterator;
 	typedef typename base::const_reverse_iterator const_reverse_iterator;
 
-	/** Default constructor. */
-	vector() : size_(0) {}
+	/** Default constructor, a constant initializer for vectors with static storage. */
+	SSTL_CONSTEXPR vector() : base(), capacity_(N), size_(0), storage_() {}
 	/** Copy constructor. */
-	vector(const vector& other) : size_(other.size()) {
-		uninitialized_copy_n(other.begin(), size_, base::begin());
+	vector(const vector& other) : capacity_(N), size_(other.size()) {
+		sstl::uninitialized_copy_n(other.begin(), size_, base::begin());
 	}
 	/** Copy adapter constructor. */
 	template<typename T2>
-	vector(const vector<T2>& other) : size_(min(other.size(), N)) {
-		uninitialized_copy_n(other.begin(), size_, base::begin());
+	vector(const vector<T2>& other)
+		: capacity_(N), size_(sstl::min(other.size(), N)) {
+		sstl::uninitialized_copy_n(other.begin(), size_, base::begin());
+		base::record(other.size() - size_, 0);
+	}
+#if __cplusplus >= 201103
+	/** Move constructor, leaves other empty. */
+	vector(vector&& other) : capacity_(N), size_(other.size()) {
+		sstl::uninitialized_move_n(other.begin(), size_, base::begin());
+		other.clear();
 	}
+#endif
 	/** Constructs the vector with count default initialized elements. */
-	explicit vector(size_type count) : size_(min(count, N)) {
-		uninitialized_value_construct_n(base::begin(), size_);
+	explicit vector(size_type count) : capacity_(N), size_(sstl::min(count, N)) {
+		sstl::uninitialized_value_construct_n(base::begin(), size_);
+		base::record(count - size_, 0);
+	}
+	/** Constructs the vector with count default-initialized elements, trivial ones are left uninitialized. */
+	vector(size_type count, default_init_t)
+		: capacity_(N), size_(sstl::min(count, N)) {
+		sstl::uninitialized_default_construct_n(base::begin(), size_);
+		base::record(count - size_, 0);
 	}
 	/** Constructs the vector with count elements having value val. */
-	vector(size_type count, const_reference val) : size_(min(count, N)) {
-		uninitialized_fill_n(base::begin(), size_, val);
+	vector(size_type count, const_reference val)
+		: capacity_(N), size_(sstl::min(count, N)) {
+		sstl::uninitialized_fill_n(base::begin(), size_, val);
+		base::record(count - size_, 0);
 	}
 	/** Constructs the vector with values from range [first, last]. */
 	template<class InputIt>
-	vector(InputIt first, InputIt last) {
+	vector(InputIt first, InputIt last) : capacity_(N) {
 		typedef typename is_integral<InputIt>::type integral;
 		construct_range_dispatch(first, last, integral());
 	}
 
-	~vector() { destroy(base::begin(), base::end()); }
+	~vector() { sstl::destroy(base::begin(), base::end()); }
+
+	/** Returns the maximum possible number of elements. */
+	SSTL_CONSTEXPR14 size_type max_size() const { return N; }
+	/** Returns the number of elements that the container has currently allocated space for. */
+	SSTL_CONSTEXPR14 size_type capacity() const { return N; }
 
 	/** Copy assignment operator. */
 	vector& operator=(const vector& rhs) {
@@ -281,6 +462,13 @@ class vector : public vector<T> {
 		base::assign(rhs.begin(), rhs.end());
 		return *this;
 	}
+#if __cplusplus >= 201103
+	/** Move assignment operator, leaves rhs empty. */
+	vector& operator=(vector&& rhs) {
+		base::operator=(static_cast<base&&>(rhs));
+		return *this;
+	}
+#endif
 
   private:
 	typedef typename
@@ -288,23 +476,45 @@ class vector : public vector<T> {
 
 	template<class Int>
 	void construct_range_dispatch(Int count, Int val, true_type) {
-		size_ = min(size_type(count), N);
-		uninitialized_fill_n(base::begin(), size_, value_type(val));
+		size_ = sstl::min(size_type(count), N);
+		sstl::uninitialized_fill_n(base::begin(), size_, value_type(val));
+		base::record(size_type(count) - size_, 0);
 	}
 	template<class InputIt>
 	void construct_range_dispatch(InputIt first, InputIt last, false_type) {
-		size_ = min(size_type(distance(first, last)), N);
-		uninitialized_copy_n(first, size_, base::begin());
+		const size_type count = size_type(sstl::distance(first, last));
+		size_ = sstl::min(count, N);
+		sstl::uninitialized_copy_n(first, size_, base::begin());
+		base::record(count - size_, 0);
 	}
 
-	size_type size_;
-	array<element, N> data_;
+	typedef typename detail::check_capacity<N>::type capacity_fits;
+
+	detail::stored_size_type capacity_;
+	detail::stored_size_type size_;
+#if SSTL_INSTRUMENT
+	/** Usage counters, ahead of the storage so their offset does not depend on N. */
+	container_stats stats_;
+#endif
+
+	/**
+		Element storage, wrapped so a constexpr constructor can initialize the
+		empty member instead, which leaves every byte of the elements untouched.
+	*/
+	union storage {
+		struct empty {};
+
+		SSTL_CONSTEXPR storage() : empty_() {}
+
+		empty empty_;
+		element data_[N];
+	} storage_;
 };
 
 template<typename T>
 inline bool operator==(const vector<T>& lhs, const vector<T>& rhs) {
 	return lhs.size() == rhs.size() &&
-	       equal(lhs.cbegin(), lhs.cend(), rhs.cbegin());
+	       sstl::equal(lhs.cbegin(), lhs.cend(), rhs.cbegin());
 }
 
 template<typename T>
@@ -314,7 +524,7 @@ inline bool operator!=(const vector<T>& lhs, const vector<T>& rhs) {
 
 template<typename T>
 inline bool operator<(const vector<T>& lhs, const vector<T>& rhs) {
-	return lexicographical_compare(lhs.cbegin(), lhs.cend(),
+	return sstl::lexicographical_compare(lhs.cbegin(), lhs.cend(),
 	                               rhs.cbegin(), rhs.cend());
 }
 
@@ -1,8 +1,17 @@
+#include <algorithm>
+#include <limits>
+
 #include "catch/catch.hpp"
 
 #include "algorithm.h"
+#include "functional.h"
+#include "vector.h"
+
+#include "fixtures.h"
 
+namespace {
 struct Foo { int value; };
+}
 
 TEST_CASE("Swap two types with one another", "[swap]") {
 	SECTION("Using fundamental type") {
@@ -95,6 +104,33 @@ TEST_CASE("Fill array with values", "[fill]") {
 	}
 }
 
+TEST_CASE("Fill byte array with values", "[fill]") {
+	const size_t count = 5;
+	unsigned char a[count + 1] = {0};
+
+	SECTION("Fill range using iterators") {
+		sstl::fill(&a[0], &a[count], 0x1ff);
+
+		REQUIRE(a[0] == 0xff);
+		REQUIRE(a[count - 1] == 0xff);
+		REQUIRE(a[count] == 0);
+	}
+
+	SECTION("Fill range with count items") {
+		REQUIRE(sstl::fill_n(&a[0], count, 'x') == &a[count]);
+
+		REQUIRE(a[0] == 'x');
+		REQUIRE(a[count - 1] == 'x');
+		REQUIRE(a[count] == 0);
+	}
+
+	SECTION("Fill nothing with a non-positive count") {
+		REQUIRE(sstl::fill_n(&a[0], -1, 'x') == &a[0]);
+
+		REQUIRE(a[0] == 0);
+	}
+}
+
 TEST_CASE("Copy array to another", "[copy]") {
 	const size_t count = 3;
 	int a[count] = {2, 2, 2};
@@ -283,3 +319,823 @@ TEST_CASE("Rotate an array", "[rotate]") {
 		REQUIRE(start[3] == finish[3]);
 	}
 }
+
+TEST_CASE("Copy trivially copyable ranges", "[copy]") {
+	const size_t count = 5;
+	int a[count] = {0, 1, 2, 3, 4};
+
+	SECTION("Copy returns the end of the destination range") {
+		int b[count] = {0};
+
+		REQUIRE(sstl::copy(&a[0], &a[count], &b[0]) == &b[count]);
+		REQUIRE(sstl::copy_n(&a[0], count, &b[0]) == &b[count]);
+		REQUIRE(sstl::equal(&a[0], &a[count], &b[0]));
+	}
+
+	SECTION("Copy from a const range") {
+		const Foo source[2] = {{4}, {8}};
+		Foo dest[2] = {{0}, {0}};
+
+		sstl::copy(&source[0], &source[2], &dest[0]);
+
+		REQUIRE(dest[0].value == 4);
+		REQUIRE(dest[1].value == 8);
+	}
+
+	SECTION("Copy towards the front of an overlapping range") {
+		sstl::copy(&a[1], &a[count], &a[0]);
+
+		REQUIRE(a[0] == 1);
+		REQUIRE(a[1] == 2);
+		REQUIRE(a[2] == 3);
+		REQUIRE(a[3] == 4);
+		REQUIRE(a[4] == 4);
+	}
+
+	SECTION("Swap larger ranges than the swap buffer") {
+		const size_t large = 100;
+		int b[large];
+		int c[large];
+		sstl::fill_n(b, large, 1);
+		sstl::fill_n(c, large, 2);
+
+		REQUIRE(sstl::swap_ranges(&b[0], &b[large], &c[0]) == &c[large]);
+
+		REQUIRE(b[0] == 2);
+		REQUIRE(b[large - 1] == 2);
+		REQUIRE(c[0] == 1);
+		REQUIRE(c[large - 1] == 1);
+	}
+}
+
+TEST_CASE("Copy array backward", "[copy]") {
+	const size_t count = 5;
+	int a[count] = {0, 1, 2, 3, 4};
+
+	SECTION("Into a separate range") {
+		int b[count] = {0};
+
+		REQUIRE(sstl::copy_backward(&a[0], &a[count], &b[count]) == &b[0]);
+		REQUIRE(sstl::equal(&a[0], &a[count], &b[0]));
+	}
+
+	SECTION("Towards the back of an overlapping range") {
+		sstl::copy_backward(&a[0], &a[3], &a[count]);
+
+		REQUIRE(a[0] == 0);
+		REQUIRE(a[1] == 1);
+		REQUIRE(a[2] == 0);
+		REQUIRE(a[3] == 1);
+		REQUIRE(a[4] == 2);
+	}
+
+	SECTION("Using reverse iterators") {
+		int b[count] = {0};
+
+		sstl::copy_backward(sstl::reverse_iterator<int*>(&a[count]),
+		                    sstl::reverse_iterator<int*>(&a[0]),
+		                    sstl::reverse_iterator<int*>(&b[0]));
+
+		REQUIRE(sstl::equal(&a[0], &a[count], &b[0]));
+	}
+}
+
+TEST_CASE("Rotate arrays of every split point", "[rotate]") {
+	const int count = 12;
+
+	for (int size = 1; size <= count; ++size) {
+		for (int k = 0; k <= size; ++k) {
+			int random[count];
+			int forward[count];
+			int expect[count];
+
+			for (int i = 0; i < size; ++i) {
+				random[i] = forward[i] = i;
+				expect[i] = (i + k) % size;
+			}
+
+			int* r = sstl::rotate(&random[0], &random[k], &random[size]);
+			ForwardIterator f = sstl::rotate(ForwardIterator(&forward[0]),
+			                                 ForwardIterator(&forward[k]),
+			                                 ForwardIterator(&forward[size]));
+
+			REQUIRE(sstl::equal(&random[0], &random[size], &expect[0]));
+			REQUIRE(sstl::equal(&forward[0], &forward[size], &expect[0]));
+			REQUIRE(r == &random[size - k]);
+			REQUIRE(f.p_ == &forward[size - k]);
+		}
+	}
+}
+
+TEST_CASE("Move array to another", "[move]") {
+	const size_t count = 4;
+	int a[count] = {0, 1, 2, 3};
+
+	SECTION("Move range forward") {
+		int b[count] = {0};
+
+		REQUIRE(sstl::move(&a[0], &a[count], &b[0]) == &b[count]);
+		REQUIRE(sstl::equal(&a[0], &a[count], &b[0]));
+	}
+
+	SECTION("Move range backward") {
+		int b[count] = {0};
+
+		REQUIRE(sstl::move_backward(&a[0], &a[count], &b[count]) == &b[0]);
+		REQUIRE(sstl::equal(&a[0], &a[count], &b[0]));
+	}
+}
+
+#if __cplusplus >= 201103
+namespace {
+/** Move-only type which records whether it has been moved from. */
+struct Handle {
+	explicit Handle(int v = 0) : value(v) {}
+	Handle(Handle&& other) : value(other.value) { other.value = -1; }
+	Handle& operator=(Handle&& rhs) { value = rhs.value; rhs.value = -1; return *this; }
+
+	int value;
+};
+} /* namespace */
+
+TEST_CASE("Move-only types", "[move]") {
+	SECTION("Swap by moving") {
+		Handle a(1), b(2);
+
+		sstl::swap(a, b);
+
+		REQUIRE(a.value == 2);
+		REQUIRE(b.value == 1);
+	}
+
+	SECTION("Move a range") {
+		Handle a[2] = {Handle(1), Handle(2)};
+		Handle b[2];
+
+		sstl::move(&a[0], &a[2], &b[0]);
+
+		REQUIRE(a[0].value == -1);
+		REQUIRE(b[0].value == 1);
+		REQUIRE(b[1].value == 2);
+	}
+
+	SECTION("Rotate a range") {
+		Handle a[3] = {Handle(1), Handle(2), Handle(3)};
+
+		sstl::rotate(&a[0], &a[1], &a[3]);
+
+		REQUIRE(a[0].value == 2);
+		REQUIRE(a[1].value == 3);
+		REQUIRE(a[2].value == 1);
+	}
+}
+#endif
+
+#if __cplusplus >= 201402
+/** Runs the block copy and fill paths inside a constant expression. */
+constexpr int constant_algorithms() {
+	int a[4] = {};
+	int b[4] = {};
+	unsigned char bytes[4] = {};
+
+	sstl::fill(a, a + 4, 3);
+	sstl::fill_n(bytes, 4, 7);
+	sstl::copy(a, a + 2, b);
+	sstl::copy_n(a, 1, b + 3);
+	sstl::copy_backward(b, b + 2, b + 3);
+
+	return sstl::equal(a, a + 2, b) +
+	       2 * sstl::lexicographical_compare(a, a + 3, b, b + 4) +
+	       4 * (bytes[3] == 7) +
+	       8 * (sstl::max(b[1], b[2]) == 3);
+}
+
+TEST_CASE("Use algorithms in constant expressions", "[constexpr]") {
+	static_assert(sstl::min(1, 2) == 1, "min is a constant expression");
+	static_assert(constant_algorithms() == 15, "algorithms are constant expressions");
+
+	REQUIRE(constant_algorithms() == 15);
+}
+#endif
+
+namespace {
+/** Fills data with one of the input patterns sorting algorithms are known to stumble on. */
+void fill_pattern(int* data, int count, int pattern) {
+	unsigned state = 12345u + unsigned(count);
+
+	for (int i = 0; i < count; ++i) {
+		state = state * 1103515245u + 12345u;
+
+		switch (pattern) {
+		case 0: data[i] = int(state >> 8); break;
+		case 1: data[i] = i; break;
+		case 2: data[i] = count - i; break;
+		case 3: data[i] = 7; break;
+		case 4: data[i] = int(state >> 8) % 4; break;
+		default: data[i] = i < count / 2 ? i : count - i; break;
+		}
+	}
+}
+
+const int sort_patterns = 6;
+const int sort_sizes[] = {0, 1, 2, 3, 23, 24, 25, 100, 129, 1000, 10000};
+const int sort_size_count = sizeof(sort_sizes) / sizeof(sort_sizes[0]);
+
+/** Key with a payload, only the key takes part in comparisons. */
+struct Keyed {
+	int key;
+	int order;
+
+	bool operator<(const Keyed& rhs) const { return key < rhs.key; }
+};
+
+/** Compares Keyed by key only, for the stability checks. */
+bool by_key(const Keyed& a, const Keyed& b) { return a.key < b.key; }
+
+/** Checks whether no element of [first, last) compares less than the one before it. */
+template<class It, class Compare>
+bool sorted_by(It first, It last, Compare comp) {
+	for (It i = first; i != last && i + 1 != last; ++i) {
+		if (comp(*(i + 1), *i)) { return false; }
+	}
+
+	return true;
+}
+
+bool sorted_stably(const Keyed* data, int count) {
+	for (int i = 1; i < count; ++i) {
+		if (data[i].key < data[i - 1].key) { return false; }
+
+		if (data[i].key == data[i - 1].key && data[i].order < data[i - 1].order) { return false; }
+	}
+
+	return true;
+}
+}
+
+TEST_CASE("Sort ranges", "[sort]") {
+	static int data[10000];
+	static int expected[10000];
+
+	for (int pattern = 0; pattern < sort_patterns; ++pattern) {
+		for (int s = 0; s < sort_size_count; ++s) {
+			const int count = sort_sizes[s];
+			fill_pattern(data, count, pattern);
+			std::copy(data, data + count, expected);
+			std::sort(expected, expected + count);
+
+			sstl::sort(data, data + count);
+
+			REQUIRE(std::equal(data, data + count, expected));
+		}
+	}
+
+	SECTION("With a comparison functor") {
+		fill_pattern(data, 1000, 0);
+		sstl::sort(data, data + 1000, sstl::greater<int>());
+
+		REQUIRE(sorted_by(data, data + 1000, sstl::greater<int>()));
+	}
+
+	SECTION("Elements of class type, which are partitioned with branches") {
+		static Keyed keyed[1000];
+
+		for (int i = 0; i < 1000; ++i) {
+			keyed[i].key = (i * 7919) % 1000 / 3;
+			keyed[i].order = i;
+		}
+
+		sstl::sort(keyed, keyed + 1000);
+
+		REQUIRE(sorted_by(keyed, keyed + 1000, by_key));
+	}
+
+	SECTION("Through vector iterators") {
+		sstl::vector<int, 64> v;
+
+		for (int i = 0; i < 64; ++i) { v.push_back((i * 37) % 64); }
+
+		sstl::sort(v.begin(), v.end());
+
+		for (int i = 0; i < 64; ++i) { REQUIRE(v[i] == i); }
+	}
+}
+
+TEST_CASE("Stable sort ranges", "[sort]") {
+	static Keyed data[2000];
+	static Keyed buffer[1000];
+
+	for (int pattern = 0; pattern < sort_patterns; ++pattern) {
+		for (int s = 0; s < sort_size_count && sort_sizes[s] <= 2000; ++s) {
+			const int count = sort_sizes[s];
+			static int keys[2000];
+			fill_pattern(keys, count, pattern);
+
+			for (int i = 0; i < count; ++i) {
+				data[i].key = keys[i] % 50;
+				data[i].order = i;
+			}
+
+			sstl::stable_sort(data, data + count);
+
+			REQUIRE(sorted_stably(data, count));
+
+			for (int i = 0; i < count; ++i) {
+				data[i].key = keys[i] % 50;
+				data[i].order = i;
+			}
+
+			/* Too small a buffer for the last merges, which then go in place. */
+			sstl::stable_sort(data, data + count, buffer, size_t(count / 4), by_key);
+
+			REQUIRE(sorted_stably(data, count));
+
+			for (int i = 0; i < count; ++i) {
+				data[i].key = keys[i] % 50;
+				data[i].order = i;
+			}
+
+			sstl::stable_sort(data, data + count, buffer, size_t(1000));
+
+			REQUIRE(sorted_stably(data, count));
+		}
+	}
+}
+
+TEST_CASE("Partially sort ranges", "[sort]") {
+	int data[100];
+
+	for (int i = 0; i < 100; ++i) { data[i] = (i * 31) % 100; }
+
+	SECTION("The smallest elements in order") {
+		sstl::partial_sort(data, data + 10, data + 100);
+
+		for (int i = 0; i < 10; ++i) { REQUIRE(data[i] == i); }
+	}
+
+	SECTION("With a comparison functor") {
+		sstl::partial_sort(data, data + 5, data + 100, sstl::greater<int>());
+
+		for (int i = 0; i < 5; ++i) { REQUIRE(data[i] == 99 - i); }
+	}
+
+	SECTION("Nothing and everything") {
+		sstl::partial_sort(data, data, data + 100);
+		sstl::partial_sort(data, data + 100, data + 100);
+
+		REQUIRE(sorted_by(data, data + 100, sstl::less<int>()));
+	}
+}
+
+TEST_CASE("Select the nth element", "[sort]") {
+	static int data[10000];
+	static int expected[10000];
+
+	for (int pattern = 0; pattern < sort_patterns; ++pattern) {
+		for (int s = 1; s < sort_size_count; ++s) {
+			const int count = sort_sizes[s];
+			const int nths[] = {0, count / 3, count - 1};
+
+			for (int k = 0; k < 3; ++k) {
+				fill_pattern(data, count, pattern);
+				std::copy(data, data + count, expected);
+				std::sort(expected, expected + count);
+
+				sstl::nth_element(data, data + nths[k], data + count);
+
+				const int nth = data[nths[k]];
+				bool partitioned = true;
+
+				for (int i = 0; i < nths[k]; ++i) { partitioned = partitioned && !(nth < data[i]); }
+
+				for (int i = nths[k] + 1; i < count; ++i) { partitioned = partitioned && !(data[i] < nth); }
+
+				REQUIRE(nth == expected[nths[k]]);
+				REQUIRE(partitioned);
+			}
+		}
+	}
+
+	SECTION("The end of the range") {
+		int a[3] = {3, 1, 2};
+		sstl::nth_element(a, a + 3, a + 3);
+
+		REQUIRE(a[0] == 3);
+	}
+}
+
+TEST_CASE("Build and sort heaps", "[heap]") {
+	static int data[10000];
+	static int expected[10000];
+
+	SECTION("Make and sort a heap") {
+		for (int pattern = 0; pattern < sort_patterns; ++pattern) {
+			for (int s = 0; s < sort_size_count; ++s) {
+				const int count = sort_sizes[s];
+
+				fill_pattern(data, count, pattern);
+				std::copy(data, data + count, expected);
+				std::sort(expected, expected + count);
+
+				sstl::make_heap(data, data + count);
+				REQUIRE(sstl::is_heap(data, data + count));
+
+				sstl::sort_heap(data, data + count);
+				REQUIRE(std::equal(data, data + count, expected));
+			}
+		}
+	}
+
+	SECTION("Push every element, then pop them in descending order") {
+		fill_pattern(data, 1000, 4);
+		std::copy(data, data + 1000, expected);
+		std::sort(expected, expected + 1000);
+
+		bool matches = true;
+
+		for (int i = 1; i <= 1000; ++i) {
+			sstl::push_heap(data, data + i);
+			matches = matches && sstl::is_heap(data, data + i);
+		}
+
+		for (int i = 1000; i > 0; --i) {
+			sstl::pop_heap(data, data + i);
+			matches = matches && data[i - 1] == expected[i - 1] && sstl::is_heap(data, data + i - 1);
+		}
+
+		REQUIRE(matches);
+	}
+
+	SECTION("With a comparison functor") {
+		fill_pattern(data, 100, 0);
+		sstl::make_heap(data, data + 100, sstl::greater<int>());
+		REQUIRE(sstl::is_heap(data, data + 100, sstl::greater<int>()));
+		REQUIRE(data[0] == *std::min_element(data, data + 100));
+
+		sstl::sort_heap(data, data + 100, sstl::greater<int>());
+		REQUIRE(sorted_by(data, data + 100, sstl::greater<int>()));
+	}
+
+	SECTION("Find where a heap ends") {
+		int a[6] = {9, 5, 8, 1, 6, 7};
+
+		REQUIRE(sstl::is_heap_until(a, a + 6) == a + 4);
+		REQUIRE(!sstl::is_heap(a, a + 6));
+		REQUIRE(sstl::is_heap(a, a));
+	}
+}
+
+namespace {
+/** Key extractor for the radix sort tests. */
+int key_of(const Keyed& k) { return k.key; }
+}
+
+TEST_CASE("Radix sort ranges", "[sort]") {
+	static int data[10000];
+	static int expected[10000];
+	static int buffer[10000];
+
+	SECTION("Signed keys, in every pattern") {
+		for (int pattern = 0; pattern < sort_patterns; ++pattern) {
+			for (int s = 0; s < sort_size_count; ++s) {
+				const int count = sort_sizes[s];
+				fill_pattern(data, count, pattern);
+
+				/* Spreads the keys over the negative and the positive range. */
+				for (int i = 0; i < count; ++i) { data[i] = int(unsigned(data[i]) * 2654435u - 1000000u); }
+
+				std::copy(data, data + count, expected);
+				std::sort(expected, expected + count);
+
+				sstl::radix_sort(data, data + count, buffer);
+
+				REQUIRE(std::equal(data, data + count, expected));
+			}
+		}
+	}
+
+	SECTION("Keys of every width") {
+		/* Longer than the insertion sort threshold, so the histogram passes run. */
+		signed char small[200];
+		signed char small_buffer[200];
+		uint64_t wide[200];
+		uint64_t wide_buffer[200];
+
+		for (int i = 0; i < 200; ++i) {
+			small[i] = static_cast<signed char>((i * 37) % 256 - 128);
+			wide[i] = uint64_t((i * 7919) % 200) << 56 | uint64_t(i);
+		}
+
+		sstl::radix_sort(small, small + 200, small_buffer);
+		sstl::radix_sort(wide, wide + 200, wide_buffer);
+
+		bool small_sorted = true;
+		bool wide_sorted = true;
+
+		for (int i = 1; i < 200; ++i) {
+			small_sorted = small_sorted && small[i - 1] <= small[i];
+			wide_sorted = wide_sorted && wide[i - 1] < wide[i];
+		}
+
+		REQUIRE(small[0] == -128);
+		REQUIRE(small_sorted);
+		REQUIRE(wide_sorted);
+	}
+
+	SECTION("By key, keeping equal keys in order") {
+		static Keyed keyed[1000];
+		static Keyed keyed_buffer[1000];
+
+		for (int i = 0; i < 1000; ++i) {
+			keyed[i].key = (i * 7919) % 1000 / 3 - 100;
+			keyed[i].order = i;
+		}
+
+		sstl::radix_sort(keyed, keyed + 1000, keyed_buffer, key_of);
+
+		REQUIRE(sorted_stably(keyed, 1000));
+	}
+
+	SECTION("With stack scratch space") {
+		sstl::vector<int, 64> v;
+
+		for (int i = 0; i < 64; ++i) { v.push_back((i * 37) % 64 - 32); }
+
+		sstl::radix_sort<64>(v.begin(), v.end());
+
+		for (int i = 0; i < 64; ++i) { REQUIRE(v[i] == i - 32); }
+	}
+
+	SECTION("Past the stack scratch space") {
+		static Keyed keyed[500];
+
+		for (int i = 0; i < 500; ++i) {
+			keyed[i].key = (i * 7919) % 500 / 4;
+			keyed[i].order = i;
+		}
+
+		sstl::radix_sort<100>(keyed, keyed + 500, key_of);
+
+		REQUIRE(sorted_stably(keyed, 500));
+	}
+}
+
+TEST_CASE("Binary search sorted ranges", "[search]") {
+	/* Every value from 0 to 9 twice, with the odd ones missing. */
+	int data[10] = {0, 0, 2, 2, 4, 4, 6, 6, 8, 8};
+
+	SECTION("Every key against the std algorithms") {
+		bool matches = true;
+
+		for (int key = -1; key <= 10; ++key) {
+			matches = matches && sstl::lower_bound(data, data + 10, key) == std::lower_bound(data, data + 10, key);
+			matches = matches && sstl::upper_bound(data, data + 10, key) == std::upper_bound(data, data + 10, key);
+			matches = matches && sstl::binary_search(data, data + 10, key) == std::binary_search(data, data + 10, key);
+		}
+
+		REQUIRE(matches);
+	}
+
+	SECTION("Equal range") {
+		sstl::pair<int*, int*> range = sstl::equal_range(data, data + 10, 4);
+		REQUIRE(range.first == data + 4);
+		REQUIRE(range.second == data + 6);
+
+		range = sstl::equal_range(data, data + 10, 5);
+		REQUIRE(range.first == data + 6);
+		REQUIRE(range.second == data + 6);
+	}
+
+	SECTION("Forward iterators") {
+		const ForwardIterator first(data);
+		const ForwardIterator last(data + 10);
+
+		REQUIRE(sstl::lower_bound(first, last, 3).p_ == data + 4);
+		REQUIRE(sstl::upper_bound(first, last, 4).p_ == data + 6);
+		REQUIRE(sstl::lower_bound(first, last, 9) == last);
+		REQUIRE(sstl::binary_search(first, last, 8));
+		REQUIRE(!sstl::binary_search(first, last, 7));
+		REQUIRE(sstl::equal_range(first, last, 0).second.p_ == data + 2);
+	}
+
+	SECTION("With a comparison functor") {
+		int descending[5] = {9, 7, 5, 3, 1};
+
+		REQUIRE(sstl::lower_bound(descending, descending + 5, 5, sstl::greater<int>()) == descending + 2);
+		REQUIRE(sstl::upper_bound(descending, descending + 5, 5, sstl::greater<int>()) == descending + 3);
+		REQUIRE(sstl::binary_search(descending, descending + 5, 1, sstl::greater<int>()));
+		REQUIRE(!sstl::binary_search(descending, descending + 5, 4, sstl::greater<int>()));
+	}
+
+	SECTION("Keys of another type than the elements") {
+		sstl::vector<long, 4> v;
+		v.push_back(10);
+		v.push_back(20);
+		v.push_back(30);
+
+		REQUIRE(sstl::lower_bound(v.begin(), v.end(), 15) == v.begin() + 1);
+		REQUIRE(sstl::binary_search(v.begin(), v.end(), 30));
+	}
+
+	SECTION("Empty ranges") {
+		REQUIRE(sstl::lower_bound(data, data, 1) == data);
+		REQUIRE(!sstl::binary_search(data, data, 1));
+	}
+}
+
+/**
+	Cross-checks the scans against the std algorithms on every size up to a
+	few SIMD groups and every misalignment, with small values of both signs
+	so there are duplicates, and unsigned values near the maximum.
+*/
+template<typename T>
+bool scans_match_std() {
+	T data[80];
+	unsigned state = 1;
+	bool matches = true;
+
+	for (int size = 0; size <= 72; ++size) {
+		for (int offset = 0; offset < 4; ++offset) {
+			T* const first = data + offset;
+			T* const last = first + size;
+
+			for (int i = 0; i < size; ++i) {
+				state = state * 1103515245u + 12345u;
+				first[i] = T(int(state >> 16) % 16 - 8);
+			}
+
+			for (int v = -9; v <= 9; ++v) {
+				matches = matches && sstl::find(first, last, T(v)) == std::find(first, last, T(v));
+				matches = matches && sstl::count(first, last, T(v)) == std::count(first, last, T(v));
+			}
+
+			T* largest = first;
+
+			for (T* i = first; i != last; ++i) {
+				if (!(*i < *largest)) { largest = i; }
+			}
+
+			const sstl::pair<T*, T*> extremes = sstl::minmax_element(first, last);
+			matches = matches && sstl::min_element(first, last) == std::min_element(first, last);
+			matches = matches && sstl::max_element(first, last) == std::max_element(first, last);
+			matches = matches && extremes.first == std::min_element(first, last);
+			matches = matches && extremes.second == largest;
+		}
+	}
+
+	return matches;
+}
+
+bool is_even(int value) { return value % 2 == 0; }
+
+TEST_CASE("Find, count and select extremes of ranges", "[search]") {
+	SECTION("Every arithmetic element type against the std algorithms") {
+		REQUIRE(scans_match_std<int8_t>());
+		REQUIRE(scans_match_std<uint8_t>());
+		REQUIRE(scans_match_std<int16_t>());
+		REQUIRE(scans_match_std<uint16_t>());
+		REQUIRE(scans_match_std<int32_t>());
+		REQUIRE(scans_match_std<uint32_t>());
+		REQUIRE(scans_match_std<int64_t>());
+		REQUIRE(scans_match_std<uint64_t>());
+		REQUIRE(scans_match_std<float>());
+		REQUIRE(scans_match_std<double>());
+	}
+
+	SECTION("Values which the element type cannot hold") {
+		uint8_t bytes[40] = {};
+		bytes[33] = 255;
+
+		REQUIRE(sstl::find(bytes, bytes + 40, 255) == bytes + 33);
+		REQUIRE(sstl::find(bytes, bytes + 40, -1) == bytes + 40);
+		REQUIRE(sstl::find(bytes, bytes + 40, 256) == bytes + 40);
+		REQUIRE(sstl::count(bytes, bytes + 40, 0) == 39);
+		REQUIRE(sstl::count(bytes, bytes + 40, 512) == 0);
+	}
+
+	SECTION("Floating-point equality") {
+		double values[20] = {};
+		values[18] = -0.0;
+		values[19] = std::numeric_limits<double>::quiet_NaN();
+
+		REQUIRE(sstl::count(values, values + 20, 0.0) == 19);
+		REQUIRE(sstl::find(values, values + 20, std::numeric_limits<double>::quiet_NaN()) == values + 20);
+	}
+
+	SECTION("Integers at the ends of their range") {
+		int8_t small[33] = {};
+		uint32_t large[9] = {1, 0x80000000u, 7, 0xffffffffu, 0, 0x7fffffffu, 0xffffffffu, 3, 0};
+		small[20] = -128;
+		small[31] = 127;
+
+		REQUIRE(sstl::min_element(small, small + 33) == small + 20);
+		REQUIRE(sstl::max_element(small, small + 33) == small + 31);
+		REQUIRE(sstl::min_element(large, large + 9) == large + 4);
+		REQUIRE(sstl::max_element(large, large + 9) == large + 3);
+		REQUIRE(sstl::minmax_element(large, large + 9).second == large + 6);
+	}
+
+	SECTION("Through vector iterators") {
+		sstl::vector<int, 64> v;
+
+		for (int i = 0; i < 64; ++i) { v.push_back((i * 37) % 64); }
+
+		const sstl::vector<int, 64>& cv = v;
+		REQUIRE(*sstl::find(cv.begin(), cv.end(), 5) == 5);
+		REQUIRE(sstl::count(v.begin(), v.end(), 63) == 1);
+		REQUIRE(*sstl::min_element(v.begin(), v.end()) == 0);
+		REQUIRE(*sstl::max_element(cv.begin(), cv.end()) == 63);
+	}
+
+	SECTION("Predicates and comparison functors") {
+		int data[6] = {3, 5, 8, 1, 4, 8};
+
+		REQUIRE(sstl::find_if(data, data + 6, is_even) == data + 2);
+		REQUIRE(sstl::count_if(data, data + 6, is_even) == 3);
+		REQUIRE(sstl::min_element(data, data + 6, sstl::greater<int>()) == data + 2);
+		REQUIRE(sstl::max_element(data, data + 6, sstl::greater<int>()) == data + 3);
+		REQUIRE(sstl::minmax_element(data, data + 6, sstl::greater<int>()).first == data + 2);
+		REQUIRE(sstl::minmax_element(data, data + 6, sstl::greater<int>()).second == data + 3);
+	}
+
+	SECTION("Forward iterators and empty ranges") {
+		int data[5] = {4, 2, 9, 2, 9};
+		const ForwardIterator first(data);
+		const ForwardIterator last(data + 5);
+
+		REQUIRE(sstl::find(first, last, 9).p_ == data + 2);
+		REQUIRE(sstl::count(first, last, 2) == 2);
+		REQUIRE(sstl::min_element(first, last).p_ == data + 1);
+		REQUIRE(sstl::minmax_element(first, last).second.p_ == data + 4);
+		REQUIRE(sstl::find(data, data, 4) == data);
+		REQUIRE(sstl::min_element(data, data) == data);
+		REQUIRE(sstl::minmax_element(data, data).second == data);
+	}
+}
+
+/**
+	Cross-checks equal and lexicographical_compare against the std algorithms
+	for ranges which first differ at every position, in either direction,
+	and for every pair of lengths sharing a prefix.
+*/
+template<typename T>
+bool comparisons_match_std(T low, T high) {
+	T a[40];
+	T b[40];
+	bool matches = true;
+
+	for (int i = 0; i < 40; ++i) { a[i] = b[i] = T(i); }
+
+	for (int size = 0; size <= 40; ++size) {
+		for (int other = 0; other <= 40; ++other) {
+			matches = matches && sstl::lexicographical_compare(a, a + size, b, b + other) ==
+			          std::lexicographical_compare(a, a + size, b, b + other);
+		}
+
+		for (int pos = 0; pos < size; ++pos) {
+			a[pos] = low;
+			b[pos] = high;
+			matches = matches && sstl::equal(a, a + size, b) == std::equal(a, a + size, b);
+			matches = matches && sstl::lexicographical_compare(a, a + size, b, b + size) ==
+			          std::lexicographical_compare(a, a + size, b, b + size);
+			matches = matches && sstl::lexicographical_compare(b, b + size, a, a + size) ==
+			          std::lexicographical_compare(b, b + size, a, a + size);
+			a[pos] = b[pos] = T(pos);
+		}
+
+		matches = matches && sstl::equal(a, a + size, b);
+	}
+
+	return matches;
+}
+
+TEST_CASE("Compare ranges of integers bytewise", "[compare]") {
+	SECTION("Against the std algorithms") {
+		REQUIRE(comparisons_match_std<unsigned char>(1, 200));
+		REQUIRE(comparisons_match_std<char>(1, char(-56)));
+		REQUIRE(comparisons_match_std<signed char>(-100, 100));
+		REQUIRE(comparisons_match_std<uint16_t>(0x00ff, 0xff00));
+		REQUIRE(comparisons_match_std<int>(-1, 1));
+		REQUIRE(comparisons_match_std<uint32_t>(0x01000000u, 0x00000002u));
+		REQUIRE(comparisons_match_std<int64_t>(-1, 0));
+	}
+
+	SECTION("Through the container comparison operators") {
+		sstl::vector<uint8_t, 4096> a(4096, 7);
+		sstl::vector<uint8_t, 4096> b(a);
+
+		REQUIRE(a == b);
+		REQUIRE(!(a < b));
+
+		b[4000] = 200;
+		REQUIRE(a != b);
+		REQUIRE(a < b);
+
+		a.resize(4000);
+		b.resize(4000);
+		REQUIRE(a == b);
+
+		a.pop_back();
+		REQUIRE(a < b);
+	}
+}
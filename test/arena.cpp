@@ -0,0 +1,146 @@
+#include "catch/catch.hpp"
+
+#include "arena.h"
+
+#ifdef SSTL_HAS_MEMORY_RESOURCE
+#include <vector>
+#endif
+
+static bool aligned(const void* p, size_t alignment) {
+	return reinterpret_cast<uintptr_t>(p) % alignment == 0;
+}
+
+TEST_CASE("Allocate from an arena", "[modifiers]") {
+	sstl::arena<256> a;
+	sstl::arena<>& base = a;
+
+	REQUIRE(base.empty());
+	REQUIRE(base.max_size() == 256);
+	REQUIRE(base.available() == 256);
+
+	SECTION("Allocations are aligned and do not overlap") {
+		char* c = static_cast<char*>(base.allocate(1, 1));
+		void* d = base.allocate(8, 8);
+		void* e = base.allocate(3);
+
+		REQUIRE(base.owns(c));
+		REQUIRE(aligned(d, 8));
+		REQUIRE(aligned(e, sstl::detail::max_alignment));
+		REQUIRE(static_cast<char*>(d) >= c + 1);
+		REQUIRE(base.size() >= 12);
+	}
+
+	SECTION("Alignments beyond the storage's own") {
+		base.allocate(1, 1);
+		void* p = base.allocate(16, 64);
+
+		REQUIRE(p != 0);
+		REQUIRE(aligned(p, 64));
+	}
+
+	SECTION("Fail once the arena is exhausted") {
+		REQUIRE(base.allocate(200, 1) != 0);
+		REQUIRE(base.allocate(57, 1) == 0);
+		REQUIRE(base.allocate(56, 1) != 0);
+		REQUIRE(base.available() == 0);
+		REQUIRE(base.allocate(1, 1) == 0);
+		REQUIRE(base.allocate(size_t(-1), 1) == 0);
+	}
+
+	SECTION("Release everything") {
+		void* first = base.allocate(100);
+		base.allocate(100);
+		base.release();
+
+		REQUIRE(base.empty());
+		REQUIRE(base.allocate(100) == first);
+	}
+}
+
+TEST_CASE("Give memory back to an arena", "[modifiers]") {
+	sstl::arena<256> a;
+
+	SECTION("The most recent allocation is reclaimed") {
+		void* p = a.allocate(16, 16);
+		void* q = a.allocate(32, 16);
+		a.deallocate(q, 32);
+
+		REQUIRE(a.size() == 16);
+
+		a.deallocate(p, 16);
+
+		REQUIRE(a.empty());
+	}
+
+	SECTION("Older allocations are not") {
+		void* p = a.allocate(16, 16);
+		a.allocate(16, 16);
+		a.deallocate(p, 16);
+
+		REQUIRE(a.size() == 32);
+	}
+
+	SECTION("Rewind to a mark") {
+		a.allocate(10, 1);
+		const sstl::arena<>::marker m = a.mark();
+		a.allocate(20, 1);
+		a.allocate(30, 1);
+		a.rewind(m);
+
+		REQUIRE(a.size() == 10);
+
+		/* Marks past the current position are ignored. */
+		a.rewind(200);
+
+		REQUIRE(a.size() == 10);
+	}
+
+	SECTION("Pointers from elsewhere are ignored") {
+		int outside = 0;
+		a.allocate(4, 4);
+		a.deallocate(&outside, sizeof(outside));
+
+		REQUIRE(a.size() == 4);
+	}
+}
+
+#ifdef SSTL_HAS_MEMORY_RESOURCE
+TEST_CASE("Serve a std::pmr container from an arena", "[allocator]") {
+	sstl::arena<1024> a;
+	sstl::arena_resource resource(a);
+	std::pmr::vector<int> v(&resource);
+
+	for (int i = 0; i < 100; ++i) { v.push_back(i); }
+
+	REQUIRE(v[99] == 99);
+	REQUIRE(a.owns(v.data()));
+
+	sstl::arena_resource other(a);
+	sstl::arena<16> b;
+	sstl::arena_resource elsewhere(b);
+
+	REQUIRE(resource.is_equal(other));
+	REQUIRE(!resource.is_equal(elsewhere));
+	REQUIRE_THROWS_AS(v.resize(1000), const std::bad_alloc&);
+}
+#endif
+
+#if __cplusplus >= 201103
+/** Reads through the base class, so nothing here can be folded at compile time. */
+static size_t read_capacity(const sstl::arena<>& a) { return a.max_size(); }
+
+extern sstl::arena<64> constant_arena;
+
+/**
+	Dynamically initialized before constant_arena is defined, so it only sees
+	the arena's capacity if the arena was constant initialized.
+*/
+static const size_t constant_arena_seen = read_capacity(constant_arena);
+
+sstl::arena<64> constant_arena;
+
+TEST_CASE("Constant initialize an arena", "[constructor]") {
+	REQUIRE(constant_arena_seen == 64);
+	REQUIRE(constant_arena.empty());
+}
+#endif
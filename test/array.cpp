@@ -1,3 +1,5 @@
+#include <string.h>
+
 #include "catch/catch.hpp"
 
 #include "array.h"
@@ -255,3 +257,71 @@ TEST_CASE("Compare arrays lexicographically", "[comparison]") {
 		REQUIRE(a < b);
 	}
 }
+
+TEST_CASE("Array storage layout", "[layout]") {
+	typedef sstl::detail::stored_size_type stored;
+
+	SECTION("Capacity is stored in a single narrow field") {
+		REQUIRE(sizeof(stored) <= sizeof(uint32_t));
+	}
+
+	SECTION("Metadata only costs padding up to the element alignment") {
+		REQUIRE(sizeof(sstl::array<uint32_t, 2>) == sizeof(stored) + 2 * sizeof(uint32_t));
+		REQUIRE(sizeof(sstl::array<uint16_t, 2>) == sizeof(stored) + 2 * sizeof(uint16_t));
+		REQUIRE(sizeof(sstl::array<uint8_t, 4>) == sizeof(stored) + 4);
+		REQUIRE(sizeof(sstl::array<uint64_t, 2>) ==
+		        sstl::alignment_of<uint64_t>::value + 2 * sizeof(uint64_t));
+	}
+
+	SECTION("The size-erased base reads the capacity of any size") {
+		sstl::array<uint8_t, 300> a;
+		sstl::array<uint8_t>& ref = a;
+
+		REQUIRE(ref.size() == 300);
+		REQUIRE(ref.end() - ref.begin() == 300);
+	}
+}
+
+TEST_CASE("Construct an array without initializing it", "[constructor]") {
+	typedef sstl::array<uint8_t, 16> bytes;
+
+	sstl::aligned_storage<sizeof(bytes), sstl::alignment_of<bytes>::value>::type
+	memory;
+	memset(&memory, 0xAA, sizeof(memory));
+
+	bytes* a = new(&memory) bytes(sstl::default_init);
+
+	REQUIRE(a->size() == 16);
+	REQUIRE(a->front() == 0xAA);
+	REQUIRE(a->back() == 0xAA);
+
+	a->~bytes();
+}
+
+#if __cplusplus >= 201103
+/** Reads through the size-erased base, so nothing here can be folded at compile time. */
+static int read_element(const sstl::array<int>& a, size_t pos) { return a[pos]; }
+
+extern const sstl::array<int, 4> constant_table;
+
+/**
+	Dynamically initialized before constant_table is defined, so it only sees
+	the table's values if the table was constant initialized.
+*/
+static const int constant_table_seen = read_element(constant_table, 2);
+
+const sstl::array<int, 4> constant_table(1, 2, 3, 4);
+
+TEST_CASE("Constant initialize an array", "[constructor]") {
+	static constexpr sstl::array<int, 4> table(1, 2, 3);
+	static constexpr sstl::array<int, 4> zeroes;
+
+	static_assert(table.size() == 4, "size is a constant expression");
+	static_assert(table[0] == 1 && table[2] == 3, "elements are constant");
+	static_assert(table.back() == 0, "trailing elements are value-initialized");
+	static_assert(zeroes.front() == 0, "default construction is constant");
+
+	REQUIRE(constant_table_seen == 3);
+	REQUIRE(table.at(1) == 2);
+}
+#endif
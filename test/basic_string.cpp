@@ -0,0 +1,276 @@
+#include <string.h>
+
+#include "catch/catch.hpp"
+
+#include "basic_string.h"
+
+typedef sstl::basic_string<char> string_base;
+
+TEST_CASE("Construct a string", "[constructor]") {
+	SECTION("Default construct") {
+		sstl::basic_string<char, 8> a;
+
+		REQUIRE(a.empty());
+		REQUIRE(a.capacity() == 8);
+		REQUIRE(strcmp(a.c_str(), "") == 0);
+	}
+
+	SECTION("From a null terminated string") {
+		sstl::basic_string<char, 8> a("hello");
+
+		REQUIRE(a.size() == 5);
+		REQUIRE(a == "hello");
+		REQUIRE(a.c_str()[5] == '\0');
+	}
+
+	SECTION("From a string which is too long") {
+		sstl::basic_string<char, 4> a("hello");
+
+		REQUIRE(a.size() == 4);
+		REQUIRE(strcmp(a.c_str(), "hell") == 0);
+	}
+
+	SECTION("From repeated characters and from a range") {
+		const char text[] = "abcdef";
+		sstl::basic_string<char, 8> a(3, 'x');
+		sstl::basic_string<char, 8> b(text + 1, text + 4);
+
+		REQUIRE(a == "xxx");
+		REQUIRE(b == "bcd");
+	}
+
+	SECTION("Copy through the base class") {
+		sstl::basic_string<char, 16> a("static strings");
+		const string_base& base = a;
+		sstl::basic_string<char, 6> b(base);
+		sstl::basic_string<char, 32> c(base, 7);
+
+		REQUIRE(b == "static");
+		REQUIRE(c == "strings");
+	}
+
+	SECTION("Wide characters") {
+		const wchar_t text[] = L"wide";
+		sstl::basic_string<wchar_t, 8> a(text);
+
+		REQUIRE(a.size() == 4);
+		REQUIRE(a.find(L'd') == 2);
+		REQUIRE(a.compare(L"wider") < 0);
+	}
+}
+
+TEST_CASE("Assign to a string", "[assignment]") {
+	sstl::basic_string<char, 8> a("first");
+
+	SECTION("From a string of another capacity") {
+		sstl::basic_string<char, 16> b("second string");
+		a = b;
+
+		REQUIRE(a == "second s");
+	}
+
+	SECTION("From a substring of itself") {
+		a.assign(a, 2, 2);
+
+		REQUIRE(a == "rs");
+	}
+
+	SECTION("From a character") {
+		a = 'c';
+
+		REQUIRE(a == "c");
+	}
+}
+
+TEST_CASE("Modify a string", "[modifiers]") {
+	sstl::basic_string<char, 16> a("hello");
+
+	SECTION("Append") {
+		a += ", ";
+		a += sstl::basic_string<char, 8>("world");
+		a += '!';
+
+		REQUIRE(a == "hello, world!");
+		REQUIRE(a.c_str()[a.size()] == '\0');
+	}
+
+	SECTION("Append past the capacity") {
+		a.append("-0123456789abcdef");
+
+		REQUIRE(a.size() == 16);
+		REQUIRE(a == "hello-0123456789");
+	}
+
+	SECTION("Append a part of itself") {
+		a.append(a.data() + 1, 3);
+
+		REQUIRE(a == "helloell");
+	}
+
+	SECTION("Insert by index") {
+		a.insert(0, "oh, ");
+		a.insert(a.size(), 2, '!');
+
+		REQUIRE(a == "oh, hello!!");
+	}
+
+	SECTION("Insert by iterator") {
+		const char text[] = "XY";
+		a.insert(a.begin() + 1, '-');
+		a.insert(a.end(), text, text + 2);
+
+		REQUIRE(a == "h-elloXY");
+	}
+
+	SECTION("Insert into a full string keeps the characters after the position") {
+		a.append(11, '.');
+		a.insert(0, "ab");
+
+		REQUIRE(a == "hello...........");
+	}
+
+	SECTION("Insert a part of itself which moves with the tail") {
+		a.insert(1, a.data() + 2, 3);
+
+		REQUIRE(a == "hllo" "ello");
+	}
+
+	SECTION("Insert a part of itself which straddles the position") {
+		a.insert(2, a.data() + 1, 3);
+
+		REQUIRE(a == "he" "ell" "llo");
+	}
+
+	SECTION("Erase") {
+		a.erase(1, 2);
+
+		REQUIRE(a == "hlo");
+
+		a.erase(a.begin());
+
+		REQUIRE(a == "lo");
+
+		a.erase(0);
+
+		REQUIRE(a.empty());
+	}
+
+	SECTION("Replace") {
+		a.replace(1, 3, "EYYYYY");
+
+		REQUIRE(a == "hEYYYYYo");
+
+		a.replace(1, 6, 2, '_');
+
+		REQUIRE(a == "h__o");
+	}
+
+	SECTION("Push, pop and resize") {
+		a.push_back('s');
+		a.pop_back();
+		a.pop_back();
+		a.resize(6, '?');
+
+		REQUIRE(a == "hell??");
+
+		a.resize(2);
+
+		REQUIRE(a == "he");
+		REQUIRE(a.c_str()[2] == '\0');
+	}
+
+	SECTION("Copy out") {
+		char buffer[8] = {0};
+
+		REQUIRE(a.copy(buffer, 3, 3) == 2);
+		REQUIRE(strcmp(buffer, "lo") == 0);
+	}
+}
+
+TEST_CASE("Search a string", "[lookup]") {
+	/* Longer than a 16 character group, so the vectorized scans and their scalar tails both run. */
+	sstl::basic_string<char, 64> a("the quick brown fox jumps over the lazy dog, quickly");
+	const string_base& base = a;
+
+	SECTION("Find") {
+		REQUIRE(base.find("quick") == 4);
+		REQUIRE(base.find("quick", 5) == 45);
+		REQUIRE(base.find("quicker") == string_base::npos);
+		REQUIRE(base.find('q') == 4);
+		REQUIRE(base.find('z') == 37);
+		REQUIRE(base.find('!') == string_base::npos);
+		REQUIRE(base.find("") == 0);
+		REQUIRE(base.find("", a.size()) == a.size());
+	}
+
+	SECTION("Reverse find") {
+		REQUIRE(base.rfind("quick") == 45);
+		REQUIRE(base.rfind("quick", 44) == 4);
+		REQUIRE(base.rfind("the") == 31);
+		REQUIRE(base.rfind('t') == 31);
+		REQUIRE(base.rfind('t', 30) == 0);
+		REQUIRE(base.rfind('y') == 51);
+		REQUIRE(base.rfind('!') == string_base::npos);
+		REQUIRE(base.rfind("dog,") == 40);
+	}
+
+	SECTION("Find the first of a set of characters") {
+		REQUIRE(base.find_first_of("xyz") == 18);
+		REQUIRE(base.find_first_of(",!", 0) == 43);
+		REQUIRE(base.find_first_of("0123456789,") == 43);
+		REQUIRE(base.find_first_of("0123456789") == string_base::npos);
+		REQUIRE(base.find_first_of('o', 20) == 26);
+		REQUIRE(base.find_first_of("yl", 44) == 50);
+	}
+}
+
+TEST_CASE("Compare strings", "[comparison]") {
+	sstl::basic_string<char, 8> a("apple");
+	sstl::basic_string<char, 16> b("apples");
+	sstl::basic_string<char, 4> c("beet");
+
+	REQUIRE(a == "apple");
+	REQUIRE(a != b);
+	REQUIRE(a < b);
+	REQUIRE(b < c);
+	REQUIRE(c > a);
+	REQUIRE(a <= "apple");
+	REQUIRE("apple" >= a);
+	REQUIRE(a.compare(b) < 0);
+	REQUIRE(b.compare(a) > 0);
+	REQUIRE(a.compare(0, 3, "app", 3) == 0);
+
+	/* Characters compare as unsigned, like memcmp. */
+	const sstl::basic_string<char, 4> high("\xff");
+
+	REQUIRE(high > "a");
+}
+
+#if __cplusplus >= 201103
+TEST_CASE("Use the string alias", "[constructor]") {
+	sstl::string<12> a("aliased");
+	sstl::string<>& base = a;
+
+	REQUIRE(base.size() == 7);
+	REQUIRE(base.max_size() == 12);
+}
+
+/** Reads through the size-erased base, so nothing here can be folded at compile time. */
+static size_t read_capacity(const sstl::string<>& s) { return s.max_size(); }
+
+extern sstl::string<16> constant_string;
+
+/**
+	Dynamically initialized before constant_string is defined, so it only sees
+	the string's capacity if the string was constant initialized.
+*/
+static const size_t constant_string_seen = read_capacity(constant_string);
+
+sstl::string<16> constant_string;
+
+TEST_CASE("Constant initialize a string", "[constructor]") {
+	REQUIRE(constant_string_seen == 16);
+	REQUIRE(constant_string.empty());
+	REQUIRE(constant_string.c_str()[0] == '\0');
+}
+#endif
@@ -0,0 +1,167 @@
+#include "catch/catch.hpp"
+
+#include "bitset.h"
+
+TEST_CASE("Construct a bitset", "[constructor]") {
+	SECTION("Default construct") {
+		sstl::bitset<100> a;
+
+		REQUIRE(a.size() == 100);
+		REQUIRE(a.none());
+		REQUIRE(a.count() == 0);
+	}
+
+	SECTION("From an integer") {
+		sstl::bitset<70> a(0x8000000000000005ull);
+
+		REQUIRE(a.test(0));
+		REQUIRE(!a.test(1));
+		REQUIRE(a.test(2));
+		REQUIRE(a.test(63));
+		REQUIRE(!a.test(64));
+		REQUIRE(a.count() == 3);
+		REQUIRE(a.to_ullong() == 0x8000000000000005ull);
+	}
+
+	SECTION("From an integer wider than the bitset") {
+		sstl::bitset<4> a(0xFF);
+
+		REQUIRE(a.count() == 4);
+		REQUIRE(a.all());
+		REQUIRE(a.to_ullong() == 0xF);
+	}
+}
+
+TEST_CASE("Modify single bits of a bitset", "[modifiers]") {
+	sstl::bitset<130> a;
+
+	a.set(0).set(64).set(129);
+	a[65] = true;
+	a.flip(3);
+
+	REQUIRE(a.count() == 5);
+	REQUIRE(a[129]);
+	REQUIRE(a.test(65));
+
+	a.reset(64);
+	a[65].flip();
+	a.set(3, false);
+
+	REQUIRE(a.count() == 2);
+	REQUIRE(!a[64]);
+	REQUIRE(!a[65]);
+	REQUIRE(~a[3]);
+
+	a[1] = a[0];
+
+	REQUIRE(a[1]);
+}
+
+TEST_CASE("Modify all bits of a bitset", "[modifiers]") {
+	sstl::bitset<70> a;
+
+	SECTION("Set and flip keep the bits past the size clear") {
+		a.set();
+
+		REQUIRE(a.all());
+		REQUIRE(a.count() == 70);
+
+		a.flip();
+
+		REQUIRE(a.none());
+		REQUIRE((~a).count() == 70);
+	}
+
+	SECTION("Set and reset ranges across words") {
+		a.set_range(3, 68);
+
+		REQUIRE(a.count() == 65);
+		REQUIRE(!a[2]);
+		REQUIRE(a[3]);
+		REQUIRE(a[67]);
+		REQUIRE(!a[68]);
+
+		a.reset_range(10, 20);
+
+		REQUIRE(a.count() == 55);
+		REQUIRE(a[9]);
+		REQUIRE(!a[10]);
+		REQUIRE(!a[19]);
+		REQUIRE(a[20]);
+
+		a.set_range(60, 1000);
+
+		REQUIRE(a.count() == 57);
+		REQUIRE(a[69]);
+
+		a.set_range(5, 5);
+
+		REQUIRE(a.count() == 57);
+	}
+}
+
+TEST_CASE("Find set bits in a bitset", "[lookup]") {
+	sstl::bitset<200> a;
+
+	REQUIRE(a.find_first() == 200);
+
+	const size_t bits[5] = {1, 63, 64, 130, 199};
+
+	for (size_t i = 0; i < 5; ++i) { a.set(bits[i]); }
+
+	size_t found = 0;
+
+	for (size_t pos = a.find_first(); pos != a.size(); pos = a.find_next(pos)) {
+		REQUIRE(pos == bits[found]);
+		++found;
+	}
+
+	REQUIRE(found == 5);
+	REQUIRE(a.find_next(199) == 200);
+}
+
+TEST_CASE("Combine bitsets", "[operators]") {
+	sstl::bitset<100> a;
+	sstl::bitset<100> b;
+
+	a.set_range(0, 50);
+	b.set_range(25, 75);
+
+	REQUIRE((a & b).count() == 25);
+	REQUIRE((a | b).count() == 75);
+	REQUIRE((a ^ b).count() == 50);
+	REQUIRE(a != b);
+	REQUIRE((a & b) == (b & a));
+}
+
+TEST_CASE("Shift a bitset", "[operators]") {
+	sstl::bitset<100> a;
+	a.set(0).set(40).set(99);
+
+	SECTION("Towards higher indices") {
+		const sstl::bitset<100> b = a << 30;
+
+		REQUIRE(b.count() == 2);
+		REQUIRE(b[30]);
+		REQUIRE(b[70]);
+		REQUIRE((a << 64)[64]);
+		REQUIRE((a << 64).count() == 1);
+		REQUIRE((a << 100).none());
+	}
+
+	SECTION("Towards lower indices") {
+		const sstl::bitset<100> b = a >> 30;
+
+		REQUIRE(b.count() == 2);
+		REQUIRE(b[10]);
+		REQUIRE(b[69]);
+		REQUIRE((a >> 64)[35]);
+		REQUIRE((a >> 64).count() == 1);
+		REQUIRE((a >> 100).none());
+	}
+}
+
+#if __cplusplus >= 201103
+static_assert(sstl::bitset<64>().size() == 64, "bitset size is a constant expression");
+static_assert(!sstl::bitset<64>().test(3), "a default constructed bitset has no bits set");
+#endif
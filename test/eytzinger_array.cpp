@@ -0,0 +1,99 @@
+#include <algorithm>
+
+#include "catch/catch.hpp"
+
+#include "eytzinger_array.h"
+
+TEST_CASE("Construct an Eytzinger array", "[constructor]") {
+	SECTION("Default construct") {
+		sstl::eytzinger_array<int, 4> a;
+
+		REQUIRE(a.empty());
+		REQUIRE(a.max_size() == 4);
+		REQUIRE(a.lower_bound(0) == a.end());
+	}
+
+	SECTION("Stores a sorted range in breadth-first order") {
+		int init[7] = {1, 2, 3, 4, 5, 6, 7};
+		sstl::eytzinger_array<int, 8> a(init, init + 7);
+
+		int expect[7] = {4, 2, 6, 1, 3, 5, 7};
+		REQUIRE(a.size() == 7);
+		REQUIRE(sstl::equal(a.begin(), a.end(), expect));
+	}
+
+	SECTION("Keeps the first N elements") {
+		int init[6] = {1, 2, 3, 4, 5, 6};
+		sstl::eytzinger_array<int, 3> a(init, init + 6);
+
+		int expect[3] = {2, 1, 3};
+		REQUIRE(a.size() == 3);
+		REQUIRE(sstl::equal(a.begin(), a.end(), expect));
+	}
+
+	SECTION("Copy through the base class") {
+		int init[3] = {1, 2, 3};
+		sstl::eytzinger_array<int, 4> a(init, init + 3);
+		sstl::eytzinger_array<int, 4> b(a);
+		sstl::eytzinger_array<int, 4> c;
+		sstl::eytzinger_array<int>& base = c;
+		base = a;
+
+		REQUIRE(sstl::equal(b.begin(), b.end(), a.begin()));
+		REQUIRE(sstl::equal(c.begin(), c.end(), a.begin()));
+	}
+}
+
+TEST_CASE("Search an Eytzinger array", "[lookup]") {
+	static int sorted[300];
+	static sstl::eytzinger_array<int, 300> a;
+
+	SECTION("Every size and key against a sorted array") {
+		bool matches = true;
+
+		for (int size = 0; size <= 300 && matches; ++size) {
+			/* Even keys, each twice, so both bounds of runs and missing keys are covered. */
+			for (int i = 0; i < size; ++i) { sorted[i] = i / 2 * 2; }
+
+			a.assign(sorted, sorted + size);
+
+			for (int key = -1; key <= size + 1; ++key) {
+				const int* lower = std::lower_bound(sorted, sorted + size, key);
+				const int* upper = std::upper_bound(sorted, sorted + size, key);
+				const int* l = a.lower_bound(key);
+				const int* u = a.upper_bound(key);
+
+				matches = matches && (lower == sorted + size ? l == a.end() : l != a.end() && *l == *lower);
+				matches = matches && (upper == sorted + size ? u == a.end() : u != a.end() && *u == *upper);
+				matches = matches && a.contains(key) == std::binary_search(sorted, sorted + size, key);
+			}
+		}
+
+		REQUIRE(matches);
+	}
+
+	SECTION("Find") {
+		int init[5] = {10, 20, 30, 40, 50};
+		a.assign(init, init + 5);
+
+		REQUIRE(*a.find(30) == 30);
+		REQUIRE(a.find(35) == a.end());
+		REQUIRE(!a.contains(60));
+		REQUIRE(*a.lower_bound(25) == 30);
+		REQUIRE(*a.upper_bound(10) == 20);
+		REQUIRE(a.upper_bound(50) == a.end());
+
+		a.clear();
+		REQUIRE(a.find(30) == a.end());
+	}
+
+	SECTION("With a custom comparison") {
+		int init[4] = {4, 3, 2, 1};
+		sstl::eytzinger_array<int, 4, sstl::greater<int> > b(init, init + 4);
+
+		REQUIRE(*b.lower_bound(3) == 3);
+		REQUIRE(*b.upper_bound(3) == 2);
+		REQUIRE(b.upper_bound(1) == b.end());
+		REQUIRE(b.contains(4));
+	}
+}
@@ -0,0 +1,49 @@
+#ifndef STATIC_STL_TEST_FIXTURES_H_
+#define STATIC_STL_TEST_FIXTURES_H_
+
+#include "iterator.h"
+
+/* Each test file gets its own copy of these types, and with it its own live count. */
+namespace {
+/** Element type which is not trivially copyable and tracks live instances. */
+struct Tracked {
+	Tracked(int v = 0) : value(v) { ++live; }
+	Tracked(const Tracked& other) : value(other.value) { ++live; }
+#if __cplusplus >= 201103
+	/** Leaves -1 behind, so tests can tell a move from a copy. */
+	Tracked(Tracked&& other) : value(other.value) { other.value = -1; ++live; }
+#endif
+	~Tracked() { --live; }
+
+	Tracked& operator=(const Tracked& rhs) { value = rhs.value; return *this; }
+#if __cplusplus >= 201103
+	Tracked& operator=(Tracked&& rhs) { value = rhs.value; rhs.value = -1; return *this; }
+#endif
+	bool operator==(const Tracked& rhs) const { return value == rhs.value; }
+
+	int value;
+	static int live;
+};
+
+int Tracked::live = 0;
+
+/** Minimal forward-only iterator over an int array. */
+struct ForwardIterator {
+	typedef sstl::forward_iterator_tag iterator_category;
+	typedef int                        value_type;
+	typedef int*                       pointer;
+	typedef int&                       reference;
+	typedef ptrdiff_t                  difference_type;
+
+	explicit ForwardIterator(int* p) : p_(p) {}
+
+	reference operator*() const { return *p_; }
+	ForwardIterator& operator++() { ++p_; return *this; }
+	bool operator==(const ForwardIterator& rhs) const { return p_ == rhs.p_; }
+	bool operator!=(const ForwardIterator& rhs) const { return p_ != rhs.p_; }
+
+	int* p_;
+};
+} /* namespace */
+
+#endif /* STATIC_STL_TEST_FIXTURES_H_ */
@@ -0,0 +1,253 @@
+#include <string>
+
+#include "catch/catch.hpp"
+
+#include "flat_map.h"
+
+TEST_CASE("Construct a flat map", "[constructor]") {
+	SECTION("Default construct") {
+		sstl::flat_map<int, int, 4> a;
+
+		REQUIRE(a.empty());
+		REQUIRE(a.capacity() == 4);
+		REQUIRE(a.begin() == a.end());
+	}
+
+	SECTION("From an unsorted range with duplicate keys") {
+		sstl::pair<int, char> init[6] = {
+			sstl::make_pair(5, 'e'), sstl::make_pair(1, 'a'), sstl::make_pair(3, 'c'),
+			sstl::make_pair(1, 'a'), sstl::make_pair(4, 'd'), sstl::make_pair(3, 'c')
+		};
+
+		sstl::flat_map<int, char, 8> a(init, init + 6);
+
+		int keys[4] = {1, 3, 4, 5};
+		char values[4] = {'a', 'c', 'd', 'e'};
+		REQUIRE(a.size() == 4);
+		REQUIRE(sstl::equal(a.keys().begin(), a.keys().end(), keys));
+		REQUIRE(sstl::equal(a.values().begin(), a.values().end(), values));
+	}
+
+	SECTION("The first of several equal keys wins") {
+		sstl::pair<int, int> init[64];
+
+		/* Four passes over 16 keys in a scrambled order, each pass mapping to its own value. */
+		for (int i = 0; i < 64; ++i) { init[i] = sstl::make_pair((i * 7) % 16, i / 16); }
+
+		sstl::flat_map<int, int, 16> a(init, init + 64);
+		REQUIRE(a.size() == 16);
+
+		for (int key = 0; key < 16; ++key) { REQUIRE(a.find(key)->second == 0); }
+
+		sstl::flat_map<int, int, 32> b;
+		b.insert(init + 32, init + 64);
+		b.insert(init, init + 16);
+
+		for (int key = 0; key < 16; ++key) { REQUIRE(b.find(key)->second == 2); }
+	}
+
+	SECTION("Duplicates do not take up capacity") {
+		sstl::pair<int, int> init[6] = {
+			sstl::make_pair(2, 0), sstl::make_pair(2, 0), sstl::make_pair(2, 0),
+			sstl::make_pair(1, 0), sstl::make_pair(3, 0), sstl::make_pair(0, 0)
+		};
+
+		sstl::flat_map<int, int, 3> a(init, init + 6);
+
+		int keys[3] = {1, 2, 3};
+		REQUIRE(a.size() == 3);
+		REQUIRE(sstl::equal(a.keys().begin(), a.keys().end(), keys));
+	}
+
+	SECTION("Copy construct through the base class") {
+		sstl::flat_map<int, int, 4> a;
+		a[3] = 30;
+		a[1] = 10;
+		a[2] = 20;
+
+		sstl::flat_map<int, int>& base = a;
+		sstl::flat_map<int, int, 2> b(base);
+		sstl::flat_map<int, int, 4> c(a);
+
+		REQUIRE(b.size() == 2);
+		REQUIRE(b.find(1)->second == 10);
+		REQUIRE(b.find(2)->second == 20);
+		REQUIRE(!b.contains(3));
+		REQUIRE(c == a);
+	}
+}
+
+TEST_CASE("Look up keys in a flat map", "[lookup]") {
+	sstl::flat_map<int, int, 16> a;
+
+	for (int i = 0; i < 10; ++i) { a.insert(sstl::make_pair(i * 2, i)); }
+
+	SECTION("Find present and missing keys") {
+		REQUIRE(a.find(8)->first == 8);
+		REQUIRE(a.find(8)->second == 4);
+		REQUIRE(a.find(9) == a.end());
+		REQUIRE(a.find(-1) == a.end());
+		REQUIRE(a.find(100) == a.end());
+		REQUIRE(a.count(18) == 1);
+		REQUIRE(a.count(19) == 0);
+	}
+
+	SECTION("Lower and upper bounds") {
+		REQUIRE(a.lower_bound(4)->first == 4);
+		REQUIRE(a.upper_bound(4)->first == 6);
+		REQUIRE(a.lower_bound(5)->first == 6);
+		REQUIRE(a.upper_bound(5)->first == 6);
+		REQUIRE(a.lower_bound(-3) == a.begin());
+		REQUIRE(a.upper_bound(18) == a.end());
+	}
+
+	SECTION("Every size of key array") {
+		for (int n = 0; n <= 16; ++n) {
+			sstl::flat_map<int, int, 16> b;
+
+			for (int i = 0; i < n; ++i) { b[i * 2 + 1] = i; }
+
+			for (int key = 0; key <= n * 2 + 1; ++key) {
+				const int expect = key / 2;
+				REQUIRE(b.lower_bound(key) - b.begin() == expect);
+				REQUIRE(b.contains(key) == (key % 2 == 1 && key < n * 2));
+			}
+		}
+	}
+
+	SECTION("Iterate in key order through const iterators") {
+		const sstl::flat_map<int, int>& c = a;
+		int expect = 0;
+
+		for (sstl::flat_map<int, int>::const_iterator it = c.begin(); it != c.end(); ++it) {
+			REQUIRE((*it).first == expect * 2);
+			REQUIRE(it->second == expect);
+			++expect;
+		}
+
+		REQUIRE(expect == 10);
+		REQUIRE((*c.rbegin()).first == 18);
+	}
+}
+
+TEST_CASE("Modify a flat map", "[modifiers]") {
+	sstl::flat_map<int, int, 4> a;
+
+	SECTION("Insert keeps existing values") {
+		REQUIRE(a.insert(sstl::make_pair(2, 20)).second);
+		REQUIRE(a.insert(sstl::make_pair(1, 10)).second);
+
+		sstl::pair<sstl::flat_map<int, int>::iterator, bool> result = a.insert(sstl::make_pair(2, 99));
+		REQUIRE(!result.second);
+		REQUIRE(result.first->second == 20);
+		REQUIRE(a.begin()->first == 1);
+	}
+
+	SECTION("Insert or assign replaces existing values") {
+		REQUIRE(a.insert_or_assign(2, 20).second);
+		REQUIRE(!a.insert_or_assign(2, 99).second);
+		REQUIRE(a[2] == 99);
+	}
+
+	SECTION("Subscript inserts missing keys") {
+		a[7] = 70;
+		a[3] += 5;
+
+		REQUIRE(a.size() == 2);
+		REQUIRE(a[3] == 5);
+		REQUIRE(a.begin()->first == 3);
+	}
+
+	SECTION("Insert into a full map fails") {
+		for (int i = 0; i < 4; ++i) { a[i] = i; }
+
+		REQUIRE(a.insert(sstl::make_pair(9, 9)).first == a.end());
+		REQUIRE(a.insert(sstl::make_pair(1, 9)).first->second == 1);
+		REQUIRE(a.size() == 4);
+	}
+
+	SECTION("Subscript on a full map leaves the elements alone") {
+		sstl::flat_map<int, int, 2> full;
+		full[10] = 1;
+		full[20] = 2;
+		full[5] = 99;
+		REQUIRE(full[6] == 0);
+
+		REQUIRE(full.size() == 2);
+		REQUIRE(full.find(5) == full.end());
+		REQUIRE(full.find(10)->second == 1);
+		REQUIRE(full.find(20)->second == 2);
+	}
+
+	SECTION("Insert a range into a map with elements") {
+		a[4] = 40;
+		a[2] = 20;
+
+		sstl::pair<int, int> more[3] = {
+			sstl::make_pair(3, 30), sstl::make_pair(2, 99), sstl::make_pair(1, 10)
+		};
+		a.insert(more, more + 3);
+
+		int keys[4] = {1, 2, 3, 4};
+		int values[4] = {10, 20, 30, 40};
+		REQUIRE(sstl::equal(a.keys().begin(), a.keys().end(), keys));
+		REQUIRE(sstl::equal(a.values().begin(), a.values().end(), values));
+	}
+
+	SECTION("Erase by key and position") {
+		for (int i = 0; i < 4; ++i) { a[i] = i * 10; }
+
+		REQUIRE(a.erase(2) == 1);
+		REQUIRE(a.erase(2) == 0);
+
+		sstl::flat_map<int, int>::iterator it = a.erase(a.begin());
+		REQUIRE(it->first == 1);
+		REQUIRE(it->second == 10);
+		REQUIRE(a.size() == 2);
+
+		it->second = 11;
+		REQUIRE(a[1] == 11);
+	}
+
+#if __cplusplus >= 201103
+	SECTION("Emplace a value in place") {
+		REQUIRE(a.try_emplace(5, 50).second);
+		REQUIRE(!a.try_emplace(5, 51).second);
+		REQUIRE(a[5] == 50);
+	}
+#endif
+}
+
+#if __cplusplus >= 201103
+TEST_CASE("Erase an empty range from a flat map of strings", "[modifiers]") {
+	sstl::flat_map<int, std::string, 4> a;
+	a[1] = "one";
+	a[2] = "two";
+	a[3] = "three";
+
+	REQUIRE(a.erase(a.begin(), a.begin()) == a.begin());
+
+	REQUIRE(a.size() == 3);
+	REQUIRE(a[1] == "one");
+	REQUIRE(a[2] == "two");
+	REQUIRE(a[3] == "three");
+}
+
+/** Reads through the size-erased base, so nothing here can be folded at compile time. */
+static size_t read_capacity(const sstl::flat_map<int, int>& m) { return m.capacity(); }
+
+extern sstl::flat_map<int, int, 16> constant_map;
+
+/**
+	Dynamically initialized before constant_map is defined, so it only sees
+	the map's capacity if the map was constant initialized.
+*/
+static const size_t constant_map_seen = read_capacity(constant_map);
+
+sstl::flat_map<int, int, 16> constant_map;
+
+TEST_CASE("Constant initialize a flat map", "[constructor]") {
+	REQUIRE(constant_map_seen == 16);
+	REQUIRE(constant_map.empty());
+}
+#endif
@@ -0,0 +1,128 @@
+#include "catch/catch.hpp"
+
+#include "flat_set.h"
+
+namespace {
+/** Orders pairs by their first member only, so equal keys can still be told apart. */
+struct by_first {
+	bool operator()(const sstl::pair<int, int>& lhs, const sstl::pair<int, int>& rhs) const {
+		return lhs.first < rhs.first;
+	}
+};
+} /* namespace */
+
+TEST_CASE("Construct a flat set", "[constructor]") {
+	SECTION("Default construct") {
+		sstl::flat_set<int, 4> a;
+
+		REQUIRE(a.empty());
+		REQUIRE(a.capacity() == 4);
+	}
+
+	SECTION("From an unsorted range with duplicates") {
+		int init[7] = {5, 1, 3, 1, 4, 3, 5};
+		sstl::flat_set<int, 8> a(init, init + 7);
+
+		int expect[4] = {1, 3, 4, 5};
+		REQUIRE(a.size() == 4);
+		REQUIRE(sstl::equal(a.begin(), a.end(), expect));
+	}
+
+	SECTION("The first of several equal keys wins") {
+		sstl::pair<int, int> init[40];
+
+		for (int i = 0; i < 40; ++i) { init[i] = sstl::make_pair((i * 3) % 20, i / 20); }
+
+		sstl::flat_set<sstl::pair<int, int>, 20, by_first> a(init, init + 40);
+		REQUIRE(a.size() == 20);
+
+		for (int i = 0; i < 20; ++i) { REQUIRE(a.begin()[i].second == 0); }
+	}
+
+	SECTION("From a sorted range") {
+		int init[4] = {1, 2, 3, 4};
+		sstl::flat_set<int, 4> a(init, init + 4);
+
+		REQUIRE(sstl::equal(a.begin(), a.end(), init));
+	}
+
+	SECTION("Copy construct through the base class") {
+		int init[3] = {3, 1, 2};
+		sstl::flat_set<int, 4> a(init, init + 3);
+		sstl::flat_set<int>& base = a;
+		sstl::flat_set<int, 2> b(base);
+		sstl::flat_set<int, 4> c(a);
+
+		int expect[2] = {1, 2};
+		REQUIRE(b.size() == 2);
+		REQUIRE(sstl::equal(b.begin(), b.end(), expect));
+		REQUIRE(c == a);
+	}
+
+	SECTION("With a custom comparison") {
+		int init[4] = {2, 4, 1, 3};
+		sstl::flat_set<int, 4, sstl::greater<int> > a(init, init + 4);
+
+		int expect[4] = {4, 3, 2, 1};
+		REQUIRE(sstl::equal(a.begin(), a.end(), expect));
+		REQUIRE(*a.lower_bound(3) == 3);
+		REQUIRE(*a.upper_bound(3) == 2);
+	}
+}
+
+TEST_CASE("Look up keys in a flat set", "[lookup]") {
+	int init[5] = {10, 20, 30, 40, 50};
+	const sstl::flat_set<int, 8> a(init, init + 5);
+
+	REQUIRE(a.contains(30));
+	REQUIRE(!a.contains(35));
+	REQUIRE(a.count(50) == 1);
+	REQUIRE(a.find(10) == a.begin());
+	REQUIRE(a.find(60) == a.end());
+	REQUIRE(*a.lower_bound(25) == 30);
+	REQUIRE(*a.upper_bound(30) == 40);
+	REQUIRE(a.upper_bound(50) == a.end());
+	REQUIRE(*a.rbegin() == 50);
+}
+
+TEST_CASE("Modify a flat set", "[modifiers]") {
+	sstl::flat_set<int, 4> a;
+
+	SECTION("Insert keeps the keys sorted and unique") {
+		REQUIRE(a.insert(3).second);
+		REQUIRE(a.insert(1).second);
+		REQUIRE(!a.insert(3).second);
+		REQUIRE(*a.insert(2).first == 2);
+
+		int expect[3] = {1, 2, 3};
+		REQUIRE(sstl::equal(a.begin(), a.end(), expect));
+	}
+
+	SECTION("Insert into a full set fails") {
+		for (int i = 0; i < 4; ++i) { a.insert(i); }
+
+		REQUIRE(a.insert(9).first == a.end());
+		REQUIRE(!a.insert(2).second);
+		REQUIRE(a.size() == 4);
+	}
+
+	SECTION("Insert a range into a set with elements") {
+		a.insert(4);
+		a.insert(2);
+
+		int more[4] = {3, 2, 1, 3};
+		a.insert(more, more + 4);
+
+		int expect[4] = {1, 2, 3, 4};
+		REQUIRE(sstl::equal(a.begin(), a.end(), expect));
+	}
+
+	SECTION("Erase by key and position") {
+		for (int i = 0; i < 4; ++i) { a.insert(i); }
+
+		REQUIRE(a.erase(2) == 1);
+		REQUIRE(a.erase(2) == 0);
+		REQUIRE(*a.erase(a.begin()) == 1);
+		REQUIRE(a.size() == 2);
+	}
+}
@@ -0,0 +1,26 @@
+#include "catch/catch.hpp"
+
+#include "functional.h"
+
+TEST_CASE("Compare values with function objects", "[comparison]") {
+	REQUIRE(sstl::less<int>()(1, 2));
+	REQUIRE(!sstl::less<int>()(2, 2));
+	REQUIRE(sstl::greater<int>()(2, 1));
+	REQUIRE(!sstl::greater<int>()(2, 2));
+	REQUIRE(sstl::equal_to<int>()(2, 2));
+	REQUIRE(!sstl::equal_to<int>()(1, 2));
+}
+
+TEST_CASE("Hash floating-point values", "[hash]") {
+	SECTION("Values below one hash apart") {
+		REQUIRE(sstl::hash<float>()(0.25f) != sstl::hash<float>()(0.5f));
+		REQUIRE(sstl::hash<double>()(0.25) != sstl::hash<double>()(0.5));
+		REQUIRE(sstl::hash<double>()(-1.5) != sstl::hash<double>()(1.5));
+	}
+
+	SECTION("Zeros of either sign hash alike") {
+		REQUIRE(sstl::hash<float>()(-0.0f) == sstl::hash<float>()(0.0f));
+		REQUIRE(sstl::hash<double>()(-0.0) == sstl::hash<double>()(0.0));
+		REQUIRE(sstl::hash<long double>()(-0.0L) == sstl::hash<long double>()(0.0L));
+	}
+}
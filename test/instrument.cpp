@@ -0,0 +1,126 @@
+/* Built into its own executable with SSTL_INSTRUMENT=1, see the Makefile. */
+#include <stdio.h>
+#include <string.h>
+
+#include "catch/catch.hpp"
+
+#include "instrument.h"
+#include "list.h"
+#include "vector.h"
+
+#if !SSTL_INSTRUMENT
+#error "test/instrument.cpp must be built with -DSSTL_INSTRUMENT=1"
+#endif
+
+namespace {
+struct Sample {
+	Sample(int v = 0) : value(v) {}
+
+	int value;
+};
+
+bool registered(const sstl::container_stats& stats) {
+	for (const sstl::container_stats* s = sstl::container_stats::first(); s; s = s->next()) {
+		if (s == &stats) { return true; }
+	}
+
+	return false;
+}
+}
+
+TEST_CASE("Instrument a vector", "[instrument]") {
+	sstl::vector<Sample, 4> v;
+	v.stats().name = "samples";
+
+	SECTION("Registers on the first modification") {
+		REQUIRE(!registered(v.stats()));
+
+		v.push_back(Sample(1));
+
+		REQUIRE(registered(v.stats()));
+		REQUIRE(strcmp(v.stats().type, "vector") == 0);
+		REQUIRE(v.stats().capacity == 4);
+	}
+
+	SECTION("Counts dropped elements and the high-water mark") {
+		for (int i = 0; i < 6; ++i) { v.push_back(Sample(i)); }
+
+		v.pop_back();
+
+		REQUIRE(v.stats().drops == 2);
+		REQUIRE(v.stats().high_water == 4);
+		REQUIRE(v.stats().size == 3);
+		REQUIRE(v.stats().operations == 7);
+
+		v.resize(10);
+		REQUIRE(v.stats().drops == 8);
+
+		Sample more[3];
+		v.clear();
+		v.insert(v.begin(), more, more + 3);
+		v.insert(v.begin(), 3, Sample(7));
+		REQUIRE(v.stats().drops == 10);
+	}
+
+	SECTION("Counts elements shifted by insert and erase") {
+		for (int i = 0; i < 3; ++i) { v.push_back(Sample(i)); }
+
+		v.insert(v.begin(), Sample(9));
+		REQUIRE(v.stats().moves == 3);
+
+		v.erase(v.begin() + 1);
+		REQUIRE(v.stats().moves == 5);
+
+		v.erase(v.end() - 1);
+		REQUIRE(v.stats().moves == 5);
+	}
+
+	SECTION("Copies have their own counters") {
+		v.push_back(Sample(1));
+		sstl::vector<Sample, 4> copy(v);
+
+		REQUIRE(copy.stats().operations == 0);
+		REQUIRE(!copy.stats().name);
+	}
+}
+
+TEST_CASE("Instrument a list", "[instrument]") {
+	sstl::list<Sample, 2> l;
+
+	for (int i = 0; i < 3; ++i) { l.push_back(Sample(i)); }
+
+	l.pop_front();
+
+	REQUIRE(strcmp(l.stats().type, "list") == 0);
+	REQUIRE(l.stats().drops == 1);
+	REQUIRE(l.stats().high_water == 2);
+	REQUIRE(l.stats().size == 1);
+	REQUIRE(l.stats().moves == 0);
+}
+
+TEST_CASE("Dump the instrumented containers", "[instrument]") {
+	FILE* out = tmpfile();
+	REQUIRE(out);
+
+	{
+		sstl::vector<Sample, 8> v;
+		v.stats().name = "dumped";
+		v.push_back(Sample(1));
+
+		sstl::dump_container_stats(out);
+	}
+
+	/* Destroyed containers leave the registry. */
+	for (const sstl::container_stats* s = sstl::container_stats::first(); s; s = s->next()) {
+		REQUIRE(!(s->name && strcmp(s->name, "dumped") == 0));
+	}
+
+	char text[4096] = {};
+	rewind(out);
+	const size_t length = fread(text, 1, sizeof(text) - 1, out);
+	fclose(out);
+
+	REQUIRE(length > 0);
+	REQUIRE(strstr(text, "dumped"));
+	REQUIRE(strstr(text, "vector"));
+}
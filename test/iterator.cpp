@@ -2,6 +2,8 @@
 
 #include "iterator.h"
 
+#include "fixtures.h"
+
 TEST_CASE("Get the distance between two iterators", "[comparison]") {
 	const size_t count = 3;
 	int a[count];
@@ -11,3 +13,61 @@ TEST_CASE("Get the distance between two iterators", "[comparison]") {
 	REQUIRE(sstl::distance(sstl::reverse_iterator<int*>(&a[count]),
 	                       sstl::reverse_iterator<int*>(&a[0])) == count);
 }
+
+TEST_CASE("Get the distance between forward iterators", "[comparison]") {
+	const size_t count = 3;
+	int a[count];
+
+	REQUIRE(sstl::distance(ForwardIterator(a), ForwardIterator(a)) == 0);
+	REQUIRE(sstl::distance(ForwardIterator(&a[0]),
+	                       ForwardIterator(&a[count])) == count);
+}
+
+TEST_CASE("Move an iterator by a number of elements", "[advance]") {
+	const size_t count = 4;
+	int a[count] = {0, 1, 2, 3};
+
+	SECTION("Advance a random access iterator") {
+		int* it = a;
+
+		sstl::advance(it, 3);
+		REQUIRE(*it == 3);
+
+		sstl::advance(it, -2);
+		REQUIRE(*it == 1);
+	}
+
+	SECTION("Advance a forward iterator") {
+		ForwardIterator it(a);
+
+		sstl::advance(it, 2);
+		REQUIRE(*it == 2);
+	}
+
+	SECTION("Next and previous iterators") {
+		REQUIRE(*sstl::next(&a[0]) == 1);
+		REQUIRE(*sstl::next(&a[0], 3) == 3);
+		REQUIRE(*sstl::prev(&a[count]) == 3);
+		REQUIRE(*sstl::prev(&a[count], 4) == 0);
+		REQUIRE(*sstl::next(ForwardIterator(a), 2) == 2);
+	}
+
+	SECTION("Reverse iterator arithmetic") {
+		sstl::reverse_iterator<int*> it(&a[count]);
+
+		REQUIRE(*(it + 1) == 2);
+		REQUIRE(*(2 + it) == 1);
+
+		it += 3;
+		REQUIRE(*it == 0);
+
+		it -= 2;
+		REQUIRE(*it == 2);
+
+		REQUIRE(*it++ == 2);
+		REQUIRE(*it-- == 1);
+		REQUIRE(*it == 2);
+
+		REQUIRE(sstl::reverse_iterator<int*>(&a[0]) - it == 3);
+	}
+}
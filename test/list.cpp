@@ -0,0 +1,249 @@
+#include "catch/catch.hpp"
+
+#include "list.h"
+
+#include "fixtures.h"
+
+namespace {
+template<class List>
+bool holds(const List& l, const int* expect, size_t count) {
+	return l.size() == count && sstl::equal(l.begin(), l.end(), expect);
+}
+
+bool above_one(int value) { return value > 1; }
+}
+
+TEST_CASE("Construct a list", "[constructor]") {
+	SECTION("Default construct") {
+		sstl::list<int, 4> l;
+
+		REQUIRE(l.empty());
+		REQUIRE(l.max_size() == 4);
+		REQUIRE(l.begin() == l.end());
+	}
+
+	SECTION("From a range, keeping the first N values") {
+		int init[6] = {1, 2, 3, 4, 5, 6};
+		sstl::list<int, 4> l(init, init + 6);
+
+		REQUIRE(holds(l, init, 4));
+		REQUIRE(l.full());
+	}
+
+	SECTION("From count copies of a value") {
+		sstl::list<int, 4> l(3, 7);
+		int expect[3] = {7, 7, 7};
+
+		REQUIRE(holds(l, expect, 3));
+	}
+
+	SECTION("Copy through the base class") {
+		int init[3] = {1, 2, 3};
+		sstl::list<int, 4> a(init, init + 3);
+		sstl::list<int, 4> b(a);
+		sstl::list<int, 8> c;
+		sstl::list<int>& base = c;
+		base = a;
+
+		REQUIRE(holds(b, init, 3));
+		REQUIRE(holds(c, init, 3));
+		REQUIRE(a == c);
+	}
+
+	SECTION("Links by the smallest index type") {
+		REQUIRE(sizeof(sstl::list<int, 100>::index_type) == 2);
+		REQUIRE(sizeof(sstl::list<int, 65535>::index_type) == 2);
+		REQUIRE(sizeof(sstl::list<int, 65536>::index_type) == 4);
+#if !SSTL_INSTRUMENT
+		REQUIRE(sizeof(sstl::list<int, 100>) == 12 + 100 * 8);
+#endif
+	}
+}
+
+TEST_CASE("Insert and erase list elements", "[modifiers]") {
+	sstl::list<int, 5> l;
+
+	SECTION("Push and pop at both ends") {
+		l.push_back(2);
+		l.push_front(1);
+		l.push_back(3);
+
+		int expect[3] = {1, 2, 3};
+		REQUIRE(holds(l, expect, 3));
+		REQUIRE(l.front() == 1);
+		REQUIRE(l.back() == 3);
+
+		l.pop_front();
+		l.pop_back();
+		REQUIRE(l.size() == 1);
+		REQUIRE(l.front() == 2);
+	}
+
+	SECTION("Insert in the middle") {
+		int init[3] = {1, 3, 5};
+		l.assign(init, init + 3);
+
+		sstl::list<int, 5>::iterator it = l.insert(++l.begin(), 2);
+		REQUIRE(*it == 2);
+		l.insert(--l.end(), 4);
+
+		int expect[5] = {1, 2, 3, 4, 5};
+		REQUIRE(holds(l, expect, 5));
+	}
+
+	SECTION("Inserting into a full list does nothing") {
+		l.assign(5, 1);
+
+		REQUIRE(l.insert(l.begin(), 9) == l.begin());
+		l.push_back(9);
+		REQUIRE(l.size() == 5);
+		REQUIRE(l.back() == 1);
+	}
+
+	SECTION("Erase elements and reuse their nodes") {
+		int init[5] = {1, 2, 3, 4, 5};
+		l.assign(init, init + 5);
+
+		sstl::list<int, 5>::iterator it = l.erase(++l.begin());
+		REQUIRE(*it == 3);
+		it = l.erase(it, --l.end());
+		REQUIRE(*it == 5);
+
+		l.push_back(6);
+		l.push_back(7);
+		l.push_front(0);
+
+		int expect[5] = {0, 1, 5, 6, 7};
+		REQUIRE(holds(l, expect, 5));
+	}
+
+	SECTION("Iterate in reverse") {
+		int init[4] = {1, 2, 3, 4};
+		l.assign(init, init + 4);
+
+		int expect[4] = {4, 3, 2, 1};
+		REQUIRE(sstl::equal(l.rbegin(), l.rend(), expect));
+	}
+
+	SECTION("Resize") {
+		l.resize(3, 8);
+		l.resize(2);
+		l.resize(4);
+
+		int expect[4] = {8, 8, 0, 0};
+		REQUIRE(holds(l, expect, 4));
+	}
+}
+
+TEST_CASE("Splice lists", "[operations]") {
+	int init[4] = {1, 2, 3, 4};
+	sstl::list<int, 8> a(init, init + 4);
+
+	SECTION("Move an element within a list") {
+		a.splice(a.begin(), a, --a.end());
+
+		int expect[4] = {4, 1, 2, 3};
+		REQUIRE(holds(a, expect, 4));
+	}
+
+	SECTION("Move a range within a list") {
+		sstl::list<int, 8>::iterator first = ++a.begin();
+		a.splice(a.end(), a, first, --a.end());
+
+		int expect[4] = {1, 4, 2, 3};
+		REQUIRE(holds(a, expect, 4));
+	}
+
+	SECTION("Move between lists of different sizes through the base class") {
+		int other[3] = {7, 8, 9};
+		sstl::list<int, 3> b(other, other + 3);
+		sstl::list<int>& from = b;
+		sstl::list<int>& to = a;
+
+		to.splice(++to.begin(), from, ++from.begin());
+		int expect_a[5] = {1, 8, 2, 3, 4};
+		int expect_b[2] = {7, 9};
+		REQUIRE(holds(a, expect_a, 5));
+		REQUIRE(holds(b, expect_b, 2));
+
+		to.splice(to.end(), from);
+		int expect_all[7] = {1, 8, 2, 3, 4, 7, 9};
+		REQUIRE(holds(a, expect_all, 7));
+		REQUIRE(b.empty());
+
+		from.splice(from.begin(), to);
+		REQUIRE(holds(b, expect_all, 3));
+		REQUIRE(holds(a, expect_all + 3, 4));
+	}
+}
+
+TEST_CASE("List operations", "[operations]") {
+	int init[6] = {1, 2, 1, 3, 1, 4};
+	sstl::list<int, 8> l(init, init + 6);
+
+	SECTION("Remove equal elements") {
+		l.remove(1);
+
+		int expect[3] = {2, 3, 4};
+		REQUIRE(holds(l, expect, 3));
+	}
+
+	SECTION("Remove an element equal to itself") {
+		l.remove(l.front());
+
+		int expect[3] = {2, 3, 4};
+		REQUIRE(holds(l, expect, 3));
+	}
+
+	SECTION("Remove by a predicate") {
+		l.remove_if(above_one);
+
+		int expect[3] = {1, 1, 1};
+		REQUIRE(holds(l, expect, 3));
+	}
+
+	SECTION("Reverse") {
+		l.reverse();
+
+		int expect[6] = {4, 1, 3, 1, 2, 1};
+		REQUIRE(holds(l, expect, 6));
+		REQUIRE(l.back() == 1);
+		REQUIRE(*--l.end() == 1);
+	}
+
+	SECTION("Compare") {
+		sstl::list<int, 6> same(init, init + 6);
+		sstl::list<int, 6> greater(init + 1, init + 6);
+
+		REQUIRE(l == same);
+		REQUIRE(l != greater);
+		REQUIRE(l < greater);
+	}
+}
+
+#if __cplusplus >= 201103
+TEST_CASE("Move non-trivial elements between lists", "[modifiers]") {
+	{
+		sstl::list<Tracked, 4> a;
+		sstl::list<Tracked, 4> b;
+
+		a.emplace_back(1);
+		a.emplace_front(0);
+		a.emplace(a.end(), 2);
+		a.erase(a.begin());
+		REQUIRE(Tracked::live == 2);
+
+		b.splice(b.end(), a);
+		REQUIRE(a.empty());
+		REQUIRE(b.front().value == 1);
+		REQUIRE(b.back().value == 2);
+		REQUIRE(Tracked::live == 2);
+
+		sstl::list<Tracked, 4> c(sstl::move(b));
+		REQUIRE(c.size() == 2);
+		REQUIRE(b.empty());
+	}
+
+	REQUIRE(Tracked::live == 0);
+}
+#endif
@@ -4,6 +4,7 @@
 #include "memory.h"
 #include "type_traits.h"
 
+namespace {
 struct Foo {
 	Foo() : value(48) {}
 	explicit Foo(int v) : value(v) {}
@@ -13,6 +14,7 @@ struct Foo {
 
 	volatile int value;
 };
+}
 
 TEST_CASE("Copy elements into uninitialized memory", "[uninitialized]") {
 	const size_t count = 4;
@@ -76,6 +78,61 @@ TEST_CASE("Fill uninitialized memory with value", "[uninitialized]") {
 	}
 }
 
+TEST_CASE("Move elements into uninitialized memory", "[uninitialized]") {
+	const size_t count = 4;
+
+	sstl::aligned_storage<sizeof(Foo), sstl::alignment_of<Foo>::value>::type
+	memory[count];
+
+	Foo* dest = reinterpret_cast<Foo*>(memory);
+
+	Foo source[count];
+	source[0].value = 2;
+	source[1].value = 4;
+	source[2].value = 8;
+	source[3].value = 16;
+
+	SECTION("Move range of elements") {
+		REQUIRE(sstl::uninitialized_move(source, source + count, dest) ==
+		        dest + count);
+
+		REQUIRE(sstl::equal(dest, dest + count, source));
+	}
+
+	SECTION("Move n elements") {
+		REQUIRE(sstl::uninitialized_move_n(source, count, dest) == dest + count);
+
+		REQUIRE(sstl::equal(dest, dest + count, source));
+	}
+}
+
+TEST_CASE("Copy and fill trivial types in uninitialized memory", "[uninitialized]") {
+	const size_t count = 4;
+
+	sstl::aligned_storage<sizeof(int), sstl::alignment_of<int>::value>::type
+	memory[count];
+
+	int* dest = reinterpret_cast<int*>(memory);
+
+	SECTION("Copy n elements") {
+		const int source[count] = {2, 4, 8, 16};
+
+		REQUIRE(sstl::uninitialized_copy_n(source, count, dest) == dest + count);
+
+		REQUIRE(sstl::equal(dest, dest + count, source));
+	}
+
+	SECTION("Fill bytes") {
+		char* bytes = reinterpret_cast<char*>(memory);
+		const size_t size = sizeof(memory);
+
+		REQUIRE(sstl::uninitialized_fill_n(bytes, size, 'z') == bytes + size);
+
+		REQUIRE(bytes[0] == 'z');
+		REQUIRE(bytes[size - 1] == 'z');
+	}
+}
+
 TEST_CASE("Default construct in uninitialized memory", "[uninitialized]") {
 	const size_t count = 4;
 
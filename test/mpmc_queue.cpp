@@ -0,0 +1,150 @@
+#include "catch/catch.hpp"
+
+#include "mpmc_queue.h"
+
+#include "fixtures.h"
+
+#if __cplusplus >= 201103
+#include <atomic>
+#include <thread>
+
+TEST_CASE("Push and pop values on a multi-producer/multi-consumer queue", "[modifiers]") {
+	sstl::mpmc_queue<int, 4> q;
+	int value = -1;
+
+	SECTION("Starts empty") {
+		REQUIRE(q.empty());
+		REQUIRE(q.capacity() == 4);
+		REQUIRE(!q.try_pop(value));
+	}
+
+	SECTION("First in, first out across the wrap point") {
+		for (int i = 0; i < 10; ++i) {
+			REQUIRE(q.try_push(i));
+			REQUIRE(q.try_push(i + 100));
+			REQUIRE(q.try_pop(value));
+			REQUIRE(value == i);
+			REQUIRE(q.try_pop(value));
+			REQUIRE(value == i + 100);
+		}
+
+		REQUIRE(q.empty());
+	}
+
+	SECTION("Pushing to a full queue fails") {
+		for (int i = 0; i < 4; ++i) { REQUIRE(q.try_push(i)); }
+
+		REQUIRE(!q.try_push(4));
+		REQUIRE(q.size() == 4);
+		REQUIRE(q.try_pop(value));
+		REQUIRE(value == 0);
+		REQUIRE(q.try_push(4));
+	}
+
+	SECTION("Capacity is a power of two of at least two") {
+		sstl::mpmc_queue<int, 5> a;
+		sstl::mpmc_queue<int, 1> b;
+		sstl::mpmc_queue<int>& c = a;
+
+		REQUIRE(a.capacity() == 8);
+		REQUIRE(b.capacity() == 2);
+		REQUIRE(c.max_size() == 8);
+	}
+}
+
+TEST_CASE("Push and pop batches on a multi-producer/multi-consumer queue", "[modifiers]") {
+	sstl::mpmc_queue<int, 8> q;
+	int in[8] = {0, 1, 2, 3, 4, 5, 6, 7};
+	int out[8] = {};
+
+	REQUIRE(q.try_push(in, 5) == 5);
+	REQUIRE(q.try_pop(out, 3) == 3);
+	REQUIRE(out[2] == 2);
+
+	SECTION("A batch wraps around the end of the storage") {
+		REQUIRE(q.try_push(in, 8) == 6);
+		REQUIRE(q.try_pop(out, 8) == 8);
+
+		int expect[8] = {3, 4, 0, 1, 2, 3, 4, 5};
+		REQUIRE(sstl::equal(out, out + 8, expect));
+		REQUIRE(q.empty());
+	}
+
+	SECTION("Popping more than is queued") {
+		REQUIRE(q.try_pop(out, 8) == 2);
+		REQUIRE(out[0] == 3);
+		REQUIRE(out[1] == 4);
+		REQUIRE(q.try_pop(out, 8) == 0);
+	}
+}
+
+TEST_CASE("Destroy non-trivial values in a multi-producer/multi-consumer queue", "[modifiers]") {
+	{
+		sstl::mpmc_queue<Tracked, 4> q;
+		Tracked out;
+
+		q.try_push(Tracked(1));
+		q.try_emplace(2);
+		q.try_emplace(3);
+
+		REQUIRE(Tracked::live == 4);
+		REQUIRE(q.try_pop(out));
+		REQUIRE(out.value == 1);
+		REQUIRE(Tracked::live == 3);
+	}
+
+	REQUIRE(Tracked::live == 0);
+}
+
+TEST_CASE("Pass values between several threads", "[concurrency]") {
+	static sstl::mpmc_queue<unsigned, 64> q;
+	const unsigned producers = 3;
+	const unsigned consumers = 3;
+	const unsigned per_producer = 20000;
+	std::atomic<unsigned long long> sum(0);
+	std::atomic<unsigned> received(0);
+	std::thread threads[producers + consumers];
+
+	for (unsigned p = 0; p < producers; ++p) {
+		threads[p] = std::thread([p] {
+			unsigned batch[4];
+
+			for (unsigned i = 0; i < per_producer;) {
+				unsigned count = 0;
+
+				for (; count < 4 && i + count < per_producer; ++count) {
+					batch[count] = p * per_producer + i + count + 1;
+				}
+
+				const size_t pushed = p % 2 ? q.try_push(batch, count) : q.try_push(batch[0]);
+				i += unsigned(pushed);
+
+				if (!pushed) { std::this_thread::yield(); }
+			}
+		});
+	}
+
+	for (unsigned c = 0; c < consumers; ++c) {
+		threads[producers + c] = std::thread([&] {
+			unsigned batch[4];
+
+			while (received.load() < producers * per_producer) {
+				const size_t popped = q.try_pop(batch, 4);
+
+				for (size_t i = 0; i < popped; ++i) { sum += batch[i]; }
+
+				received += unsigned(popped);
+
+				if (!popped) { std::this_thread::yield(); }
+			}
+		});
+	}
+
+	for (unsigned t = 0; t < producers + consumers; ++t) { threads[t].join(); }
+
+	const unsigned long long total = producers * per_producer;
+	REQUIRE(received.load() == total);
+	REQUIRE(sum.load() == total * (total + 1) / 2);
+	REQUIRE(q.empty());
+}
+#endif
@@ -0,0 +1,212 @@
+#include "catch/catch.hpp"
+
+#include "object_pool.h"
+#include "utility.h"
+
+#include "fixtures.h"
+
+typedef sstl::object_pool<int> int_pool_base;
+
+TEST_CASE("Construct objects in a pool", "[modifiers]") {
+	sstl::object_pool<int, 4> pool;
+
+	REQUIRE(pool.empty());
+	REQUIRE(pool.max_size() == 4);
+
+	SECTION("Until the pool is full") {
+		int* a = pool.construct(1);
+		int* b = pool.construct(2);
+		int* c = pool.construct(3);
+		int* d = pool.construct(4);
+
+		REQUIRE(*a == 1);
+		REQUIRE(*d == 4);
+		REQUIRE(b != c);
+		REQUIRE(pool.full());
+		REQUIRE(pool.construct(5) == 0);
+		REQUIRE(pool.size() == 4);
+	}
+
+	SECTION("Reuse the most recently freed slot first") {
+		int* a = pool.construct(1);
+		int* b = pool.construct(2);
+		pool.construct(3);
+
+		pool.destroy(a);
+		pool.destroy(b);
+
+		REQUIRE(pool.size() == 1);
+		REQUIRE(pool.construct(20) == b);
+		REQUIRE(pool.construct(10) == a);
+		REQUIRE(*a == 10);
+		REQUIRE(*b == 20);
+	}
+
+	SECTION("Through the base class") {
+		int_pool_base& base = pool;
+		int* a = base.construct(7);
+
+		REQUIRE(base.size() == 1);
+		REQUIRE(base.max_size() == 4);
+		REQUIRE(base.contains(a));
+
+		base.destroy(a);
+
+		REQUIRE(base.empty());
+		REQUIRE(!base.contains(a));
+	}
+}
+
+TEST_CASE("Refer to pooled objects by handle", "[lookup]") {
+	sstl::object_pool<int, 40> pool;
+	int* a = pool.construct(1);
+	int* b = pool.construct(2);
+
+	const int_pool_base::handle_type h = pool.handle(b);
+
+	REQUIRE(h == 1);
+	REQUIRE(pool.get(h) == b);
+	REQUIRE(pool.handle(a) == 0);
+
+	SECTION("Handles of destroyed objects are invalid") {
+		pool.destroy(b);
+
+		REQUIRE(pool.get(h) == 0);
+		REQUIRE(pool.handle(b) == int_pool_base::invalid_handle);
+	}
+
+	SECTION("Pointers from outside the pool have no handle") {
+		int outside = 0;
+
+		REQUIRE(pool.handle(&outside) == int_pool_base::invalid_handle);
+		REQUIRE(pool.handle(0) == int_pool_base::invalid_handle);
+		REQUIRE(pool.get(40) == 0);
+		REQUIRE(pool.get(int_pool_base::invalid_handle) == 0);
+	}
+
+	SECTION("Pointers into the middle of an object have no handle") {
+		typedef sstl::pair<int, int> value;
+		sstl::object_pool<value, 4> pairs;
+		pairs.construct(sstl::make_pair(1, 2));
+		value* second = pairs.construct(sstl::make_pair(3, 4));
+		const value* inside = reinterpret_cast<const value*>(&second->second);
+
+		REQUIRE(pairs.handle(second) == 1);
+		REQUIRE(pairs.handle(inside) == sstl::object_pool<value>::invalid_handle);
+		REQUIRE(!pairs.contains(inside));
+	}
+
+	SECTION("Destroying a stale pointer twice is ignored") {
+		pool.destroy(a);
+		pool.destroy(a);
+
+		REQUIRE(pool.size() == 1);
+		REQUIRE(pool.construct(3) == a);
+		REQUIRE(pool.construct(4) != a);
+	}
+}
+
+TEST_CASE("Destroy pooled objects", "[modifiers]") {
+	Tracked::live = 0;
+
+	SECTION("One at a time") {
+		sstl::object_pool<Tracked, 8> pool;
+		Tracked* a = pool.construct(Tracked(1));
+
+		REQUIRE(Tracked::live == 1);
+
+		pool.destroy(a);
+
+		REQUIRE(Tracked::live == 0);
+	}
+
+	SECTION("All at once, across several words of liveness bits") {
+		sstl::object_pool<Tracked, 100> pool;
+		Tracked* objects[100];
+
+		for (int i = 0; i < 100; ++i) { objects[i] = pool.construct(Tracked(i)); }
+
+		for (int i = 0; i < 100; i += 3) { pool.destroy(objects[i]); }
+
+		REQUIRE(Tracked::live == 66);
+
+		pool.clear();
+
+		REQUIRE(Tracked::live == 0);
+		REQUIRE(pool.empty());
+		REQUIRE(pool.construct(Tracked(5)) == objects[0]);
+	}
+
+	SECTION("When the pool goes out of scope") {
+		{
+			sstl::object_pool<Tracked, 8> pool;
+			pool.construct(Tracked(1));
+			pool.construct(Tracked(2));
+		}
+
+		REQUIRE(Tracked::live == 0);
+	}
+
+	SECTION("Trivially destructible objects") {
+		sstl::object_pool<int, 8> pool;
+
+		for (int i = 0; i < 8; ++i) { pool.construct(i); }
+
+		pool.clear();
+
+		REQUIRE(pool.empty());
+		REQUIRE(pool.get(0) == 0);
+		REQUIRE(*pool.construct(9) == 9);
+	}
+}
+
+#if SSTL_POOL_POISON
+TEST_CASE("Poison freed slots", "[modifiers]") {
+	sstl::object_pool<uint64_t, 4> pool;
+	uint64_t* a = pool.construct(uint64_t(1));
+	pool.construct(uint64_t(2));
+
+	pool.destroy(a);
+
+	/* The free list link overwrites the low bytes, everything after it keeps the poison. */
+	const unsigned char* bytes = reinterpret_cast<const unsigned char*>(a);
+
+	REQUIRE(bytes[sizeof(uint64_t) - 1] == SSTL_POOL_POISON_BYTE);
+}
+#endif
+
+#if __cplusplus >= 201103
+TEST_CASE("Construct pooled objects in place", "[modifiers]") {
+	struct Pair {
+		Pair(int a, int b) : a_(a), b_(b) {}
+
+		int a_;
+		int b_;
+	};
+
+	sstl::object_pool<Pair, 2> pool;
+	Pair* p = pool.construct(1, 2);
+
+	REQUIRE(p->a_ == 1);
+	REQUIRE(p->b_ == 2);
+}
+
+/** Reads through the size-erased base, so nothing here can be folded at compile time. */
+static size_t read_capacity(const sstl::object_pool<int>& pool) { return pool.max_size(); }
+
+extern sstl::object_pool<int, 16> constant_pool;
+
+/**
+	Dynamically initialized before constant_pool is defined, so it only sees
+	the pool's capacity if the pool was constant initialized.
+*/
+static const size_t constant_pool_seen = read_capacity(constant_pool);
+
+sstl::object_pool<int, 16> constant_pool;
+
+TEST_CASE("Constant initialize an object pool", "[constructor]") {
+	REQUIRE(constant_pool_seen == 16);
+	REQUIRE(constant_pool.empty());
+	REQUIRE(constant_pool.construct(3) != 0);
+}
+#endif
@@ -0,0 +1,137 @@
+#include <algorithm>
+
+#include "catch/catch.hpp"
+
+#include "priority_queue.h"
+
+TEST_CASE("Construct a priority queue", "[constructor]") {
+	SECTION("Default construct") {
+		sstl::priority_queue<int, 4> q;
+
+		REQUIRE(q.empty());
+		REQUIRE(q.max_size() == 4);
+		REQUIRE(q.arity == 4);
+	}
+
+	SECTION("Heapify a range") {
+		int init[6] = {3, 9, 1, 7, 5, 8};
+		sstl::priority_queue<int, 8> q(init, init + 6);
+
+		REQUIRE(q.size() == 6);
+		REQUIRE(q.top() == 9);
+	}
+
+	SECTION("Keeps the first N elements") {
+		int init[6] = {3, 1, 2, 9, 8, 7};
+		sstl::priority_queue<int, 3> q(init, init + 6);
+
+		REQUIRE(q.size() == 3);
+		REQUIRE(q.top() == 3);
+	}
+
+	SECTION("Copy through the base class") {
+		int init[3] = {1, 3, 2};
+		sstl::priority_queue<int, 4> a(init, init + 3);
+		sstl::priority_queue<int, 4> b(a);
+		sstl::priority_queue<int, 8> c;
+		sstl::priority_queue<int>& base = c;
+		base = a;
+
+		REQUIRE(b.size() == 3);
+		REQUIRE(b.top() == 3);
+		REQUIRE(c.size() == 3);
+		REQUIRE(c.top() == 3);
+	}
+}
+
+template<size_t Arity>
+bool pops_in_order(int count) {
+	static int data[1000];
+	static sstl::priority_queue<int, 1000, sstl::less<int>, Arity> q;
+	unsigned state = 12345u + unsigned(count);
+
+	for (int i = 0; i < count; ++i) {
+		state = state * 1103515245u + 12345u;
+		data[i] = int(state >> 8) % 64;
+	}
+
+	std::sort(data, data + count);
+
+	/* Pushed one by one, then refilled by heapifying the whole range. */
+	bool matches = true;
+	q.clear();
+
+	for (int i = 0; i < count; ++i) { matches = matches && q.push(data[(i * 7) % count]); }
+
+	for (int i = count; i-- > 0; q.pop()) { matches = matches && q.top() == data[i]; }
+
+	std::reverse(data, data + count);
+	q.assign(data, data + count);
+
+	for (int i = 0; i < count; ++i, q.pop()) { matches = matches && q.top() == data[i]; }
+
+	return matches && q.empty();
+}
+
+TEST_CASE("Push and pop on a priority queue", "[modifiers]") {
+	SECTION("Pops in descending order for every arity") {
+		const int sizes[] = {1, 2, 3, 4, 5, 17, 100, 999};
+		bool matches = true;
+
+		for (int s = 0; s < 8; ++s) {
+			matches = matches && pops_in_order<2>(sizes[s]);
+			matches = matches && pops_in_order<3>(sizes[s]);
+			matches = matches && pops_in_order<4>(sizes[s]);
+			matches = matches && pops_in_order<8>(sizes[s]);
+		}
+
+		REQUIRE(matches);
+	}
+
+	SECTION("Pushing to a full queue fails") {
+		sstl::priority_queue<int, 3> q;
+
+		REQUIRE(q.push(1));
+		REQUIRE(q.push(5));
+		REQUIRE(q.push(3));
+		REQUIRE(q.full());
+		REQUIRE(!q.push(9));
+		REQUIRE(q.top() == 5);
+	}
+
+	SECTION("With a comparison functor") {
+		int init[5] = {4, 2, 8, 6, 1};
+		sstl::priority_queue<int, 5, sstl::greater<int> > q(init, init + 5);
+
+		REQUIRE(q.top() == 1);
+		q.pop();
+		REQUIRE(q.top() == 2);
+	}
+}
+
+#if __cplusplus >= 201103
+namespace {
+struct Task {
+	explicit Task(int p = 0) : priority(p) {}
+	Task(Task&& other) : priority(other.priority) { other.priority = -1; }
+	Task& operator=(Task&& rhs) { priority = rhs.priority; rhs.priority = -1; return *this; }
+
+	bool operator<(const Task& rhs) const { return priority < rhs.priority; }
+
+	int priority;
+};
+}
+
+TEST_CASE("Priority queue of move-only elements", "[modifiers]") {
+	sstl::priority_queue<Task, 4> q;
+
+	REQUIRE(q.push(Task(2)));
+	REQUIRE(q.emplace(7));
+	REQUIRE(q.emplace(5));
+	REQUIRE(q.top().priority == 7);
+	q.pop();
+	REQUIRE(q.top().priority == 5);
+	q.pop();
+	REQUIRE(q.top().priority == 2);
+}
+#endif
@@ -0,0 +1,230 @@
+#include "catch/catch.hpp"
+
+#include "ring_buffer.h"
+
+#include "fixtures.h"
+
+TEST_CASE("Construct a ring buffer", "[constructor]") {
+	SECTION("Default construct") {
+		sstl::ring_buffer<int, 4> a;
+
+		REQUIRE(a.size() == 0);
+		REQUIRE(a.empty());
+		REQUIRE(a.capacity() == 4);
+	}
+
+	SECTION("Capacity is rounded up to a power of two") {
+		sstl::ring_buffer<int, 5> a;
+		sstl::ring_buffer<int, 1> b;
+		sstl::ring_buffer<int>& c = a;
+
+		REQUIRE(a.capacity() == 8);
+		REQUIRE(b.capacity() == 1);
+		REQUIRE(c.max_size() == 8);
+	}
+
+	SECTION("Copy construct across the wrap point") {
+		sstl::ring_buffer<int, 4> a;
+		a.push_back(0);
+		a.push_back(1);
+		a.push_back(2);
+		a.pop_front();
+		a.pop_front();
+		a.push_back(3);
+		a.push_back(4);
+
+		sstl::ring_buffer<int, 4> b(a);
+
+		int expect[3] = {2, 3, 4};
+		REQUIRE(b.size() == 3);
+		REQUIRE(sstl::equal(b.begin(), b.end(), expect));
+	}
+
+	SECTION("From a compatible type") {
+		sstl::ring_buffer<int, 4> a;
+		a.push_back(1);
+		a.push_back(2);
+
+		sstl::ring_buffer<long, 2> b(a);
+
+		REQUIRE(b.size() == 2);
+		REQUIRE(b.front() == 1);
+		REQUIRE(b.back() == 2);
+	}
+}
+
+TEST_CASE("Push and pop values on both ends of a ring buffer", "[modifiers]") {
+	sstl::ring_buffer<int, 4> a;
+
+	SECTION("First in, first out") {
+		for (int i = 0; i < 10; ++i) {
+			a.push_back(i);
+			REQUIRE(a.front() == i);
+			a.pop_front();
+		}
+
+		REQUIRE(a.empty());
+	}
+
+	SECTION("Push to the front") {
+		a.push_front(1);
+		a.push_front(2);
+		a.push_back(3);
+
+		int expect[3] = {2, 1, 3};
+		REQUIRE(a.size() == 3);
+		REQUIRE(sstl::equal(a.begin(), a.end(), expect));
+
+		a.pop_back();
+		a.pop_front();
+
+		REQUIRE(a.size() == 1);
+		REQUIRE(a.front() == 1);
+		REQUIRE(a.back() == 1);
+	}
+
+	SECTION("Pushing to a full buffer is ignored") {
+		for (int i = 0; i < 6; ++i) { a.push_back(i); }
+
+		a.push_front(9);
+
+		int expect[4] = {0, 1, 2, 3};
+		REQUIRE(a.full());
+		REQUIRE(sstl::equal(a.begin(), a.end(), expect));
+	}
+}
+
+TEST_CASE("Iterate over a ring buffer across the wrap point", "[iterator]") {
+	sstl::ring_buffer<int, 8> a;
+
+	for (int i = 0; i < 6; ++i) { a.push_back(i); }
+
+	for (int i = 0; i < 5; ++i) { a.pop_front(); }
+
+	for (int i = 6; i < 12; ++i) { a.push_back(i); }
+
+	const sstl::ring_buffer<int>& c = a;
+
+	SECTION("Random access") {
+		REQUIRE(a.size() == 7);
+		REQUIRE(a.end() - a.begin() == 7);
+
+		for (int i = 0; i < 7; ++i) {
+			REQUIRE(a[i] == i + 5);
+			REQUIRE(a.begin()[i] == i + 5);
+			REQUIRE(*(a.begin() + i) == i + 5);
+		}
+
+		REQUIRE(*(a.end() - 1) == 11);
+		REQUIRE(c.begin() < c.end());
+		REQUIRE(a.begin() == c.cbegin());
+	}
+
+	SECTION("Forward") {
+		int expect = 5;
+
+		for (sstl::ring_buffer<int>::const_iterator it = c.begin(); it != c.end(); ++it) {
+			REQUIRE(*it == expect++);
+		}
+
+		REQUIRE(expect == 12);
+	}
+
+	SECTION("Reverse") {
+		int expect = 11;
+
+		for (sstl::ring_buffer<int>::reverse_iterator it = a.rbegin(); it != a.rend(); ++it) {
+			REQUIRE(*it == expect--);
+		}
+
+		REQUIRE(expect == 4);
+	}
+
+	SECTION("Write through iterators") {
+		sstl::fill(a.begin(), a.end(), 3);
+
+		REQUIRE(a.front() == 3);
+		REQUIRE(a.back() == 3);
+	}
+}
+
+TEST_CASE("Assign and compare ring buffers", "[assignment]") {
+	sstl::ring_buffer<int, 4> a;
+	sstl::ring_buffer<int, 8> b;
+
+	a.push_back(1);
+	a.push_back(2);
+
+	b = a;
+
+	REQUIRE(a == b);
+	REQUIRE(!(a < b));
+
+	b.push_back(3);
+
+	REQUIRE(a != b);
+	REQUIRE(a < b);
+
+	b.push_back(4);
+	b.push_back(5);
+	a = b;
+
+	REQUIRE(a.size() == 4);
+	REQUIRE(a.back() == 4);
+}
+
+TEST_CASE("Destroy non-trivial values in a ring buffer", "[modifiers]") {
+	{
+		sstl::ring_buffer<Tracked, 4> a;
+
+		for (int i = 0; i < 4; ++i) { a.push_back(Tracked(i)); }
+
+		a.pop_front();
+		a.pop_front();
+		a.push_back(Tracked(4));
+
+		REQUIRE(Tracked::live == 3);
+
+		sstl::ring_buffer<Tracked, 4> b(a);
+
+		REQUIRE(Tracked::live == 6);
+		REQUIRE(b.front().value == 2);
+		REQUIRE(b.back().value == 4);
+
+		b.clear();
+
+		REQUIRE(Tracked::live == 3);
+	}
+
+	REQUIRE(Tracked::live == 0);
+}
+
+#if __cplusplus >= 201103
+namespace {
+/** Move-only type which records whether it has been moved from. */
+struct Handle {
+	explicit Handle(int v = 0) : value(v) {}
+	Handle(Handle&& other) : value(other.value) { other.value = -1; }
+	Handle& operator=(Handle&& rhs) { value = rhs.value; rhs.value = -1; return *this; }
+
+	int value;
+};
+} /* namespace */
+
+TEST_CASE("Move values into a ring buffer", "[modifiers]") {
+	sstl::ring_buffer<Handle, 4> a;
+
+	a.push_back(Handle(1));
+	a.emplace_back(2);
+	a.emplace_front(0);
+
+	REQUIRE(a.front().value == 0);
+	REQUIRE(a.back().value == 2);
+
+	sstl::ring_buffer<Handle, 4> b(sstl::move(a));
+
+	REQUIRE(a.empty());
+	REQUIRE(b.size() == 3);
+	REQUIRE(b[1].value == 1);
+}
+#endif
@@ -0,0 +1,123 @@
+#include "catch/catch.hpp"
+
+#include "spsc_queue.h"
+
+#include "fixtures.h"
+
+#if __cplusplus >= 201103
+#include <thread>
+
+TEST_CASE("Push and pop values on a single-producer/single-consumer queue", "[modifiers]") {
+	sstl::spsc_queue<int, 4> q;
+	int value = -1;
+
+	SECTION("Starts empty") {
+		REQUIRE(q.empty());
+		REQUIRE(q.capacity() == 4);
+		REQUIRE(!q.pop(value));
+	}
+
+	SECTION("First in, first out across the wrap point") {
+		for (int i = 0; i < 10; ++i) {
+			REQUIRE(q.push(i));
+			REQUIRE(q.push(i + 100));
+			REQUIRE(q.pop(value));
+			REQUIRE(value == i);
+			REQUIRE(q.pop(value));
+			REQUIRE(value == i + 100);
+		}
+
+		REQUIRE(q.empty());
+	}
+
+	SECTION("Pushing to a full queue fails") {
+		for (int i = 0; i < 4; ++i) { REQUIRE(q.push(i)); }
+
+		REQUIRE(!q.push(4));
+		REQUIRE(q.size() == 4);
+		REQUIRE(q.pop(value));
+		REQUIRE(value == 0);
+		REQUIRE(q.push(4));
+	}
+
+	SECTION("Capacity is rounded up to a power of two") {
+		sstl::spsc_queue<int, 5> a;
+		sstl::spsc_queue<int>& b = a;
+
+		REQUIRE(a.capacity() == 8);
+		REQUIRE(b.max_size() == 8);
+	}
+}
+
+TEST_CASE("Push and pop batches on a single-producer/single-consumer queue", "[modifiers]") {
+	sstl::spsc_queue<int, 8> q;
+	int in[8] = {0, 1, 2, 3, 4, 5, 6, 7};
+	int out[8] = {};
+
+	REQUIRE(q.push(in, 5) == 5);
+	REQUIRE(q.pop(out, 3) == 3);
+	REQUIRE(out[2] == 2);
+
+	SECTION("A batch wraps around the end of the storage") {
+		REQUIRE(q.push(in, 8) == 6);
+		REQUIRE(q.pop(out, 8) == 8);
+
+		int expect[8] = {3, 4, 0, 1, 2, 3, 4, 5};
+		REQUIRE(sstl::equal(out, out + 8, expect));
+		REQUIRE(q.empty());
+	}
+
+	SECTION("Popping more than is queued") {
+		REQUIRE(q.pop(out, 8) == 2);
+		REQUIRE(out[0] == 3);
+		REQUIRE(out[1] == 4);
+		REQUIRE(q.pop(out, 8) == 0);
+	}
+}
+
+TEST_CASE("Destroy non-trivial values in a single-producer/single-consumer queue", "[modifiers]") {
+	{
+		sstl::spsc_queue<Tracked, 4> q;
+		Tracked out;
+
+		q.push(Tracked(1));
+		q.emplace(2);
+		q.emplace(3);
+
+		REQUIRE(Tracked::live == 4);
+		REQUIRE(q.pop(out));
+		REQUIRE(out.value == 1);
+		REQUIRE(Tracked::live == 3);
+	}
+
+	REQUIRE(Tracked::live == 0);
+}
+
+TEST_CASE("Pass values between two threads", "[concurrency]") {
+	static sstl::spsc_queue<unsigned, 64> q;
+	const unsigned count = 100000;
+	bool ordered = true;
+
+	std::thread consumer([&] {
+		unsigned batch[16];
+		unsigned expect = 0;
+
+		while (expect < count) {
+			const size_t popped = q.pop(batch, 16);
+
+			for (size_t i = 0; i < popped; ++i) { ordered = ordered && batch[i] == expect++; }
+
+			if (!popped) { std::this_thread::yield(); }
+		}
+	});
+
+	for (unsigned i = 0; i < count; ++i) {
+		while (!q.push(i)) { std::this_thread::yield(); }
+	}
+
+	consumer.join();
+
+	REQUIRE(ordered);
+	REQUIRE(q.empty());
+}
+#endif
@@ -0,0 +1,76 @@
+#include <map>
+#include <new>
+#include <vector>
+
+#include "catch/catch.hpp"
+
+#include "static_allocator.h"
+
+TEST_CASE("Serve std containers from an arena", "[allocator]") {
+	sstl::arena<4096> a;
+
+	SECTION("A vector") {
+		sstl::static_allocator<int> allocator(a);
+		std::vector<int, sstl::static_allocator<int> > v(allocator);
+
+		for (int i = 0; i < 100; ++i) { v.push_back(i); }
+
+		REQUIRE(v.size() == 100);
+		REQUIRE(v[42] == 42);
+		REQUIRE(a.owns(&v[0]));
+	}
+
+	SECTION("A map, whose allocator is rebound to its node type") {
+		typedef sstl::static_allocator<std::pair<const int, int> > allocator;
+		std::map<int, int, std::less<int>, allocator> m((std::less<int>()), allocator(a));
+
+		for (int i = 0; i < 20; ++i) { m[i] = i * i; }
+
+		REQUIRE(m[7] == 49);
+		REQUIRE(a.size() >= 20 * sizeof(std::pair<const int, int>));
+		REQUIRE(a.owns(&*m.begin()));
+	}
+
+	SECTION("Releasing the arena after the containers are gone") {
+		{
+			sstl::static_allocator<int> allocator(a);
+			std::vector<int, sstl::static_allocator<int> > v(10, 1, allocator);
+			std::vector<int, sstl::static_allocator<int> > w(v);
+
+			REQUIRE(w.get_allocator() == allocator);
+		}
+
+		a.release();
+
+		REQUIRE(a.empty());
+	}
+
+	SECTION("Exhausting the arena") {
+		std::vector<int, sstl::static_allocator<int> > v((sstl::static_allocator<int>(a)));
+
+		a.allocate(1024);
+
+		REQUIRE_THROWS_AS(v.reserve(1000), const std::bad_alloc&);
+	}
+
+	SECTION("A count whose size overflows") {
+		sstl::static_allocator<int> allocator(a);
+		const size_t wraps_to_eight = size_t(-1) / sizeof(int) + 3;
+
+		REQUIRE_THROWS_AS(allocator.allocate(wraps_to_eight), const std::bad_alloc&);
+		REQUIRE(a.empty());
+	}
+}
+
+TEST_CASE("Compare static allocators", "[allocator]") {
+	sstl::arena<64> a;
+	sstl::arena<64> b;
+	sstl::static_allocator<int> x(a);
+	sstl::static_allocator<char> y(x);
+	sstl::static_allocator<int> z(b);
+
+	REQUIRE(x == y);
+	REQUIRE(x != z);
+	REQUIRE(&y.get_arena() == &a);
+	REQUIRE(x.max_size() == 16);
+}
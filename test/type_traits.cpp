@@ -40,3 +40,68 @@ TEST_CASE("Aligned uninitialized byte storage", "[alignment]") {
 		         == 8));
 	}
 }
+
+struct Trivial { int value; };
+struct NonTrivial { NonTrivial(const NonTrivial&) {} };
+struct Destructible { ~Destructible() {} };
+
+TEST_CASE("Check type categories", "[categories]") {
+	SECTION("Same types") {
+		REQUIRE((sstl::is_same<int, int>::value));
+		REQUIRE((!sstl::is_same<int, const int>::value));
+		REQUIRE((!sstl::is_same<int, unsigned>::value));
+	}
+
+	SECTION("Pointer types") {
+		REQUIRE((sstl::is_pointer<int*>::value));
+		REQUIRE((sstl::is_pointer<const int* const>::value));
+		REQUIRE((!sstl::is_pointer<int>::value));
+	}
+
+	SECTION("Arithmetic types") {
+		REQUIRE((sstl::is_arithmetic<double>::value));
+		REQUIRE((sstl::is_arithmetic<const unsigned char>::value));
+		REQUIRE((!sstl::is_arithmetic<int*>::value));
+		REQUIRE((!sstl::is_arithmetic<Trivial>::value));
+	}
+
+	SECTION("Signed and unsigned types") {
+		REQUIRE((sstl::is_signed<int>::value));
+		REQUIRE((sstl::is_signed<const double>::value));
+		REQUIRE((!sstl::is_signed<unsigned char>::value));
+		REQUIRE((!sstl::is_signed<bool>::value));
+		REQUIRE((sstl::is_unsigned<unsigned long>::value));
+		REQUIRE((!sstl::is_unsigned<signed char>::value));
+		REQUIRE((!sstl::is_signed<Trivial>::value));
+		REQUIRE((!sstl::is_unsigned<int*>::value));
+	}
+}
+
+TEST_CASE("Check type triviality", "[trivial]") {
+	SECTION("Scalars are always trivial") {
+		REQUIRE((sstl::is_trivially_copyable<int>::value));
+		REQUIRE((sstl::is_trivially_copyable<float*>::value));
+		REQUIRE((sstl::is_trivially_destructible<long>::value));
+	}
+
+	SECTION("Non-trivial types are never reported trivial") {
+		REQUIRE((!sstl::is_trivially_copyable<NonTrivial>::value));
+		REQUIRE((!sstl::is_trivially_copyable<Destructible>::value));
+		REQUIRE((!sstl::is_trivially_destructible<Destructible>::value));
+	}
+
+	SECTION("Only single byte trivial types are bitwise fillable") {
+		REQUIRE((sstl::is_bitwise_fillable<char>::value));
+		REQUIRE((sstl::is_bitwise_fillable<uint8_t>::value));
+		REQUIRE((sstl::is_bitwise_fillable<bool>::value));
+		REQUIRE((!sstl::is_bitwise_fillable<volatile char>::value));
+		REQUIRE((!sstl::is_bitwise_fillable<int>::value));
+	}
+}
+
+struct Constructed { Constructed() : value(1) {} int value; };
+
+TEST_CASE("Check default construction triviality", "[trivial]") {
+	REQUIRE((sstl::is_trivially_default_constructible<int>::value));
+	REQUIRE((!sstl::is_trivially_default_constructible<Constructed>::value));
+}
@@ -0,0 +1,267 @@
+#include "catch/catch.hpp"
+
+#include "unordered_map.h"
+
+#include "fixtures.h"
+
+TEST_CASE("Construct an unordered map", "[constructor]") {
+	SECTION("Default construct") {
+		sstl::unordered_map<int, int, 4> a;
+
+		REQUIRE(a.empty());
+		REQUIRE(a.max_size() == 4);
+		REQUIRE(a.begin() == a.end());
+	}
+
+	SECTION("Room for N elements at a load of at most 7/8") {
+		sstl::unordered_map<int, int, 14> a;
+		sstl::unordered_map<int, int, 15> b;
+		sstl::unordered_map<int, int, 100> c;
+		sstl::unordered_map<int, int>& d = c;
+
+		REQUIRE(a.bucket_count() == 16);
+		REQUIRE(b.bucket_count() == 32);
+		REQUIRE(c.bucket_count() == 128);
+		REQUIRE(d.max_size() == 100);
+	}
+
+	SECTION("From a range with duplicate keys") {
+		sstl::pair<int, char> init[4] = {
+			sstl::make_pair(1, 'a'), sstl::make_pair(2, 'b'), sstl::make_pair(1, 'c'),
+			sstl::make_pair(3, 'd')
+		};
+
+		sstl::unordered_map<int, char, 8> a(init, init + 4);
+
+		REQUIRE(a.size() == 3);
+		REQUIRE(a[1] == 'a');
+		REQUIRE(a[3] == 'd');
+	}
+
+	SECTION("Copy construct through the base class") {
+		sstl::unordered_map<int, int, 8> a;
+
+		for (int i = 0; i < 8; ++i) { a[i] = i * 10; }
+
+		sstl::unordered_map<int, int>& base = a;
+		sstl::unordered_map<int, int, 4> b(base);
+		sstl::unordered_map<int, int, 8> c(a);
+
+		REQUIRE(b.size() == 4);
+		REQUIRE(c.size() == 8);
+
+		for (int i = 0; i < 8; ++i) { REQUIRE(c.find(i)->second == i * 10); }
+	}
+}
+
+TEST_CASE("Look up keys in an unordered map", "[lookup]") {
+	sstl::unordered_map<int, int, 1000> a;
+
+	for (int i = 0; i < 1000; ++i) { REQUIRE(a.insert(sstl::make_pair(i * 7, i)).second); }
+
+	SECTION("Every key is found") {
+		for (int i = 0; i < 1000; ++i) {
+			REQUIRE(a.find(i * 7) != a.end());
+			REQUIRE(a.find(i * 7)->second == i);
+		}
+
+		REQUIRE(a.size() == 1000);
+	}
+
+	SECTION("Missing keys are not found") {
+		for (int i = 0; i < 1000; ++i) {
+			REQUIRE(!a.contains(i * 7 + 1));
+			REQUIRE(a.count(i * 7 + 3) == 0);
+		}
+	}
+
+	SECTION("Iterate over every element once") {
+		const sstl::unordered_map<int, int>& c = a;
+		long sum = 0;
+		size_t count = 0;
+
+		for (sstl::unordered_map<int, int>::const_iterator it = c.begin(); it != c.end(); ++it) {
+			sum += it->second;
+			++count;
+		}
+
+		REQUIRE(count == 1000);
+		REQUIRE(sum == 999 * 1000 / 2);
+	}
+}
+
+TEST_CASE("Modify an unordered map", "[modifiers]") {
+	sstl::unordered_map<int, int, 32> a;
+
+	SECTION("Insert keeps existing values") {
+		REQUIRE(a.insert(sstl::make_pair(2, 20)).second);
+
+		sstl::pair<sstl::unordered_map<int, int>::iterator, bool> result = a.insert(sstl::make_pair(2, 99));
+		REQUIRE(!result.second);
+		REQUIRE(result.first->second == 20);
+	}
+
+	SECTION("Insert or assign replaces existing values") {
+		REQUIRE(a.insert_or_assign(2, 20).second);
+		REQUIRE(!a.insert_or_assign(2, 99).second);
+		REQUIRE(a[2] == 99);
+	}
+
+	SECTION("Insert into a full map fails") {
+		for (int i = 0; i < 32; ++i) { a[i] = i; }
+
+		REQUIRE(a.insert(sstl::make_pair(100, 0)).first == a.end());
+		REQUIRE(!a.insert(sstl::make_pair(100, 0)).second);
+		REQUIRE(a.insert(sstl::make_pair(5, 0)).first->second == 5);
+		REQUIRE(a.size() == 32);
+	}
+
+	SECTION("Subscript on a full map leaves the elements alone") {
+		sstl::unordered_map<int, int, 8> full;
+
+		for (int i = 0; i < 8; ++i) { full[i] = i; }
+
+		full[12345] = 0x01010101;
+		full[12345] += 1;
+		REQUIRE(full[54321] == 0);
+
+		REQUIRE(full.size() == 8);
+		REQUIRE(full.find(12345) == full.end());
+
+		for (int i = 0; i < 8; ++i) { REQUIRE(full.find(i)->second == i); }
+
+		full.erase(3);
+		full[12345] = 7;
+		REQUIRE(full.find(12345)->second == 7);
+	}
+
+	SECTION("Out of range maximum load factors are clamped or ignored") {
+		const float full = a.max_load_factor();
+		const float zero = 0.0f;
+
+		a.max_load_factor(-1.0f);
+		REQUIRE(a.max_load_factor() == full);
+		a.max_load_factor(zero);
+		REQUIRE(a.max_load_factor() == full);
+		a.max_load_factor(zero / zero);
+		REQUIRE(a.max_load_factor() == full);
+		a.max_load_factor(1.0f / zero);
+		REQUIRE(a.max_load_factor() == full);
+
+		a.max_load_factor(0.25f);
+		a.max_load_factor(-1.0f);
+		REQUIRE(a.max_load_factor() == 0.25f);
+		a.max_load_factor(4.0f);
+		REQUIRE(a.max_load_factor() == full);
+
+		for (int i = 0; i < 64; ++i) { a.insert(sstl::make_pair(i, i)); }
+
+		REQUIRE(a.size() == 32);
+	}
+
+	SECTION("A lower maximum load factor caps the size") {
+		a.max_load_factor(0.25f);
+
+		REQUIRE(a.max_load_factor() == 0.25f);
+
+		for (int i = 0; i < 32; ++i) { a.insert(sstl::make_pair(i, i)); }
+
+		REQUIRE(a.size() == a.bucket_count() / 4);
+		REQUIRE(a.load_factor() == 0.25f);
+	}
+
+	SECTION("Erase leaves no tombstones behind") {
+		/* Keep the table at capacity while replacing every key many times over. */
+		for (int i = 0; i < 32; ++i) { a[i] = i; }
+
+		for (int round = 1; round < 50; ++round) {
+			for (int i = 0; i < 32; ++i) {
+				REQUIRE(a.erase((round - 1) * 32 + i) == 1);
+				REQUIRE(a.insert(sstl::make_pair(round * 32 + i, i)).second);
+			}
+		}
+
+		for (int i = 0; i < 32; ++i) { REQUIRE(a.find(49 * 32 + i)->second == i); }
+
+		REQUIRE(a.size() == 32);
+		REQUIRE(a.erase(0) == 0);
+	}
+
+	SECTION("Erase while iterating") {
+		for (int i = 0; i < 32; ++i) { a[i] = i; }
+
+		for (sstl::unordered_map<int, int>::iterator it = a.begin(); it != a.end();) {
+			if (it->first % 2) {
+				it = a.erase(it);
+			} else {
+				++it;
+			}
+		}
+
+		for (int i = 0; i < 32; ++i) { REQUIRE(a.contains(i) == (i % 2 == 0)); }
+	}
+
+#if __cplusplus >= 201103
+	SECTION("Emplace a value in place") {
+		REQUIRE(a.try_emplace(5, 50).second);
+		REQUIRE(!a.try_emplace(5, 51).second);
+		REQUIRE(a[5] == 50);
+	}
+#endif
+}
+
+namespace {
+/** Hash which puts every key in the same home slot, so every element shares one probe run. */
+struct Collide {
+	size_t operator()(int) const { return 0; }
+};
+} /* namespace */
+
+TEST_CASE("Destroy non-trivial values in an unordered map", "[modifiers]") {
+	{
+		sstl::unordered_map<int, Tracked, 8> a;
+
+		for (int i = 0; i < 8; ++i) { a[i] = Tracked(i); }
+
+		REQUIRE(Tracked::live == 8);
+		a.erase(3);
+		REQUIRE(Tracked::live == 7);
+	}
+
+	REQUIRE(Tracked::live == 0);
+}
+
+TEST_CASE("Shift colliding elements back on erase", "[modifiers]") {
+	sstl::unordered_map<int, int, 20, Collide> a;
+
+	for (int i = 0; i < 20; ++i) { a[i] = i; }
+
+	for (int i = 0; i < 20; i += 3) { REQUIRE(a.erase(i) == 1); }
+
+	for (int i = 0; i < 20; ++i) {
+		REQUIRE(a.contains(i) == (i % 3 != 0));
+	}
+
+	REQUIRE(a.insert(sstl::make_pair(0, 0)).second);
+	REQUIRE(a.contains(0));
+}
+
+#if __cplusplus >= 201103
+/** Reads through the size-erased base, so nothing here can be folded at compile time. */
+static size_t read_capacity(const sstl::unordered_map<int, int>& m) { return m.max_size(); }
+
+extern sstl::unordered_map<int, int, 16> constant_hash_map;
+
+/**
+	Dynamically initialized before constant_hash_map is defined, so it only sees
+	the map's capacity if the map was constant initialized.
+*/
+static const size_t constant_map_seen = read_capacity(constant_hash_map);
+
+sstl::unordered_map<int, int, 16> constant_hash_map;
+
+TEST_CASE("Constant initialize an unordered map", "[constructor]") {
+	REQUIRE(constant_map_seen == 16);
+	REQUIRE(constant_hash_map.empty());
+}
+#endif
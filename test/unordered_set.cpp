@@ -0,0 +1,76 @@
+#include "catch/catch.hpp"
+
+#include "unordered_set.h"
+
+TEST_CASE("Construct an unordered set", "[constructor]") {
+	SECTION("Default construct") {
+		sstl::unordered_set<int, 4> a;
+
+		REQUIRE(a.empty());
+		REQUIRE(a.max_size() == 4);
+		REQUIRE(a.bucket_count() == 16);
+	}
+
+	SECTION("From a range with duplicates") {
+		int init[6] = {5, 1, 3, 1, 5, 2};
+		sstl::unordered_set<int, 8> a(init, init + 6);
+
+		REQUIRE(a.size() == 4);
+		REQUIRE(a.contains(2));
+		REQUIRE(!a.contains(4));
+	}
+
+	SECTION("Copy construct through the base class") {
+		int init[3] = {3, 1, 2};
+		sstl::unordered_set<int, 4> a(init, init + 3);
+		sstl::unordered_set<int>& base = a;
+		sstl::unordered_set<int, 8> b(base);
+
+		REQUIRE(b.size() == 3);
+		REQUIRE(b.contains(1));
+		REQUIRE(b.contains(3));
+	}
+}
+
+TEST_CASE("Modify an unordered set", "[modifiers]") {
+	sstl::unordered_set<unsigned, 200> a;
+
+	SECTION("Insert and find") {
+		for (unsigned i = 0; i < 200; ++i) { REQUIRE(a.insert(i * 1024).second); }
+
+		REQUIRE(!a.insert(0).second);
+		REQUIRE(a.insert(1).first == a.end());
+
+		for (unsigned i = 0; i < 200; ++i) { REQUIRE(*a.find(i * 1024) == i * 1024); }
+
+		REQUIRE(a.find(1) == a.end());
+	}
+
+	SECTION("Erase by key and position") {
+		for (unsigned i = 0; i < 100; ++i) { a.insert(i); }
+
+		REQUIRE(a.erase(50u) == 1);
+		REQUIRE(a.erase(50u) == 0);
+
+		a.erase(a.find(7));
+
+		REQUIRE(a.size() == 98);
+		REQUIRE(!a.contains(7));
+
+		size_t count = 0;
+
+		for (sstl::unordered_set<unsigned>::const_iterator it = a.begin(); it != a.end(); ++it) { ++count; }
+
+		REQUIRE(count == 98);
+	}
+
+	SECTION("Clear") {
+		for (unsigned i = 0; i < 100; ++i) { a.insert(i); }
+
+		a.clear();
+
+		REQUIRE(a.empty());
+		REQUIRE(a.begin() == a.end());
+		REQUIRE(!a.contains(3));
+	}
+}
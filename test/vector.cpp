@@ -1,7 +1,12 @@
+#include <string.h>
+#include <string>
+
 #include "catch/catch.hpp"
 
 #include "vector.h"
 
+#include "fixtures.h"
+
 TEST_CASE("Construct a vector", "[constructor]") {
 	SECTION("Default construct") {
 		sstl::vector<char, 3> a;
@@ -333,6 +338,138 @@ TEST_CASE("Remove values from a vector", "[modifiers]") {
 	}
 }
 
+TEST_CASE("Erase an empty range of strings", "[modifiers]") {
+	sstl::vector<std::string, 4> a;
+	a.push_back("a");
+	a.push_back("b");
+	a.push_back("c");
+
+	REQUIRE(a.erase(a.begin() + 1, a.begin() + 1) == a.begin() + 1);
+	REQUIRE(a.erase(a.end(), a.end()) == a.end());
+
+	REQUIRE(a.size() == 3);
+	REQUIRE(a[0] == "a");
+	REQUIRE(a[1] == "b");
+	REQUIRE(a[2] == "c");
+}
+
+TEST_CASE("Shift non-trivial values within a vector", "[modifiers]") {
+	{
+		int values[5] = {0, 1, 2, 3, 4};
+		sstl::vector<Tracked, 16> a(values, values + 5);
+
+		SECTION("Insert fewer values than the tail holds") {
+			a.insert(a.begin() + 1, 2, Tracked(9));
+
+			int expect[7] = {0, 9, 9, 1, 2, 3, 4};
+			REQUIRE(a.size() == 7);
+			REQUIRE(sstl::equal(a.begin(), a.end(), expect));
+		}
+
+		SECTION("Insert more values than the tail holds") {
+			a.insert(a.begin() + 4, 3, Tracked(9));
+
+			int expect[8] = {0, 1, 2, 3, 9, 9, 9, 4};
+			REQUIRE(a.size() == 8);
+			REQUIRE(sstl::equal(a.begin(), a.end(), expect));
+		}
+
+		SECTION("Insert a value aliasing an element") {
+			a.insert(a.begin(), a.back());
+
+			int expect[6] = {4, 0, 1, 2, 3, 4};
+			REQUIRE(sstl::equal(a.begin(), a.end(), expect));
+		}
+
+		SECTION("Erase a range from the middle") {
+			a.erase(a.begin() + 1, a.begin() + 3);
+
+			int expect[3] = {0, 3, 4};
+			REQUIRE(a.size() == 3);
+			REQUIRE(sstl::equal(a.begin(), a.end(), expect));
+		}
+
+		REQUIRE(Tracked::live == int(a.size()));
+	}
+
+	REQUIRE(Tracked::live == 0);
+}
+
+#if __cplusplus >= 201103
+namespace {
+/** Move-only type which records whether it has been moved from. */
+struct Handle {
+	Handle() : value(0) {}
+	explicit Handle(int v) : value(v) {}
+	Handle(int a, int b) : value(a + b) {}
+	Handle(Handle&& other) : value(other.value) { other.value = -1; }
+	Handle& operator=(Handle&& rhs) { value = rhs.value; rhs.value = -1; return *this; }
+
+	int value;
+};
+} /* namespace */
+
+TEST_CASE("Move values into and within a vector", "[modifiers]") {
+	sstl::vector<Handle, 8> a;
+
+	a.emplace_back(1);
+	a.emplace_back(2, 3);
+	a.push_back(Handle(7));
+
+	REQUIRE(a.size() == 3);
+	REQUIRE(a[0].value == 1);
+	REQUIRE(a[1].value == 5);
+	REQUIRE(a[2].value == 7);
+
+	SECTION("Emplace and insert in the middle") {
+		a.emplace(a.begin() + 1, 4);
+		a.insert(a.begin(), Handle(9));
+
+		REQUIRE(a.size() == 5);
+		REQUIRE(a[0].value == 9);
+		REQUIRE(a[1].value == 1);
+		REQUIRE(a[2].value == 4);
+		REQUIRE(a[3].value == 5);
+		REQUIRE(a[4].value == 7);
+
+		a.erase(a.begin());
+
+		REQUIRE(a.size() == 4);
+		REQUIRE(a[0].value == 1);
+	}
+
+	SECTION("Move construct") {
+		sstl::vector<Handle, 8> b(sstl::move(a));
+
+		REQUIRE(a.empty());
+		REQUIRE(b.size() == 3);
+		REQUIRE(b[2].value == 7);
+	}
+
+	SECTION("Move assign") {
+		sstl::vector<Handle, 8> b;
+		b.emplace_back(3);
+
+		b = sstl::move(a);
+
+		REQUIRE(a.empty());
+		REQUIRE(b.size() == 3);
+		REQUIRE(b[0].value == 1);
+		REQUIRE(b[2].value == 7);
+	}
+
+	SECTION("Push to a full vector drops the value") {
+		while (a.size() < a.max_size()) { a.emplace_back(0); }
+
+		a.emplace_back(11);
+		a.push_back(Handle(12));
+
+		REQUIRE(a.size() == 8);
+		REQUIRE(a.back().value == 0);
+	}
+}
+#endif
+
 TEST_CASE("Push and pop values on the vector", "[modifiers]") {
 	sstl::vector<int, 8> a;
 
@@ -447,3 +584,81 @@ TEST_CASE("Compare vectors lexicographically", "[comparison]") {
 		REQUIRE(a < b);
 	}
 }
+
+TEST_CASE("Vector storage layout", "[layout]") {
+#if !SSTL_INSTRUMENT
+	SECTION("Capacity is not duplicated by the element storage") {
+		typedef sstl::detail::stored_size_type stored;
+
+		REQUIRE(sizeof(sstl::vector<uint32_t, 2>) == 2 * sizeof(stored) + 2 * sizeof(uint32_t));
+		REQUIRE(sizeof(sstl::vector<uint8_t, 16>) == 2 * sizeof(stored) + 16);
+		REQUIRE(sizeof(sstl::vector<uint64_t, 1>) ==
+		        sstl::max(2 * sizeof(stored), sizeof(uint64_t)) + sizeof(uint64_t));
+	}
+#endif
+
+	SECTION("The size-erased base reads the size and capacity of any size") {
+		sstl::vector<int, 70000> a(3, 4);
+		sstl::vector<int>& ref = a;
+
+		REQUIRE(ref.size() == 3);
+		REQUIRE(ref.capacity() == 70000);
+		REQUIRE(ref.back() == 4);
+	}
+}
+
+TEST_CASE("Construct a vector without initializing it", "[constructor]") {
+	typedef sstl::vector<uint8_t, 16> bytes;
+
+	sstl::aligned_storage<sizeof(bytes), sstl::alignment_of<bytes>::value>::type
+	memory;
+	memset(&memory, 0xAA, sizeof(memory));
+
+	SECTION("Element storage is never touched by construction") {
+		bytes* a = new(&memory) bytes;
+
+		REQUIRE(a->empty());
+		REQUIRE(a->data()[0] == 0xAA);
+		REQUIRE(a->data()[15] == 0xAA);
+
+		a->~bytes();
+	}
+
+	SECTION("Default-initialized elements") {
+		bytes* a = new(&memory) bytes(8, sstl::default_init);
+
+		REQUIRE(a->size() == 8);
+		REQUIRE(a->back() == 0xAA);
+
+		a->resize(12, sstl::default_init);
+
+		REQUIRE(a->size() == 12);
+		REQUIRE(a->back() == 0xAA);
+
+		a->~bytes();
+	}
+}
+
+#if __cplusplus >= 201103
+/** Reads through the size-erased base, so nothing here can be folded at compile time. */
+static size_t read_capacity(const sstl::vector<int>& v) { return v.capacity(); }
+
+extern sstl::vector<int, 16> constant_vector;
+
+/**
+	Dynamically initialized before constant_vector is defined, so it only sees
+	the vector's capacity if the vector was constant initialized.
+*/
+static const size_t constant_vector_seen = read_capacity(constant_vector);
+
+sstl::vector<int, 16> constant_vector;
+
+TEST_CASE("Constant initialize a vector", "[constructor]") {
+#if __cplusplus >= 201402
+	static_assert(constant_vector.capacity() == 16, "capacity is a constant expression");
+#endif
+
+	REQUIRE(constant_vector_seen == 16);
+	REQUIRE(constant_vector.empty());
+}
+#endif